@@ -55,6 +55,7 @@ CONFIG_PARAMETER(Int32, ReadBufferSize, "NetLib.ReadBufferSize", 0x0FFFF)
 CONFIG_PARAMETER(Int32, WriteBufferSize, "NetLib.WriteBufferSize", 0x0FFFF)
 CONFIG_PARAMETER(Int32, PacketBufferBacklogSize, "NetLib.PacketBufferBacklogSize", 8)
 CONFIG_PARAMETER(Bool, LogPackets, "NetLib.LogPackets", 0)
+CONFIG_PARAMETER(UInt16, MetricsPort, "NetLib.MetricsPort", 0)
 CONFIG_END(NetLib)
 
 #undef CONFIG_BEGIN
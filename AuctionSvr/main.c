@@ -99,6 +99,7 @@ Int32 main(Int32 ArgumentCount, CString* Arguments) {
         &ServerOnUpdate,
         &ServerContext
     );
+    ServerEnableMetrics(Server, Config.NetLib.MetricsPort);
     ServerContext.Server = Server;
     ServerContext.IPCSocket = Server->IPCSocket;
 
@@ -217,6 +217,23 @@ Void ArrayRemoveElementAtIndex(
     Array->Count -= 1;
 }
 
+Void ArrayRemoveElementsAtIndex(
+    ArrayRef Array,
+    Int ElementIndex,
+    Int ElementCount
+) {
+    assert(ElementIndex + ElementCount <= Array->Count);
+
+    Int TailLength = Array->Count - ElementIndex - ElementCount;
+    if (TailLength > 0) {
+        UInt8* Source = ArrayGetElementAtIndex(Array, ElementIndex + ElementCount);
+        UInt8* Destination = ArrayGetElementAtIndex(Array, ElementIndex);
+        memmove(Destination, Source, Array->Size * TailLength);
+    }
+
+    Array->Count -= ElementCount;
+}
+
 Bool ArrayContainsElement(
     ArrayRef Array,
     Void* Element
@@ -115,6 +115,12 @@ Void ArrayRemoveElementAtIndex(
     Int Index
 );
 
+Void ArrayRemoveElementsAtIndex(
+    ArrayRef Array,
+    Int ElementIndex,
+    Int ElementCount
+);
+
 Bool ArrayContainsElement(
     ArrayRef Array,
     Void* Element
@@ -0,0 +1,34 @@
+#include <zlib.h>
+
+#include "Compression.h"
+
+Int32 CompressionGetBound(
+    Int32 SourceLength
+) {
+    return (Int32)compressBound((uLong)SourceLength);
+}
+
+Bool CompressionDeflate(
+    UInt8* Source,
+    Int32 SourceLength,
+    UInt8* Destination,
+    Int32* DestinationLength
+) {
+    uLongf Length = (uLongf)*DestinationLength;
+    Int32 Status = compress2(Destination, &Length, Source, (uLong)SourceLength, Z_BEST_SPEED);
+    if (Status != Z_OK) return false;
+
+    *DestinationLength = (Int32)Length;
+    return true;
+}
+
+Bool CompressionInflate(
+    UInt8* Source,
+    Int32 SourceLength,
+    UInt8* Destination,
+    Int32 DestinationLength
+) {
+    uLongf Length = (uLongf)DestinationLength;
+    Int32 Status = uncompress(Destination, &Length, Source, (uLong)SourceLength);
+    return Status == Z_OK && Length == (uLongf)DestinationLength;
+}
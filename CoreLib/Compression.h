@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Base.h"
+
+EXTERN_C_BEGIN
+
+Int32 CompressionGetBound(
+    Int32 SourceLength
+);
+
+// NOTE: DestinationLength is the capacity on input and receives the compressed length on success
+Bool CompressionDeflate(
+    UInt8* Source,
+    Int32 SourceLength,
+    UInt8* Destination,
+    Int32* DestinationLength
+);
+
+Bool CompressionInflate(
+    UInt8* Source,
+    Int32 SourceLength,
+    UInt8* Destination,
+    Int32 DestinationLength
+);
+
+EXTERN_C_END
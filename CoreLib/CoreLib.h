@@ -5,6 +5,7 @@
 #include <CoreLib/Archive.h>
 #include <CoreLib/Array.h>
 #include <CoreLib/BumpAllocator.h>
+#include <CoreLib/Compression.h>
 #include <CoreLib/Database.h>
 #include <CoreLib/Diagnostic.h>
 #include <CoreLib/Dictionary.h>
@@ -14,7 +15,10 @@
 #include <CoreLib/IndexSet.h>
 #include <CoreLib/MemoryBuffer.h>
 #include <CoreLib/MemoryPool.h>
+#include <CoreLib/Metrics.h>
 #include <CoreLib/ParsePrimitives.h>
+#include <CoreLib/SparseEncoding.h>
 #include <CoreLib/String.h>
 #include <CoreLib/TempAllocator.h>
+#include <CoreLib/TimerWheel.h>
 #include <CoreLib/Util.h>
@@ -1,13 +1,48 @@
 #include "Diagnostic.h"
 #include "Dictionary.h"
 #include "Database.h"
+#include "Metrics.h"
 #include "String.h"
+#include "Util.h"
 
 #include <sql.h>
 #include <sqlext.h>
 #include <sqltypes.h>
 
-#define DATABASE_RESULT_BUFFER_SIZE		8192
+#define DATABASE_RESULT_BUFFER_SIZE			8192
+#define DATABASE_MAX_STATEMENT_CACHE_COUNT	64
+#define DATABASE_MAX_PROCEDURE_NAME_LENGTH	128
+#define DATABASE_MAX_FETCH_ROW_COUNT		64
+
+struct _DatabaseColumn {
+	SQLSMALLINT NativeType;
+	SQLLEN Length;
+	Int64 DataOffset;
+	Int64 IndicatorOffset;
+};
+typedef struct _DatabaseColumn* DatabaseColumnRef;
+
+struct _DatabaseStatement {
+	SQLHSTMT Statement;
+	Bool IsActive;
+	Bool IsBound;
+	UInt64 LastUseIndex;
+	Char Procedure[DATABASE_MAX_PROCEDURE_NAME_LENGTH];
+	Int32 ParameterCount;
+	UInt8 ParameterSignature[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT * 2];
+	SQLPOINTER ParameterValues[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT];
+	SQLULEN ParameterLengths[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT];
+	SQLLEN ParameterIndicators[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT];
+	Int32 ColumnCount;
+	Int32 ColumnCapacity;
+	DatabaseColumnRef Columns;
+	Int64 ColumnMemorySize;
+	UInt8* ColumnMemory;
+	SQLULEN RowArraySize;
+	SQLULEN RowCount;
+	SQLULEN RowIndex;
+};
+typedef struct _DatabaseStatement* DatabaseStatementRef;
 
 struct _Database {
 	AllocatorRef Allocator;
@@ -23,6 +58,8 @@ struct _Database {
 	Int64 ResultBufferSize;
 	Bool AutoReconnect;
 	Int64 LastInsertID;
+	UInt64 StatementUseIndex;
+	DatabaseStatementRef Statements;
 };
 
 struct _Buffer {
@@ -204,13 +241,48 @@ DatabaseRef DatabaseConnect(
 	Result->ResultBufferSize = (ResultBufferSize > 0) ? ResultBufferSize : DATABASE_RESULT_BUFFER_SIZE;
 	Result->AutoReconnect = AutoReconnect;
 	Result->LastInsertID = 0;
+	Result->StatementUseIndex = 0;
+	Result->Statements = (DatabaseStatementRef)AllocatorAllocate(Allocator, sizeof(struct _DatabaseStatement) * DATABASE_MAX_STATEMENT_CACHE_COUNT);
+	if (!Result->Statements) Fatal("Memory allocation failed!");
+
+	memset(Result->Statements, 0, sizeof(struct _DatabaseStatement) * DATABASE_MAX_STATEMENT_CACHE_COUNT);
 	return Result;
 }
 
+static Void DatabaseInvalidateStatements(
+	DatabaseRef Database,
+	Bool FreeMemory
+) {
+	for (Int Index = 0; Index < DATABASE_MAX_STATEMENT_CACHE_COUNT; Index += 1) {
+		DatabaseStatementRef Statement = &Database->Statements[Index];
+		if (Statement->Statement) SQLFreeHandle(SQL_HANDLE_STMT, Statement->Statement);
+
+		// NOTE: Active statements stay reserved until their owner releases them, reading from them fails from now on
+		Statement->Statement = NULL;
+		Statement->IsBound = false;
+		Statement->Procedure[0] = '\0';
+		Statement->ParameterCount = 0;
+		Statement->RowCount = 0;
+		Statement->RowIndex = 0;
+
+		if (FreeMemory) {
+			if (Statement->Columns) AllocatorDeallocate(Database->Allocator, Statement->Columns);
+			if (Statement->ColumnMemory) AllocatorDeallocate(Database->Allocator, Statement->ColumnMemory);
+			Statement->Columns = NULL;
+			Statement->ColumnCapacity = 0;
+			Statement->ColumnMemory = NULL;
+			Statement->ColumnMemorySize = 0;
+		}
+	}
+}
+
 Void DatabaseDisconnect(
 	DatabaseRef Database
 ) {
 	assert(Database);
+	DatabaseInvalidateStatements(Database, true);
+	AllocatorDeallocate(Database->Allocator, Database->Statements);
+	if (Database->Connection) SQLDisconnect(Database->Connection);
 	if (Database->Connection) SQLFreeHandle(SQL_HANDLE_DBC, Database->Connection);
 	if (Database->Environment) SQLFreeHandle(SQL_HANDLE_ENV, Database->Environment);
 	AllocatorDeallocate(Database->Allocator, Database);
@@ -222,6 +294,10 @@ Bool DatabaseReconnect(
 	assert(Database);
 	if (!Database->AutoReconnect) return false;
 
+	// NOTE: Prepared statements belong to the old connection and have to be prepared again
+	DatabaseInvalidateStatements(Database, false);
+
+	SQLDisconnect(Database->Connection);
 	SQLFreeHandle(SQL_HANDLE_DBC, Database->Connection);
 	Database->Connection = NULL;
 
@@ -383,34 +459,113 @@ entry:
 	return true;
 }
 
-DatabaseHandleRef DatabaseCallProcedureFetchInternal(
+static DatabaseStatementRef DatabaseAcquireStatement(
 	DatabaseRef Database,
 	const Char* Procedure,
-	va_list Arguments
+	Int32 ParameterCount,
+	UInt8* ParameterSignature
 ) {
-	SQLHSTMT Statement;
-	SQLRETURN ReturnCode;
-
-entry:
-	ReturnCode = SQLAllocHandle(SQL_HANDLE_STMT, Database->Connection, &Statement);
-	if (!SQL_SUCCEEDED(ReturnCode)) {
-		if (HandleDatabaseError(SQL_HANDLE_STMT, Statement)) {
-			if (DatabaseReconnect(Database)) goto entry;
+	DatabaseStatementRef Victim = NULL;
+	Bool IsCached = false;
+	for (Int Index = 0; Index < DATABASE_MAX_STATEMENT_CACHE_COUNT; Index += 1) {
+		DatabaseStatementRef Statement = &Database->Statements[Index];
+		if (Statement->IsActive) continue;
+
+		if (Statement->Statement &&
+			Statement->ParameterCount == ParameterCount &&
+			CStringIsEqual(Statement->Procedure, (CString)Procedure) &&
+			memcmp(Statement->ParameterSignature, ParameterSignature, ParameterCount * 2) == 0) {
+			Victim = Statement;
+			IsCached = true;
+			break;
 		}
 
+		// NOTE: Empty slots are taken first, otherwise the least recently used statement is evicted
+		if (!Victim) Victim = Statement;
+		else if (Victim->Statement && (!Statement->Statement || Statement->LastUseIndex < Victim->LastUseIndex)) Victim = Statement;
+	}
+
+	if (!Victim) {
+		Error("Database statement cache exhausted!");
 		return NULL;
 	}
 
-	SQLCHAR Query[DATABASE_MAX_QUERY_LENGTH] = { 0 };
+	Database->StatementUseIndex += 1;
+	Victim->IsActive = true;
+	Victim->LastUseIndex = Database->StatementUseIndex;
+
+	if (IsCached) return Victim;
+
+	if (Victim->Statement) SQLFreeHandle(SQL_HANDLE_STMT, Victim->Statement);
+
+	Victim->Statement = NULL;
+	Victim->IsBound = false;
+	CStringCopySafe(Victim->Procedure, DATABASE_MAX_PROCEDURE_NAME_LENGTH, (CString)Procedure);
+	Victim->ParameterCount = ParameterCount;
+	memcpy(Victim->ParameterSignature, ParameterSignature, ParameterCount * 2);
+	memset(Victim->ParameterValues, 0, sizeof(Victim->ParameterValues));
+	memset(Victim->ParameterLengths, 0, sizeof(Victim->ParameterLengths));
+	return Victim;
+}
+
+static Void DatabaseStatementRelease(
+	DatabaseRef Database,
+	DatabaseStatementRef Statement
+) {
+	if (Statement->Statement) {
+		SQLFreeStmt(Statement->Statement, SQL_CLOSE);
+		if (Statement->IsBound) SQLFreeStmt(Statement->Statement, SQL_UNBIND);
+	}
+
+	Statement->IsActive = false;
+	Statement->IsBound = false;
+	Statement->RowCount = 0;
+	Statement->RowIndex = 0;
+}
+
+static Void DatabaseStatementDiscard(
+	DatabaseRef Database,
+	DatabaseStatementRef Statement
+) {
+	if (Statement->Statement) SQLFreeHandle(SQL_HANDLE_STMT, Statement->Statement);
+
+	Statement->Statement = NULL;
+	Statement->IsActive = false;
+	Statement->IsBound = false;
+	Statement->Procedure[0] = '\0';
+	Statement->ParameterCount = 0;
+	Statement->RowCount = 0;
+	Statement->RowIndex = 0;
+}
+
+static Bool DatabaseStatementHandleError(
+	DatabaseRef Database,
+	DatabaseStatementRef Statement,
+	Bool Discard
+) {
+	Bool IsDisconnected = HandleDatabaseError(SQL_HANDLE_STMT, Statement->Statement);
+	if (Discard) DatabaseStatementDiscard(Database, Statement);
+	else DatabaseStatementRelease(Database, Statement);
+
+	return IsDisconnected && DatabaseReconnect(Database);
+}
+
+static DatabaseStatementRef DatabaseCallProcedureFetchInternal(
+	DatabaseRef Database,
+	const Char* Procedure,
+	va_list Arguments
+) {
 	Int32 ParameterCount = 0;
+	UInt8 ParameterSignature[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT * 2] = { 0 };
 	SQLSMALLINT ParameterDirections[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT] = { 0 };
 	SQLSMALLINT ParameterTypes[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT] = { 0 };
 	SQLSMALLINT ParameterNativeTypes[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT] = { 0 };
-	SQLSMALLINT ParameterLengths[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT] = { 0 };
-	SQLCHAR* ParameterValues[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT] = { 0 };
-	SQLLEN ParameterOutLengths[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT] = { 0 };
+	SQLULEN ParameterLengths[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT] = { 0 };
+	SQLPOINTER ParameterValues[DATABASE_MAX_PROCEDURE_PARAMETER_COUNT] = { 0 };
 
-	snprintf((Char*)Query, sizeof(Query), "{ CALL %s(", Procedure);
+	assert(strlen(Procedure) < DATABASE_MAX_PROCEDURE_NAME_LENGTH);
+
+	// NOTE: The arguments are consumed once up front so a retry after a reconnect can bind them again
 	while (true) {
 		Int32 ParameterDirection = va_arg(Arguments, Int32);
 		if (ParameterDirection == DB_PARAM_END) break;
@@ -422,6 +577,8 @@ entry:
 
 		struct _DatabaseTypeMapping ParameterMapping = DatabaseTypeGetMapping(ParameterType);
 
+		ParameterSignature[ParameterCount * 2 + 0] = (UInt8)ParameterDirection;
+		ParameterSignature[ParameterCount * 2 + 1] = (UInt8)ParameterType;
 		ParameterDirections[ParameterCount] = DatabaseTypeGetNativeDirection(ParameterDirection);
 		ParameterTypes[ParameterCount] = ParameterMapping.SQLType;
 		ParameterNativeTypes[ParameterCount] = ParameterMapping.NativeType;
@@ -434,44 +591,60 @@ entry:
 
 		if (!ParameterNativeTypes[ParameterCount]) {
 			Error("Not supported parameter type %d.\n", ParameterType);
-
-			if (HandleDatabaseError(SQL_HANDLE_STMT, Statement)) {
-				if (DatabaseReconnect(Database)) {
-					SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-					goto entry;
-				}
-			}
-
-			SQLFreeHandle(SQL_HANDLE_STMT, Statement);
 			return NULL;
 		}
 
-		if (ParameterCount > 0) strcat((char*)Query, ", ");
-		strcat((char*)Query, "?");
 		ParameterCount += 1;
 	}
-	strcat((char*)Query, ") }");
 
-	Trace("SQL Query: %s", Query);
-	ReturnCode = SQLPrepare(Statement, Query, SQL_NTS);
-	if (!SQL_SUCCEEDED(ReturnCode)) {
-		if (HandleDatabaseError(SQL_HANDLE_STMT, Statement)) {
-			if (DatabaseReconnect(Database)) {
-				SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-				goto entry;
+	DatabaseStatementRef Statement = NULL;
+	SQLRETURN ReturnCode;
+
+entry:
+	Statement = DatabaseAcquireStatement(Database, Procedure, ParameterCount, ParameterSignature);
+	if (!Statement) return NULL;
+
+	if (!Statement->Statement) {
+		ReturnCode = SQLAllocHandle(SQL_HANDLE_STMT, Database->Connection, &Statement->Statement);
+		if (!SQL_SUCCEEDED(ReturnCode)) {
+			Statement->Statement = NULL;
+			DatabaseStatementDiscard(Database, Statement);
+
+			if (HandleDatabaseError(SQL_HANDLE_DBC, Database->Connection)) {
+				if (DatabaseReconnect(Database)) goto entry;
 			}
+
+			return NULL;
 		}
 
-		SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-		return NULL;
+		SQLCHAR Query[DATABASE_MAX_QUERY_LENGTH] = { 0 };
+		Int32 QueryLength = snprintf((Char*)Query, sizeof(Query), "{ CALL %s(", Procedure);
+		for (Int32 ParameterIndex = 0; ParameterIndex < ParameterCount; ParameterIndex += 1) {
+			QueryLength += snprintf((Char*)Query + QueryLength, sizeof(Query) - QueryLength, (ParameterIndex > 0) ? ", ?" : "?");
+		}
+		snprintf((Char*)Query + QueryLength, sizeof(Query) - QueryLength, ") }");
+
+		Trace("SQL Query: %s", Query);
+		ReturnCode = SQLPrepare(Statement->Statement, Query, SQL_NTS);
+		if (!SQL_SUCCEEDED(ReturnCode)) {
+			if (DatabaseStatementHandleError(Database, Statement, true)) goto entry;
+
+			return NULL;
+		}
 	}
 
+	// NOTE: Bindings persist on a prepared statement so only parameters with a different buffer are bound again
 	for (Int ParameterIndex = 0; ParameterIndex < ParameterCount; ++ParameterIndex) {
+		Statement->ParameterIndicators[ParameterIndex] = ParameterLengths[ParameterIndex];
+		if (Statement->ParameterValues[ParameterIndex] == ParameterValues[ParameterIndex] &&
+			Statement->ParameterLengths[ParameterIndex] == ParameterLengths[ParameterIndex]) {
+			continue;
+		}
+
 		Trace("Binding Parameter %d: Value=%p, Length=%d", ParameterIndex + 1, ParameterValues[ParameterIndex], ParameterLengths[ParameterIndex]);
 
-		ParameterOutLengths[ParameterIndex] = ParameterLengths[ParameterIndex];
 		ReturnCode = SQLBindParameter(
-			Statement,
+			Statement->Statement,
 			ParameterIndex + 1,
 			ParameterDirections[ParameterIndex],
 			ParameterNativeTypes[ParameterIndex],
@@ -480,39 +653,30 @@ entry:
 			0,
 			ParameterValues[ParameterIndex],
 			ParameterLengths[ParameterIndex],
-			(ParameterTypes[ParameterIndex] == SQL_LONGVARBINARY) ? &ParameterOutLengths[ParameterIndex] : NULL
+			(ParameterTypes[ParameterIndex] == SQL_LONGVARBINARY) ? &Statement->ParameterIndicators[ParameterIndex] : NULL
 		);
 
 		if (!SQL_SUCCEEDED(ReturnCode)) {
 			Trace("SQLBindParameter failed for Parameter %d with code %d", ParameterIndex + 1, ReturnCode);
 
-			if (HandleDatabaseError(SQL_HANDLE_STMT, Statement)) {
-				if (DatabaseReconnect(Database)) {
-					SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-					goto entry;
-				}
-			}
+			if (DatabaseStatementHandleError(Database, Statement, true)) goto entry;
 
-			SQLFreeHandle(SQL_HANDLE_STMT, Statement);
 			return NULL;
 		}
+
+		Statement->ParameterValues[ParameterIndex] = ParameterValues[ParameterIndex];
+		Statement->ParameterLengths[ParameterIndex] = ParameterLengths[ParameterIndex];
 	}
 
 	Trace("Executing statement...");
-	ReturnCode = SQLExecute(Statement);
+	ReturnCode = SQLExecute(Statement->Statement);
 	if (!SQL_SUCCEEDED(ReturnCode)) {
-		if (HandleDatabaseError(SQL_HANDLE_STMT, Statement)) {
-			if (DatabaseReconnect(Database)) {
-				SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-				goto entry;
-			}
-		}
+		if (DatabaseStatementHandleError(Database, Statement, false)) goto entry;
 
-		SQLFreeHandle(SQL_HANDLE_STMT, Statement);
 		return NULL;
 	}
 
-	return (DatabaseHandleRef)Statement;
+	return Statement;
 }
 
 DatabaseHandleRef DatabaseCallProcedureFetch(
@@ -522,11 +686,95 @@ DatabaseHandleRef DatabaseCallProcedureFetch(
 ) {
 	Trace("Call Procedure: %s", Procedure);
 
+	Timestamp CallTimestamp = PlatformGetTickCountUs();
 	va_list Arguments;
 	va_start(Arguments, Procedure);
-	DatabaseHandleRef Handle = DatabaseCallProcedureFetchInternal(Database, Procedure, Arguments);
+	DatabaseStatementRef Statement = DatabaseCallProcedureFetchInternal(Database, Procedure, Arguments);
 	va_end(Arguments);
-	return Handle;
+	MetricsHistogramRecord("database_procedure_duration_us", PlatformGetTickCountUs() - CallTimestamp);
+	if (!Statement) MetricsCounterAdd("database_procedure_failures", 1);
+	return (DatabaseHandleRef)Statement;
+}
+
+static Bool DatabaseStatementBindColumns(
+	DatabaseRef Database,
+	DatabaseStatementRef Statement,
+	va_list Arguments
+) {
+	Int64 RowSize = 0;
+	Statement->ColumnCount = 0;
+	while (true) {
+		Int32 DataType = va_arg(Arguments, Int32);
+		if (DataType == DB_PARAM_END) break;
+
+		struct _DatabaseTypeMapping DataMapping = DatabaseTypeGetMapping(DataType);
+
+		va_arg(Arguments, SQLPOINTER);
+		SQLLEN BufferLength = DataMapping.NativeSize;
+
+		if (BufferLength < 1) {
+			BufferLength = va_arg(Arguments, SQLLEN);
+		}
+
+		if (Statement->ColumnCount >= Statement->ColumnCapacity) {
+			Statement->ColumnCapacity = MAX(Statement->ColumnCapacity * 2, 16);
+			Statement->Columns = (DatabaseColumnRef)AllocatorReallocate(Database->Allocator, Statement->Columns, sizeof(struct _DatabaseColumn) * Statement->ColumnCapacity);
+			if (!Statement->Columns) Fatal("Memory allocation failed!");
+		}
+
+		DatabaseColumnRef Column = &Statement->Columns[Statement->ColumnCount];
+		Column->NativeType = DataMapping.NativeType;
+		Column->Length = BufferLength;
+		RowSize += BufferLength + sizeof(SQLLEN);
+		Statement->ColumnCount += 1;
+	}
+
+	// NOTE: The result buffer size bounds the memory of a fetched row block, rows larger than it are fetched one at a time
+	Statement->RowArraySize = (SQLULEN)MAX(1, MIN(Database->ResultBufferSize / MAX(RowSize, 1), DATABASE_MAX_FETCH_ROW_COUNT));
+
+	Int64 MemorySize = 0;
+	for (Int32 ColumnIndex = 0; ColumnIndex < Statement->ColumnCount; ColumnIndex += 1) {
+		DatabaseColumnRef Column = &Statement->Columns[ColumnIndex];
+		Column->DataOffset = MemorySize;
+		MemorySize += Align(Column->Length * Statement->RowArraySize, sizeof(SQLLEN));
+		Column->IndicatorOffset = MemorySize;
+		MemorySize += sizeof(SQLLEN) * Statement->RowArraySize;
+	}
+
+	if (Statement->ColumnMemorySize < MemorySize) {
+		Statement->ColumnMemory = (UInt8*)AllocatorReallocate(Database->Allocator, Statement->ColumnMemory, MemorySize);
+		if (!Statement->ColumnMemory) Fatal("Memory allocation failed!");
+
+		Statement->ColumnMemorySize = MemorySize;
+	}
+
+	SQLRETURN ReturnCode = SQLSetStmtAttr(Statement->Statement, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+	if (SQL_SUCCEEDED(ReturnCode)) ReturnCode = SQLSetStmtAttr(Statement->Statement, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)Statement->RowArraySize, 0);
+	if (SQL_SUCCEEDED(ReturnCode)) ReturnCode = SQLSetStmtAttr(Statement->Statement, SQL_ATTR_ROWS_FETCHED_PTR, &Statement->RowCount, 0);
+	if (!SQL_SUCCEEDED(ReturnCode)) return false;
+
+	Statement->IsBound = true;
+
+	for (Int32 ColumnIndex = 0; ColumnIndex < Statement->ColumnCount; ColumnIndex += 1) {
+		DatabaseColumnRef Column = &Statement->Columns[ColumnIndex];
+		ReturnCode = SQLBindCol(
+			Statement->Statement,
+			ColumnIndex + 1,
+			Column->NativeType,
+			Statement->ColumnMemory + Column->DataOffset,
+			Column->Length,
+			(SQLLEN*)(Statement->ColumnMemory + Column->IndicatorOffset)
+		);
+
+		if (!SQL_SUCCEEDED(ReturnCode)) {
+			Trace("DatabaseHandleReadNext: SQLBindCol failed for column %d with code %d", ColumnIndex + 1, ReturnCode);
+			return false;
+		}
+	}
+
+	Statement->RowCount = 0;
+	Statement->RowIndex = 0;
+	return true;
 }
 
 Bool DatabaseHandleReadNext(
@@ -536,35 +784,46 @@ Bool DatabaseHandleReadNext(
 ) {
 	if (!Handle) return false;
 
-	SQLHSTMT Statement;
-	SQLRETURN ReturnCode;
-
-entry:
-	Trace("DatabaseHandleReadNext: Fetching next row...");
-
-	Statement = (SQLHSTMT)Handle;
-	ReturnCode = SQLFetch(Statement);
-	if (ReturnCode == SQL_NO_DATA) {
-		Trace("DatabaseHandleReadNext: No more data available.");
-		SQLFreeHandle(SQL_HANDLE_STMT, Statement);
+	DatabaseStatementRef Statement = (DatabaseStatementRef)Handle;
+	if (!Statement->Statement) {
+		Trace("DatabaseHandleReadNext: Result set has been lost by a reconnect.");
+		DatabaseStatementRelease(Database, Statement);
 		return false;
 	}
-	else if (!SQL_SUCCEEDED(ReturnCode)) {
-		if (HandleDatabaseError(SQL_HANDLE_STMT, Statement)) {
-			if (DatabaseReconnect(Database)) {
-				SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-				goto entry;
-			}
+
+	va_list Arguments;
+	if (!Statement->IsBound) {
+		va_start(Arguments, Handle);
+		Bool Success = DatabaseStatementBindColumns(Database, Statement, Arguments);
+		va_end(Arguments);
+
+		if (!Success) {
+			DatabaseStatementHandleError(Database, Statement, false);
+			return false;
 		}
+	}
 
-		SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-		return false;
+	if (Statement->RowIndex >= Statement->RowCount) {
+		Trace("DatabaseHandleReadNext: Fetching next row block...");
+
+		Statement->RowCount = 0;
+		Statement->RowIndex = 0;
+
+		SQLRETURN ReturnCode = SQLFetch(Statement->Statement);
+		if (ReturnCode == SQL_NO_DATA || (SQL_SUCCEEDED(ReturnCode) && Statement->RowCount < 1)) {
+			Trace("DatabaseHandleReadNext: No more data available.");
+			DatabaseStatementRelease(Database, Statement);
+			return false;
+		}
+		else if (!SQL_SUCCEEDED(ReturnCode)) {
+			DatabaseStatementHandleError(Database, Statement, false);
+			return false;
+		}
 	}
 
-	va_list Arguments;
 	va_start(Arguments, Handle);
 
-	Int32 ColumnIndex = 1;
+	Int32 ColumnIndex = 0;
 	while (true) {
 		Int32 DataType = va_arg(Arguments, Int32);
 		if (DataType == DB_PARAM_END) break;
@@ -578,28 +837,28 @@ entry:
 			BufferLength = va_arg(Arguments, SQLLEN);
 		}
 
-		Trace("DatabaseHandleReadNext: Fetching column %d with data type %d, buffer size %lld", ColumnIndex, DataType, BufferLength);
-		ReturnCode = SQLGetData(Statement, ColumnIndex++, DataMapping.NativeType, Buffer, BufferLength, NULL);
-		if (!SQL_SUCCEEDED(ReturnCode)) {
-			va_end(Arguments);
-
-			Trace("DatabaseHandleReadNext: SQLGetData failed for column %d with code %d", ColumnIndex - 1, ReturnCode);
-			
-			if (HandleDatabaseError(SQL_HANDLE_STMT, Statement)) {
-				if (DatabaseReconnect(Database)) {
-					SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-					goto entry;
-				}
-			}
+		assert(ColumnIndex < Statement->ColumnCount);
+		DatabaseColumnRef Column = &Statement->Columns[ColumnIndex];
+		UInt8* Source = Statement->ColumnMemory + Column->DataOffset + Column->Length * Statement->RowIndex;
+		SQLLEN Indicator = ((SQLLEN*)(Statement->ColumnMemory + Column->IndicatorOffset))[Statement->RowIndex];
+		SQLLEN CopyLength = MIN(BufferLength, Column->Length);
+		ColumnIndex += 1;
 
-			SQLFreeHandle(SQL_HANDLE_STMT, Statement);
-			return false;
+		if (Indicator == SQL_NULL_DATA) {
+			memset(Buffer, 0, BufferLength);
+			continue;
+		}
+
+		if (Indicator != SQL_NO_TOTAL) {
+			if (Column->NativeType == SQL_C_CHAR) CopyLength = MIN(CopyLength, Indicator + 1);
+			if (Column->NativeType == SQL_C_BINARY) CopyLength = MIN(CopyLength, Indicator);
 		}
 
-		Trace("DatabaseHandleReadNext: Successfully fetched data for column %d", ColumnIndex - 1);
+		memcpy(Buffer, Source, CopyLength);
 	}
 
 	va_end(Arguments);
+	Statement->RowIndex += 1;
 	Trace("DatabaseHandleReadNext: Row successfully read.");
 	return true;
 }
@@ -609,7 +868,7 @@ Void DatabaseHandleFlush(
 	DatabaseHandleRef Handle
 ) {
 	if (!Handle) return;
-	SQLFreeHandle(SQL_HANDLE_STMT, (SQLHSTMT)Handle); // Is crashing after reconnect to db
+	DatabaseStatementRelease(Database, (DatabaseStatementRef)Handle);
 }
 
 Bool DatabaseCallProcedure(
@@ -619,12 +878,15 @@ Bool DatabaseCallProcedure(
 ) {
 	Trace("Call Procedure: %s", Procedure);
 
+	Timestamp CallTimestamp = PlatformGetTickCountUs();
 	va_list Arguments;
 	va_start(Arguments, Procedure);
-	DatabaseHandleRef Handle = DatabaseCallProcedureFetchInternal(Database, Procedure, Arguments);
+	DatabaseStatementRef Statement = DatabaseCallProcedureFetchInternal(Database, Procedure, Arguments);
 	va_end(Arguments);
+	MetricsHistogramRecord("database_procedure_duration_us", PlatformGetTickCountUs() - CallTimestamp);
+	if (!Statement) MetricsCounterAdd("database_procedure_failures", 1);
 
-	if (!Handle) return false;
-	SQLFreeHandle(SQL_HANDLE_STMT, (SQLHSTMT)Handle);
+	if (!Statement) return false;
+	DatabaseStatementRelease(Database, Statement);
 	return true;
 }
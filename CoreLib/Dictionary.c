@@ -134,6 +134,27 @@ Int32 _IndexDictionaryKeySizeCallback(
     return sizeof(Int);
 }
 
+Bool _UInt64DictionaryKeyComparator(
+    Void* Lhs,
+    Void* Rhs
+) {
+    return (*(UInt64*)Lhs) == (*(UInt64*)Rhs);
+}
+
+UInt64 _UInt64DictionaryKeyHasher(
+    Void* Key
+) {
+    // NOTE: Mix the upper half into the lower bits, the bucket index is only taken modulo the capacity
+    UInt64 Hash = (*(UInt64*)Key) * 0x9E3779B97F4A7C15ULL;
+    return Hash ^ (Hash >> 32);
+}
+
+Int32 _UInt64DictionaryKeySizeCallback(
+    Void* Key
+) {
+    return sizeof(UInt64);
+}
+
 DictionaryRef DictionaryCreate(
     AllocatorRef Allocator,
     DictionaryKeyComparator Comparator,
@@ -184,6 +205,19 @@ DictionaryRef IndexDictionaryCreate(
     );
 }
 
+DictionaryRef UInt64DictionaryCreate(
+    AllocatorRef Allocator,
+    Int Capacity
+) {
+    return DictionaryCreate(
+        Allocator,
+        &_UInt64DictionaryKeyComparator,
+        &_UInt64DictionaryKeyHasher,
+        &_UInt64DictionaryKeySizeCallback,
+        Capacity
+    );
+}
+
 Void DictionaryDestroy(
     DictionaryRef Dictionary
 ) {
@@ -379,6 +413,11 @@ DictionaryKeyIterator DictionaryKeyIteratorNext(
             &Iterator.Dictionary->KeyBuffer,
             Iterator.Bucket->KeyOffset
         );
+        Iterator.Value = _DictionaryBufferGetElement(
+            Iterator.Dictionary,
+            &Iterator.Dictionary->ElementBuffer,
+            Iterator.Bucket->ElementOffset
+        );
 
         return Iterator;
     }
@@ -397,10 +436,16 @@ DictionaryKeyIterator DictionaryKeyIteratorNext(
                 &Iterator.Dictionary->KeyBuffer,
                 Iterator.Bucket->KeyOffset
             );
+            Iterator.Value = _DictionaryBufferGetElement(
+                Iterator.Dictionary,
+                &Iterator.Dictionary->ElementBuffer,
+                Iterator.Bucket->ElementOffset
+            );
             return Iterator;
         }
     }
 
     Iterator.Key = NULL;
+    Iterator.Value = NULL;
     return Iterator;
 }
@@ -47,6 +47,12 @@ DictionaryRef IndexDictionaryCreate(
     Int Capacity
 );
 
+// NOTE: Keys are UInt64 values, composite keys can be packed into them independent of the size of Int
+DictionaryRef UInt64DictionaryCreate(
+    AllocatorRef Allocator,
+    Int Capacity
+);
+
 Void DictionaryDestroy(
     DictionaryRef Dictionary
 );
@@ -51,6 +51,18 @@ Bool FileExists(
 	CString FilePath
 );
 
+// NOTE: Maps the whole file read-only, pages are loaded on first access
+Bool FileMap(
+	CString FilePath,
+	UInt8** Memory,
+	Int64* Length
+);
+
+Void FileUnmap(
+	UInt8* Memory,
+	Int64 Length
+);
+
 typedef Void (*FilesProcessCallback)(
 	CString FileName,
 	FileRef File,
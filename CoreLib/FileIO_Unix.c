@@ -10,6 +10,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <assert.h>
 #include <dirent.h>
 #include <errno.h>
@@ -145,6 +146,43 @@ Bool FileExists(
     return (stat(FilePath, &Buffer) == 0);
 }
 
+Bool FileMap(
+    CString FilePath,
+    UInt8** Memory,
+    Int64* Length
+) {
+    *Memory = NULL;
+    *Length = 0;
+
+    Int32 FileDescriptor = open(FilePath, O_RDONLY);
+    if (FileDescriptor == -1) return false;
+
+    struct stat FileStat;
+    if (fstat(FileDescriptor, &FileStat) == -1 || FileStat.st_size < 1) {
+        close(FileDescriptor);
+        return false;
+    }
+
+    Void* Mapping = mmap(NULL, FileStat.st_size, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+    close(FileDescriptor);
+
+    if (Mapping == MAP_FAILED) {
+        Error("Error mapping file '%s'!", FilePath);
+        return false;
+    }
+
+    *Memory = (UInt8*)Mapping;
+    *Length = (Int64)FileStat.st_size;
+    return true;
+}
+
+Void FileUnmap(
+    UInt8* Memory,
+    Int64 Length
+) {
+    if (Memory) munmap(Memory, Length);
+}
+
 Int32 FilesProcess(
     CString Directory,
     CString Pattern,
@@ -183,6 +183,58 @@ Bool FileExists(
     return false;
 }
 
+Bool FileMap(
+    CString FilePath,
+    UInt8** Memory,
+    Int64* Length
+) {
+    *Memory = NULL;
+    *Length = 0;
+
+    HANDLE Handle = CreateFileA(
+        FilePath,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        NULL
+    );
+    if (Handle == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER FileSize = { 0 };
+    if (!GetFileSizeEx(Handle, &FileSize) || FileSize.QuadPart < 1) {
+        CloseHandle(Handle);
+        return false;
+    }
+
+    HANDLE Mapping = CreateFileMappingA(Handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(Handle);
+    if (!Mapping) {
+        Error("Error mapping file '%s'!", FilePath);
+        return false;
+    }
+
+    // NOTE: The view keeps the mapping alive after its handle is closed
+    Void* View = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(Mapping);
+    if (!View) {
+        Error("Error mapping file '%s'!", FilePath);
+        return false;
+    }
+
+    *Memory = (UInt8*)View;
+    *Length = FileSize.QuadPart;
+    return true;
+}
+
+Void FileUnmap(
+    UInt8* Memory,
+    Int64 Length
+) {
+    if (Memory) UnmapViewOfFile(Memory);
+}
+
 Int32 FilesProcess(
     CString Directory,
     CString Pattern,
@@ -0,0 +1,222 @@
+#include "Allocator.h"
+#include "Diagnostic.h"
+#include "Metrics.h"
+#include "String.h"
+#include "Util.h"
+
+struct _MetricHistogram {
+    UInt64 Count;
+    Int64 Sum;
+    Int64 Max;
+    UInt64 Buckets[METRICS_HISTOGRAM_BUCKET_COUNT];
+};
+typedef struct _MetricHistogram* MetricHistogramRef;
+
+struct _Metric {
+    Int32 Type;
+    Char Name[METRICS_MAX_NAME_LENGTH];
+    Int64 Value;
+    MetricHistogramRef Histogram;
+};
+
+struct _MetricsRegistry {
+    Int32 MetricCount;
+    struct _Metric Metrics[METRICS_MAX_METRIC_COUNT];
+};
+
+static struct _MetricsRegistry kMetricsRegistry;
+
+static MetricRef MetricsGetOrCreate(
+    CString Name,
+    Int32 Type
+) {
+    for (Int32 Index = 0; Index < kMetricsRegistry.MetricCount; Index += 1) {
+        MetricRef Metric = &kMetricsRegistry.Metrics[Index];
+        if (!CStringIsEqual(Metric->Name, Name)) continue;
+
+        assert(Metric->Type == Type);
+        return Metric;
+    }
+
+    if (kMetricsRegistry.MetricCount >= METRICS_MAX_METRIC_COUNT) Fatal("Metrics registry is full!");
+
+    MetricRef Metric = &kMetricsRegistry.Metrics[kMetricsRegistry.MetricCount];
+    memset(Metric, 0, sizeof(struct _Metric));
+    Metric->Type = Type;
+    CStringCopySafe(Metric->Name, METRICS_MAX_NAME_LENGTH, Name);
+
+    if (Type == METRIC_TYPE_HISTOGRAM) {
+        Metric->Histogram = (MetricHistogramRef)AllocatorAllocate(AllocatorGetSystemDefault(), sizeof(struct _MetricHistogram));
+        if (!Metric->Histogram) Fatal("Memory allocation failed!");
+
+        memset(Metric->Histogram, 0, sizeof(struct _MetricHistogram));
+    }
+
+    kMetricsRegistry.MetricCount += 1;
+    return Metric;
+}
+
+static inline Int32 MetricHistogramGetBucketIndex(
+    UInt64 Value
+) {
+    if (Value < METRICS_HISTOGRAM_SUB_BUCKET_COUNT) return (Int32)Value;
+
+    Int32 Exponent = 63 - CountLeadingZeros64(Value);
+    Int32 SubBucket = (Int32)((Value >> (Exponent - METRICS_HISTOGRAM_SUB_BUCKET_BITS)) & (METRICS_HISTOGRAM_SUB_BUCKET_COUNT - 1));
+    return (Exponent - METRICS_HISTOGRAM_SUB_BUCKET_BITS + 1) * METRICS_HISTOGRAM_SUB_BUCKET_COUNT + SubBucket;
+}
+
+static inline UInt64 MetricHistogramGetBucketValue(
+    Int32 BucketIndex
+) {
+    if (BucketIndex < METRICS_HISTOGRAM_SUB_BUCKET_COUNT) return (UInt64)BucketIndex;
+
+    Int32 Shift = BucketIndex / METRICS_HISTOGRAM_SUB_BUCKET_COUNT - 1;
+    UInt64 SubBucket = (UInt64)(BucketIndex % METRICS_HISTOGRAM_SUB_BUCKET_COUNT);
+    UInt64 Lower = (METRICS_HISTOGRAM_SUB_BUCKET_COUNT + SubBucket) << Shift;
+    UInt64 Width = (UInt64)1 << Shift;
+
+    // NOTE: Report the midpoint of the bucket to halve the worst case error
+    return Lower + Width / 2;
+}
+
+MetricRef MetricsGetCounter(
+    CString Name
+) {
+    return MetricsGetOrCreate(Name, METRIC_TYPE_COUNTER);
+}
+
+MetricRef MetricsGetGauge(
+    CString Name
+) {
+    return MetricsGetOrCreate(Name, METRIC_TYPE_GAUGE);
+}
+
+MetricRef MetricsGetHistogram(
+    CString Name
+) {
+    return MetricsGetOrCreate(Name, METRIC_TYPE_HISTOGRAM);
+}
+
+Void MetricAdd(
+    MetricRef Metric,
+    Int64 Value
+) {
+    assert(Metric->Type != METRIC_TYPE_HISTOGRAM);
+    Metric->Value += Value;
+}
+
+Void MetricSet(
+    MetricRef Metric,
+    Int64 Value
+) {
+    assert(Metric->Type == METRIC_TYPE_GAUGE);
+    Metric->Value = Value;
+}
+
+Void MetricRecord(
+    MetricRef Metric,
+    Int64 Value
+) {
+    assert(Metric->Type == METRIC_TYPE_HISTOGRAM);
+
+    MetricHistogramRef Histogram = Metric->Histogram;
+    Value = MAX(Value, 0);
+    Histogram->Count += 1;
+    Histogram->Sum += Value;
+    Histogram->Max = MAX(Histogram->Max, Value);
+    Histogram->Buckets[MetricHistogramGetBucketIndex((UInt64)Value)] += 1;
+}
+
+Int64 MetricGetValue(
+    MetricRef Metric
+) {
+    if (Metric->Type == METRIC_TYPE_HISTOGRAM) return (Int64)Metric->Histogram->Count;
+
+    return Metric->Value;
+}
+
+Int64 MetricGetPercentile(
+    MetricRef Metric,
+    Float64 Percentile
+) {
+    assert(Metric->Type == METRIC_TYPE_HISTOGRAM);
+
+    MetricHistogramRef Histogram = Metric->Histogram;
+    if (Histogram->Count < 1) return 0;
+
+    UInt64 Rank = (UInt64)(Percentile * (Float64)Histogram->Count + 0.5);
+    Rank = MAX(1, MIN(Rank, Histogram->Count));
+
+    UInt64 Count = 0;
+    for (Int32 Index = 0; Index < METRICS_HISTOGRAM_BUCKET_COUNT; Index += 1) {
+        Count += Histogram->Buckets[Index];
+        if (Count < Rank) continue;
+
+        return MIN((Int64)MetricHistogramGetBucketValue(Index), Histogram->Max);
+    }
+
+    return Histogram->Max;
+}
+
+Bool MetricsAppendText(
+    CString Buffer,
+    Int32 Length,
+    Int32* Offset,
+    CString Format,
+    ...
+) {
+    if (*Offset >= Length) return false;
+
+    va_list Arguments;
+    va_start(Arguments, Format);
+    Int32 Result = vsnprintf(Buffer + *Offset, Length - *Offset, Format, Arguments);
+    va_end(Arguments);
+
+    if (Result < 0 || Result >= Length - *Offset) {
+        *Offset = Length;
+        return false;
+    }
+
+    *Offset += Result;
+    return true;
+}
+
+Int32 MetricsWriteText(
+    CString Buffer,
+    Int32 Length
+) {
+    static const Float64 kPercentiles[] = { 0.5, 0.9, 0.99 };
+
+    Int32 Offset = 0;
+    for (Int32 Index = 0; Index < kMetricsRegistry.MetricCount; Index += 1) {
+        MetricRef Metric = &kMetricsRegistry.Metrics[Index];
+
+        if (Metric->Type == METRIC_TYPE_COUNTER) {
+            MetricsAppendText(Buffer, Length, &Offset, "# TYPE %s counter\n%s %lld\n", Metric->Name, Metric->Name, (long long)Metric->Value);
+        }
+        else if (Metric->Type == METRIC_TYPE_GAUGE) {
+            MetricsAppendText(Buffer, Length, &Offset, "# TYPE %s gauge\n%s %lld\n", Metric->Name, Metric->Name, (long long)Metric->Value);
+        }
+        else {
+            MetricHistogramRef Histogram = Metric->Histogram;
+            MetricsAppendText(Buffer, Length, &Offset, "# TYPE %s summary\n", Metric->Name);
+
+            for (Int32 PercentileIndex = 0; PercentileIndex < sizeof(kPercentiles) / sizeof(kPercentiles[0]); PercentileIndex += 1) {
+                MetricsAppendText(
+                    Buffer, Length, &Offset,
+                    "%s{quantile=\"%g\"} %lld\n",
+                    Metric->Name,
+                    kPercentiles[PercentileIndex],
+                    (long long)MetricGetPercentile(Metric, kPercentiles[PercentileIndex])
+                );
+            }
+
+            MetricsAppendText(Buffer, Length, &Offset, "%s_max %lld\n", Metric->Name, (long long)Histogram->Max);
+            MetricsAppendText(Buffer, Length, &Offset, "%s_sum %lld\n", Metric->Name, (long long)Histogram->Sum);
+            MetricsAppendText(Buffer, Length, &Offset, "%s_count %llu\n", Metric->Name, (unsigned long long)Histogram->Count);
+        }
+    }
+
+    return MIN(Offset, Length);
+}
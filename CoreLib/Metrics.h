@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Base.h"
+
+EXTERN_C_BEGIN
+
+#define METRICS_MAX_METRIC_COUNT            128
+#define METRICS_MAX_NAME_LENGTH             64
+#define METRICS_HISTOGRAM_SUB_BUCKET_BITS   3
+#define METRICS_HISTOGRAM_SUB_BUCKET_COUNT  (1 << METRICS_HISTOGRAM_SUB_BUCKET_BITS)
+#define METRICS_HISTOGRAM_BUCKET_COUNT      ((64 - METRICS_HISTOGRAM_SUB_BUCKET_BITS + 1) * METRICS_HISTOGRAM_SUB_BUCKET_COUNT)
+
+enum {
+    METRIC_TYPE_COUNTER,
+    METRIC_TYPE_GAUGE,
+    METRIC_TYPE_HISTOGRAM,
+};
+
+typedef struct _Metric* MetricRef;
+
+// NOTE: Metrics live in a process wide registry and are never released, lookups are linear so call sites should cache the reference
+MetricRef MetricsGetCounter(
+    CString Name
+);
+
+MetricRef MetricsGetGauge(
+    CString Name
+);
+
+MetricRef MetricsGetHistogram(
+    CString Name
+);
+
+Void MetricAdd(
+    MetricRef Metric,
+    Int64 Value
+);
+
+Void MetricSet(
+    MetricRef Metric,
+    Int64 Value
+);
+
+// NOTE: Histogram values are bucketed log-linear with a relative error below 1 / METRICS_HISTOGRAM_SUB_BUCKET_COUNT
+Void MetricRecord(
+    MetricRef Metric,
+    Int64 Value
+);
+
+Int64 MetricGetValue(
+    MetricRef Metric
+);
+
+Int64 MetricGetPercentile(
+    MetricRef Metric,
+    Float64 Percentile
+);
+
+Int32 MetricsWriteText(
+    CString Buffer,
+    Int32 Length
+);
+
+// NOTE: Appends formatted text at Offset, on truncation Offset is set to Length and every following append fails
+Bool MetricsAppendText(
+    CString Buffer,
+    Int32 Length,
+    Int32* Offset,
+    CString Format,
+    ...
+);
+
+#define MetricsCounterAdd(__NAME__, __VALUE__)                          \
+do {                                                                    \
+    static MetricRef __Metric = NULL;                                   \
+    if (!__Metric) __Metric = MetricsGetCounter(__NAME__);              \
+    MetricAdd(__Metric, (Int64)(__VALUE__));                            \
+} while (0)
+
+#define MetricsGaugeSet(__NAME__, __VALUE__)                            \
+do {                                                                    \
+    static MetricRef __Metric = NULL;                                   \
+    if (!__Metric) __Metric = MetricsGetGauge(__NAME__);                \
+    MetricSet(__Metric, (Int64)(__VALUE__));                            \
+} while (0)
+
+#define MetricsHistogramRecord(__NAME__, __VALUE__)                     \
+do {                                                                    \
+    static MetricRef __Metric = NULL;                                   \
+    if (!__Metric) __Metric = MetricsGetHistogram(__NAME__);            \
+    MetricRecord(__Metric, (Int64)(__VALUE__));                         \
+} while (0)
+
+EXTERN_C_END
@@ -0,0 +1,119 @@
+#include "Metrics.h"
+#include "SparseEncoding.h"
+
+static Int64 SparseReadCount(
+    UInt8* Memory,
+    Int32 Size
+) {
+    switch (Size) {
+    case 1: return *(Int8*)Memory;
+    case 2: return *(Int16*)Memory;
+    case 4: return *(Int32*)Memory;
+    case 8: return *(Int64*)Memory;
+    default: return 0;
+    }
+}
+
+static Int32 SparseGetUsedElementCount(
+    SparseFieldRef Field,
+    UInt8* Memory
+) {
+    Int32 ElementCount = Field->ElementCount;
+    while (ElementCount > 0) {
+        UInt8* Element = Memory + (ElementCount - 1) * Field->ElementSize;
+        Bool IsZero = true;
+        for (Int32 Index = 0; Index < Field->ElementSize; Index += 1) {
+            if (Element[Index]) {
+                IsZero = false;
+                break;
+            }
+        }
+
+        if (!IsZero) break;
+
+        ElementCount -= 1;
+    }
+
+    return ElementCount;
+}
+
+Int32 SparseGetMaxEncodedLength(
+    SparseSchemaRef Schema
+) {
+    return Schema->Size + Schema->FieldCount * sizeof(UInt16);
+}
+
+Int32 SparseEncode(
+    SparseSchemaRef Schema,
+    Void* Source,
+    UInt8* Destination,
+    Int32 DestinationLength
+) {
+    Int32 Offset = 0;
+    for (Int32 FieldIndex = 0; FieldIndex < Schema->FieldCount; FieldIndex += 1) {
+        SparseFieldRef Field = &Schema->Fields[FieldIndex];
+        UInt8* Memory = (UInt8*)Source + Field->Offset;
+        Int32 ElementCount = Field->ElementCount;
+
+        if (Field->Type == SPARSE_FIELD_TYPE_COUNTED_ARRAY) {
+            Int64 Count = SparseReadCount((UInt8*)Source + Field->CountOffset, Field->CountSize);
+            ElementCount = (Int32)MAX(0, MIN(Count, Field->ElementCount));
+        }
+
+        if (Field->Type == SPARSE_FIELD_TYPE_ARRAY) {
+            ElementCount = SparseGetUsedElementCount(Field, Memory);
+            if (Offset + (Int32)sizeof(UInt16) > DestinationLength) return -1;
+
+            *(UInt16*)(Destination + Offset) = (UInt16)ElementCount;
+            Offset += sizeof(UInt16);
+        }
+
+        Int32 Length = ElementCount * Field->ElementSize;
+        if (Offset + Length > DestinationLength) return -1;
+
+        memcpy(Destination + Offset, Memory, Length);
+        Offset += Length;
+    }
+
+    MetricsCounterAdd("sparse_bytes_raw", Schema->Size);
+    MetricsCounterAdd("sparse_bytes_encoded", Offset);
+    return Offset;
+}
+
+Bool SparseDecode(
+    SparseSchemaRef Schema,
+    UInt8* Source,
+    Int32 SourceLength,
+    Void* Destination
+) {
+    memset(Destination, 0, Schema->Size);
+
+    Int32 Offset = 0;
+    for (Int32 FieldIndex = 0; FieldIndex < Schema->FieldCount; FieldIndex += 1) {
+        SparseFieldRef Field = &Schema->Fields[FieldIndex];
+        Int32 ElementCount = Field->ElementCount;
+
+        if (Field->Type == SPARSE_FIELD_TYPE_COUNTED_ARRAY) {
+            Int64 Count = SparseReadCount((UInt8*)Destination + Field->CountOffset, Field->CountSize);
+            if (Count < 0 || Count > Field->ElementCount) return false;
+
+            ElementCount = (Int32)Count;
+        }
+
+        if (Field->Type == SPARSE_FIELD_TYPE_ARRAY) {
+            if (Offset + (Int32)sizeof(UInt16) > SourceLength) return false;
+
+            ElementCount = *(UInt16*)(Source + Offset);
+            Offset += sizeof(UInt16);
+            if (ElementCount > Field->ElementCount) return false;
+        }
+
+        Int32 Length = ElementCount * Field->ElementSize;
+        if (Offset + Length > SourceLength) return false;
+
+        memcpy((UInt8*)Destination + Field->Offset, Source + Offset, Length);
+        Offset += Length;
+    }
+
+    return Offset == SourceLength;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Base.h"
+
+EXTERN_C_BEGIN
+
+enum {
+    SPARSE_FIELD_TYPE_SCALAR,
+    SPARSE_FIELD_TYPE_COUNTED_ARRAY,
+    SPARSE_FIELD_TYPE_ARRAY,
+};
+
+struct _SparseField {
+    Int32 Type;
+    Int32 Offset;
+    Int32 ElementSize;
+    Int32 ElementCount;
+    Int32 CountOffset;
+    Int32 CountSize;
+};
+typedef const struct _SparseField* SparseFieldRef;
+
+struct _SparseSchema {
+    CString Name;
+    Int32 Size;
+    Int32 FieldCount;
+    SparseFieldRef Fields;
+};
+typedef const struct _SparseSchema* SparseSchemaRef;
+
+// NOTE: Struct definitions are written as a field list X-macro which is expanded once with the SPARSE_STRUCT_* macros
+//       into the struct itself and once with the SPARSE_SCHEMA_* macros into the schema of SPARSE_SCHEMA_STRUCT,
+//       the count of a counted array has to be a field declared before the array itself
+#define SPARSE_STRUCT_FIELD(__TYPE__, __NAME__) \
+    __TYPE__ __NAME__;
+
+#define SPARSE_STRUCT_COUNTED_ARRAY(__TYPE__, __NAME__, __COUNT__, __COUNT_NAME__) \
+    __TYPE__ __NAME__[__COUNT__];
+
+#define SPARSE_STRUCT_ARRAY(__TYPE__, __NAME__, __COUNT__) \
+    __TYPE__ __NAME__[__COUNT__];
+
+#define SPARSE_SCHEMA_FIELD(__TYPE__, __NAME__) \
+    { \
+        SPARSE_FIELD_TYPE_SCALAR, \
+        (Int32)offsetof(SPARSE_SCHEMA_STRUCT, __NAME__), \
+        (Int32)sizeof(__TYPE__), \
+        1, \
+        0, \
+        0 \
+    },
+
+#define SPARSE_SCHEMA_COUNTED_ARRAY(__TYPE__, __NAME__, __COUNT__, __COUNT_NAME__) \
+    { \
+        SPARSE_FIELD_TYPE_COUNTED_ARRAY, \
+        (Int32)offsetof(SPARSE_SCHEMA_STRUCT, __NAME__), \
+        (Int32)sizeof(__TYPE__), \
+        (Int32)(__COUNT__), \
+        (Int32)offsetof(SPARSE_SCHEMA_STRUCT, __COUNT_NAME__), \
+        (Int32)sizeof(((SPARSE_SCHEMA_STRUCT*)0)->__COUNT_NAME__) \
+    },
+
+#define SPARSE_SCHEMA_ARRAY(__TYPE__, __NAME__, __COUNT__) \
+    { \
+        SPARSE_FIELD_TYPE_ARRAY, \
+        (Int32)offsetof(SPARSE_SCHEMA_STRUCT, __NAME__), \
+        (Int32)sizeof(__TYPE__), \
+        (Int32)(__COUNT__), \
+        0, \
+        0 \
+    },
+
+Int32 SparseGetMaxEncodedLength(
+    SparseSchemaRef Schema
+);
+
+// NOTE: Returns the encoded length or -1 if the destination is too small
+Int32 SparseEncode(
+    SparseSchemaRef Schema,
+    Void* Source,
+    UInt8* Destination,
+    Int32 DestinationLength
+);
+
+// NOTE: Everything not present in the source is zero in the destination, a malformed source fails without reading out of bounds
+Bool SparseDecode(
+    SparseSchemaRef Schema,
+    UInt8* Source,
+    Int32 SourceLength,
+    Void* Destination
+);
+
+EXTERN_C_END
@@ -0,0 +1,257 @@
+#include "Diagnostic.h"
+#include "TimerWheel.h"
+
+#define TIMER_WHEEL_LEVEL_COUNT 4
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOT_COUNT (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_SLOT_MASK (TIMER_WHEEL_SLOT_COUNT - 1)
+#define TIMER_WHEEL_MAX_DELTA ((UInt64)1 << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVEL_COUNT))
+
+struct _TimerWheelNode {
+    UInt64 DeadlineTick;
+    UInt64 Key;
+    UInt32 Generation;
+    Int32 Type;
+    Int32 SlotIndex;
+    Int32 Previous;
+    Int32 Next;
+};
+typedef struct _TimerWheelNode *TimerWheelNodeRef;
+
+struct _TimerWheel {
+    AllocatorRef Allocator;
+    Timestamp Resolution;
+    UInt64 CurrentTick;
+    Int Capacity;
+    Int TimerCount;
+    Int32 FreeIndex;
+    TimerWheelNodeRef Nodes;
+    Int32 Slots[TIMER_WHEEL_LEVEL_COUNT * TIMER_WHEEL_SLOT_COUNT];
+};
+
+static inline TimerID TimerWheelMakeID(
+    Int32 NodeIndex,
+    UInt32 Generation
+) {
+    return ((UInt64)Generation << 32) | (UInt32)(NodeIndex + 1);
+}
+
+static Void TimerWheelReserveCapacity(
+    TimerWheelRef TimerWheel,
+    Int Capacity
+) {
+    if (TimerWheel->Capacity >= Capacity) return;
+
+    Int NewCapacity = MAX(TimerWheel->Capacity, 8);
+    while (NewCapacity < Capacity) NewCapacity <<= 1;
+
+    TimerWheel->Nodes = (TimerWheelNodeRef)AllocatorReallocate(TimerWheel->Allocator, TimerWheel->Nodes, sizeof(struct _TimerWheelNode) * NewCapacity);
+    if (!TimerWheel->Nodes) Fatal("Memory allocation failed!");
+
+    for (Int Index = NewCapacity - 1; Index >= TimerWheel->Capacity; Index -= 1) {
+        TimerWheelNodeRef Node = &TimerWheel->Nodes[Index];
+        Node->Generation = 1;
+        Node->SlotIndex = -1;
+        Node->Previous = -1;
+        Node->Next = TimerWheel->FreeIndex;
+        TimerWheel->FreeIndex = (Int32)Index;
+    }
+
+    TimerWheel->Capacity = NewCapacity;
+}
+
+static Void TimerWheelLink(
+    TimerWheelRef TimerWheel,
+    Int32 NodeIndex
+) {
+    TimerWheelNodeRef Node = &TimerWheel->Nodes[NodeIndex];
+    UInt64 Delta = (Node->DeadlineTick > TimerWheel->CurrentTick) ? Node->DeadlineTick - TimerWheel->CurrentTick : 0;
+    UInt64 SlotTick = Node->DeadlineTick;
+    Int32 Level = 0;
+
+    // NOTE: Timers beyond the range of the wheel are parked in the last slot of the top level and linked again when it cascades
+    if (Delta >= TIMER_WHEEL_MAX_DELTA) {
+        Level = TIMER_WHEEL_LEVEL_COUNT - 1;
+        SlotTick = TimerWheel->CurrentTick + TIMER_WHEEL_MAX_DELTA - 1;
+    }
+    else {
+        while (Delta >= ((UInt64)1 << (TIMER_WHEEL_SLOT_BITS * (Level + 1)))) {
+            Level += 1;
+        }
+    }
+
+    Int32 SlotIndex = Level * TIMER_WHEEL_SLOT_COUNT + (Int32)((SlotTick >> (TIMER_WHEEL_SLOT_BITS * Level)) & TIMER_WHEEL_SLOT_MASK);
+    Node->SlotIndex = SlotIndex;
+    Node->Previous = -1;
+    Node->Next = TimerWheel->Slots[SlotIndex];
+    if (Node->Next >= 0) TimerWheel->Nodes[Node->Next].Previous = NodeIndex;
+    TimerWheel->Slots[SlotIndex] = NodeIndex;
+}
+
+static Void TimerWheelUnlink(
+    TimerWheelRef TimerWheel,
+    Int32 NodeIndex
+) {
+    TimerWheelNodeRef Node = &TimerWheel->Nodes[NodeIndex];
+    assert(Node->SlotIndex >= 0);
+
+    if (Node->Previous >= 0) TimerWheel->Nodes[Node->Previous].Next = Node->Next;
+    else TimerWheel->Slots[Node->SlotIndex] = Node->Next;
+
+    if (Node->Next >= 0) TimerWheel->Nodes[Node->Next].Previous = Node->Previous;
+
+    Node->SlotIndex = -1;
+    Node->Previous = -1;
+    Node->Next = -1;
+}
+
+static Void TimerWheelRelease(
+    TimerWheelRef TimerWheel,
+    Int32 NodeIndex
+) {
+    TimerWheelNodeRef Node = &TimerWheel->Nodes[NodeIndex];
+    Node->Generation += 1;
+    if (Node->Generation == 0) Node->Generation = 1;
+    Node->Next = TimerWheel->FreeIndex;
+    TimerWheel->FreeIndex = NodeIndex;
+    TimerWheel->TimerCount -= 1;
+}
+
+static Void TimerWheelCascade(
+    TimerWheelRef TimerWheel,
+    Int32 Level
+) {
+    Int32 SlotIndex = Level * TIMER_WHEEL_SLOT_COUNT + (Int32)((TimerWheel->CurrentTick >> (TIMER_WHEEL_SLOT_BITS * Level)) & TIMER_WHEEL_SLOT_MASK);
+    Int32 NodeIndex = TimerWheel->Slots[SlotIndex];
+    TimerWheel->Slots[SlotIndex] = -1;
+
+    while (NodeIndex >= 0) {
+        Int32 NextIndex = TimerWheel->Nodes[NodeIndex].Next;
+        TimerWheelLink(TimerWheel, NodeIndex);
+        NodeIndex = NextIndex;
+    }
+}
+
+TimerWheelRef TimerWheelCreate(
+    AllocatorRef Allocator,
+    Timestamp Resolution,
+    Timestamp CurrentTimestamp,
+    Int Capacity
+) {
+    assert(Resolution > 0);
+
+    TimerWheelRef TimerWheel = (TimerWheelRef)AllocatorAllocate(Allocator, sizeof(struct _TimerWheel));
+    if (!TimerWheel) Fatal("Memory allocation failed!");
+
+    TimerWheel->Allocator = Allocator;
+    TimerWheel->Resolution = Resolution;
+    TimerWheel->CurrentTick = CurrentTimestamp / Resolution;
+    TimerWheel->Capacity = 0;
+    TimerWheel->TimerCount = 0;
+    TimerWheel->FreeIndex = -1;
+    TimerWheel->Nodes = NULL;
+    for (Int Index = 0; Index < TIMER_WHEEL_LEVEL_COUNT * TIMER_WHEEL_SLOT_COUNT; Index += 1) {
+        TimerWheel->Slots[Index] = -1;
+    }
+
+    TimerWheelReserveCapacity(TimerWheel, Capacity);
+    return TimerWheel;
+}
+
+Void TimerWheelDestroy(
+    TimerWheelRef TimerWheel
+) {
+    if (TimerWheel->Nodes) AllocatorDeallocate(TimerWheel->Allocator, TimerWheel->Nodes);
+    AllocatorDeallocate(TimerWheel->Allocator, TimerWheel);
+}
+
+Int TimerWheelGetTimerCount(
+    TimerWheelRef TimerWheel
+) {
+    return TimerWheel->TimerCount;
+}
+
+TimerID TimerWheelSchedule(
+    TimerWheelRef TimerWheel,
+    Timestamp Deadline,
+    Int32 Type,
+    UInt64 Key
+) {
+    if (TimerWheel->FreeIndex < 0) {
+        TimerWheelReserveCapacity(TimerWheel, TimerWheel->Capacity + 1);
+    }
+
+    Int32 NodeIndex = TimerWheel->FreeIndex;
+    TimerWheelNodeRef Node = &TimerWheel->Nodes[NodeIndex];
+    TimerWheel->FreeIndex = Node->Next;
+    TimerWheel->TimerCount += 1;
+
+    // NOTE: Round up to never fire a timer before its deadline, due timers are fired on the next update
+    UInt64 DeadlineTick = (Deadline + TimerWheel->Resolution - 1) / TimerWheel->Resolution;
+    Node->DeadlineTick = MAX(DeadlineTick, TimerWheel->CurrentTick + 1);
+    Node->Key = Key;
+    Node->Type = Type;
+    TimerWheelLink(TimerWheel, NodeIndex);
+
+    return TimerWheelMakeID(NodeIndex, Node->Generation);
+}
+
+Bool TimerWheelIsScheduled(
+    TimerWheelRef TimerWheel,
+    TimerID Timer
+) {
+    Int32 NodeIndex = (Int32)(Timer & 0xFFFFFFFF) - 1;
+    if (NodeIndex < 0 || NodeIndex >= TimerWheel->Capacity) return false;
+
+    TimerWheelNodeRef Node = &TimerWheel->Nodes[NodeIndex];
+    return Node->Generation == (UInt32)(Timer >> 32) && Node->SlotIndex >= 0;
+}
+
+Void TimerWheelCancel(
+    TimerWheelRef TimerWheel,
+    TimerID Timer
+) {
+    if (!TimerWheelIsScheduled(TimerWheel, Timer)) return;
+
+    Int32 NodeIndex = (Int32)(Timer & 0xFFFFFFFF) - 1;
+    TimerWheelUnlink(TimerWheel, NodeIndex);
+    TimerWheelRelease(TimerWheel, NodeIndex);
+}
+
+Void TimerWheelUpdate(
+    TimerWheelRef TimerWheel,
+    Timestamp CurrentTimestamp,
+    TimerWheelCallback Callback,
+    Void *Userdata
+) {
+    UInt64 TargetTick = CurrentTimestamp / TimerWheel->Resolution;
+
+    while (TimerWheel->CurrentTick < TargetTick) {
+        TimerWheel->CurrentTick += 1;
+
+        // NOTE: Higher levels have to cascade first to move their timers into the lower slots before those are cascaded
+        Int32 CascadeLevel = 0;
+        while (CascadeLevel + 1 < TIMER_WHEEL_LEVEL_COUNT) {
+            UInt64 Mask = ((UInt64)1 << (TIMER_WHEEL_SLOT_BITS * (CascadeLevel + 1))) - 1;
+            if (TimerWheel->CurrentTick & Mask) break;
+
+            CascadeLevel += 1;
+        }
+
+        for (Int32 Level = CascadeLevel; Level > 0; Level -= 1) {
+            TimerWheelCascade(TimerWheel, Level);
+        }
+
+        Int32 SlotIndex = (Int32)(TimerWheel->CurrentTick & TIMER_WHEEL_SLOT_MASK);
+        while (TimerWheel->Slots[SlotIndex] >= 0) {
+            Int32 NodeIndex = TimerWheel->Slots[SlotIndex];
+            TimerWheelNodeRef Node = &TimerWheel->Nodes[NodeIndex];
+            Int32 Type = Node->Type;
+            UInt64 Key = Node->Key;
+
+            TimerWheelUnlink(TimerWheel, NodeIndex);
+            TimerWheelRelease(TimerWheel, NodeIndex);
+            Callback(TimerWheel, Type, Key, Userdata);
+        }
+    }
+}
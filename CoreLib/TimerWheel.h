@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Base.h"
+
+#include "Allocator.h"
+
+EXTERN_C_BEGIN
+
+typedef struct _TimerWheel *TimerWheelRef;
+
+// NOTE: A timer id is never 0 so it can be used as an unscheduled marker
+typedef UInt64 TimerID;
+
+typedef Void (*TimerWheelCallback)(
+    TimerWheelRef TimerWheel,
+    Int32 Type,
+    UInt64 Key,
+    Void *Userdata
+);
+
+TimerWheelRef TimerWheelCreate(
+    AllocatorRef Allocator,
+    Timestamp Resolution,
+    Timestamp CurrentTimestamp,
+    Int Capacity
+);
+
+Void TimerWheelDestroy(
+    TimerWheelRef TimerWheel
+);
+
+Int TimerWheelGetTimerCount(
+    TimerWheelRef TimerWheel
+);
+
+TimerID TimerWheelSchedule(
+    TimerWheelRef TimerWheel,
+    Timestamp Deadline,
+    Int32 Type,
+    UInt64 Key
+);
+
+Bool TimerWheelIsScheduled(
+    TimerWheelRef TimerWheel,
+    TimerID Timer
+);
+
+Void TimerWheelCancel(
+    TimerWheelRef TimerWheel,
+    TimerID Timer
+);
+
+Void TimerWheelUpdate(
+    TimerWheelRef TimerWheel,
+    Timestamp CurrentTimestamp,
+    TimerWheelCallback Callback,
+    Void *Userdata
+);
+
+EXTERN_C_END
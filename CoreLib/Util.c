@@ -42,6 +42,46 @@ UInt NextPowerOfTwo(UInt Value) {
     return Value;
 }
 
+Int32 CountTrailingZeros64(
+    UInt64 Value
+) {
+    assert(Value);
+#if defined(_MSC_VER) && defined(_WIN64)
+    unsigned long Index = 0;
+    _BitScanForward64(&Index, Value);
+    return (Int32)Index;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(Value);
+#else
+    Int32 Count = 0;
+    while (!(Value & 1)) {
+        Value >>= 1;
+        Count += 1;
+    }
+    return Count;
+#endif
+}
+
+Int32 CountLeadingZeros64(
+    UInt64 Value
+) {
+    assert(Value);
+#if defined(_MSC_VER) && defined(_WIN64)
+    unsigned long Index = 0;
+    _BitScanReverse64(&Index, Value);
+    return 63 - (Int32)Index;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(Value);
+#else
+    Int32 Count = 0;
+    while (!(Value & ((UInt64)1 << 63))) {
+        Value <<= 1;
+        Count += 1;
+    }
+    return Count;
+#endif
+}
+
 Timestamp GetTimestamp() {
 	return (Timestamp)time(NULL);
 }
@@ -362,6 +402,21 @@ Timestamp PlatformGetTickCount() {
 #endif
 }
 
+Timestamp PlatformGetTickCountUs() {
+#ifdef _WIN32
+    LARGE_INTEGER Frequency;
+    LARGE_INTEGER Counter;
+    QueryPerformanceFrequency(&Frequency);
+    QueryPerformanceCounter(&Counter);
+    return (Timestamp)(Counter.QuadPart / Frequency.QuadPart * 1000000 + (Counter.QuadPart % Frequency.QuadPart) * 1000000 / Frequency.QuadPart);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Timestamp)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
 Void PlatformSleep(
     UInt64 Milliseconds
 ) {
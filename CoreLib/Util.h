@@ -35,6 +35,16 @@ UInt NextPowerOfTwo(
     UInt Value
 );
 
+// NOTE: The result is undefined for a value of 0
+Int32 CountTrailingZeros64(
+    UInt64 Value
+);
+
+// NOTE: The result is undefined for a value of 0
+Int32 CountLeadingZeros64(
+    UInt64 Value
+);
+
 Timestamp GetTimestamp();
 
 Timestamp GetTimestampMs();
@@ -151,6 +161,8 @@ Void ReadConfigInt(
 
 Timestamp PlatformGetTickCount();
 
+Timestamp PlatformGetTickCountUs();
+
 Void PlatformSleep(
     UInt64 Milliseconds
 ); 
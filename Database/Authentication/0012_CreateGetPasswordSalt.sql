@@ -0,0 +1,12 @@
+CREATE PROCEDURE GetPasswordSalt(
+    IN InUsername VARCHAR(255),
+    OUT OutSalt VARBINARY(16)
+)
+BEGIN
+    SET OutSalt = NULL;
+
+    SELECT SUBSTRING(PasswordHash, 1, 16)
+    INTO OutSalt
+    FROM Accounts
+    WHERE Username = InUsername;
+END;
\ No newline at end of file
@@ -0,0 +1,13 @@
+CREATE PROCEDURE InsertAccountPasswordHash(
+    IN InUsername VARCHAR(16),
+    IN InEmail VARCHAR(255),
+    IN InPasswordHash VARBINARY(80)
+)
+BEGIN
+    INSERT INTO Accounts (
+        Username, Email, PasswordHash, CreatedAt, UpdatedAt
+    )
+    VALUES (
+        InUsername, InEmail, InPasswordHash, UNIX_TIMESTAMP(), UNIX_TIMESTAMP()
+    );
+END;
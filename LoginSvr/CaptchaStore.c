@@ -0,0 +1,232 @@
+#include "CaptchaStore.h"
+#include "ClientProtocol.h"
+
+struct _CaptchaStore {
+    AllocatorRef Allocator;
+    UInt8* Memory;
+    Int64 Length;
+    struct _CaptchaArchiveHeader* Header;
+    CaptchaEntryRef Entries;
+};
+
+struct _CaptchaFile {
+    Char Name[CAPTCHA_ARCHIVE_MAX_NAME_LENGTH];
+    Int32 DataLength;
+    UInt8* Data;
+};
+typedef struct _CaptchaFile* CaptchaFileRef;
+
+static Void CaptchaStoreAddFile(
+    CString FileName,
+    FileRef File,
+    Void* UserData
+) {
+    ArrayRef Files = (ArrayRef)UserData;
+
+    CString ExtensionOffset = strstr(FileName, ".jpg");
+    Int32 NameLength = (ExtensionOffset) ? (Int32)(ExtensionOffset - FileName) : (Int32)strlen(FileName);
+    if (NameLength < 1 || NameLength >= CAPTCHA_ARCHIVE_MAX_NAME_LENGTH) {
+        Warn("Skipping captcha file '%s' with invalid name length", FileName);
+        return;
+    }
+
+    struct _CaptchaFile CaptchaFile = { 0 };
+    memcpy(CaptchaFile.Name, FileName, NameLength);
+
+    if (!FileRead(File, &CaptchaFile.Data, &CaptchaFile.DataLength)) {
+        Fatal("Couldn't load captcha file content '%s'", FileName);
+    }
+
+    if (CaptchaFile.DataLength > (Int32)sizeof(((S2C_DATA_SERVER_ENVIRONMENT*)0)->Captcha)) {
+        Warn("Skipping captcha file '%s' exceeding the packet size", FileName);
+        free(CaptchaFile.Data);
+        return;
+    }
+
+    ArrayAppendElement(Files, &CaptchaFile);
+}
+
+static Bool CaptchaStoreBuildArchive(
+    AllocatorRef Allocator,
+    CString ArchivePath,
+    CString DataPath,
+    UInt32 Timeout,
+    UInt16 ProtocolIdentifier,
+    UInt16 ProtocolVersion,
+    UInt16 ProtocolExtension
+) {
+    ArrayRef Files = ArrayCreateEmpty(Allocator, sizeof(struct _CaptchaFile), 1024);
+    FilesProcess(DataPath, "*.jpg", CaptchaStoreAddFile, Files);
+
+    Int32 EntryCount = (Int32)ArrayGetElementCount(Files);
+    struct _CaptchaArchiveHeader Header = { 0 };
+    Header.Magic = CAPTCHA_ARCHIVE_MAGIC;
+    Header.Version = CAPTCHA_ARCHIVE_VERSION;
+    Header.ProtocolIdentifier = ProtocolIdentifier;
+    Header.ProtocolVersion = ProtocolVersion;
+    Header.ProtocolExtension = ProtocolExtension;
+    Header.Timeout = Timeout;
+    Header.EntryCount = EntryCount;
+
+    // NOTE: Both responses of a captcha are stored as complete packets to be sent directly from the mapped archive
+    Int32 PacketOffset = sizeof(struct _CaptchaArchiveHeader) + sizeof(struct _CaptchaEntry) * EntryCount;
+    CaptchaEntryRef Entries = (CaptchaEntryRef)AllocatorAllocate(Allocator, sizeof(struct _CaptchaEntry) * MAX(1, EntryCount));
+    if (!Entries) Fatal("Memory allocation failed!");
+
+    for (Int32 Index = 0; Index < EntryCount; Index += 1) {
+        CaptchaFileRef CaptchaFile = (CaptchaFileRef)ArrayGetElementAtIndex(Files, Index);
+        memcpy(Entries[Index].Name, CaptchaFile->Name, sizeof(Entries[Index].Name));
+        Entries[Index].EnvironmentPacketOffset = PacketOffset;
+        PacketOffset += sizeof(S2C_DATA_SERVER_ENVIRONMENT);
+        Entries[Index].RefreshPacketOffset = PacketOffset;
+        PacketOffset += sizeof(S2C_DATA_REFRESH_CAPTCHA);
+    }
+
+    Bool Success = false;
+    PacketBufferRef PacketBuffer = PacketBufferCreate(
+        Allocator,
+        ProtocolIdentifier,
+        ProtocolVersion,
+        ProtocolExtension,
+        4,
+        sizeof(S2C_DATA_SERVER_ENVIRONMENT) + sizeof(S2C_DATA_REFRESH_CAPTCHA),
+        false
+    );
+
+    FileRef File = FileCreate(ArchivePath);
+    if (!File) goto cleanup;
+    if (!FileWrite(File, (UInt8*)&Header, sizeof(struct _CaptchaArchiveHeader), false)) goto cleanup;
+    if (EntryCount > 0 && !FileWrite(File, (UInt8*)Entries, sizeof(struct _CaptchaEntry) * EntryCount, true)) goto cleanup;
+
+    for (Int32 Index = 0; Index < EntryCount; Index += 1) {
+        CaptchaFileRef CaptchaFile = (CaptchaFileRef)ArrayGetElementAtIndex(Files, Index);
+
+        S2C_DATA_SERVER_ENVIRONMENT* Environment = PacketBufferInit(PacketBuffer, S2C, SERVER_ENVIRONMENT);
+        Environment->Active = 1;
+        Environment->Timeout = Timeout;
+        Environment->CaptchaSize = CaptchaFile->DataLength;
+        memcpy(Environment->Captcha, CaptchaFile->Data, CaptchaFile->DataLength);
+        if (!FileWrite(File, (UInt8*)Environment, sizeof(S2C_DATA_SERVER_ENVIRONMENT), true)) goto cleanup;
+
+        S2C_DATA_REFRESH_CAPTCHA* Refresh = PacketBufferInit(PacketBuffer, S2C, REFRESH_CAPTCHA);
+        Refresh->Active = 1;
+        Refresh->Timeout = Timeout;
+        Refresh->CaptchaSize = CaptchaFile->DataLength;
+        memcpy(Refresh->Captcha, CaptchaFile->Data, CaptchaFile->DataLength);
+        if (!FileWrite(File, (UInt8*)Refresh, sizeof(S2C_DATA_REFRESH_CAPTCHA), true)) goto cleanup;
+    }
+
+    Success = true;
+
+cleanup:
+    if (File) FileClose(File);
+    PacketBufferDestroy(PacketBuffer);
+    AllocatorDeallocate(Allocator, Entries);
+
+    for (Int32 Index = 0; Index < EntryCount; Index += 1) {
+        CaptchaFileRef CaptchaFile = (CaptchaFileRef)ArrayGetElementAtIndex(Files, Index);
+        free(CaptchaFile->Data);
+    }
+
+    ArrayDestroy(Files);
+    return Success;
+}
+
+static Bool CaptchaStoreLoadArchive(
+    CaptchaStoreRef Store,
+    CString ArchivePath,
+    UInt32 Timeout,
+    UInt16 ProtocolIdentifier,
+    UInt16 ProtocolVersion,
+    UInt16 ProtocolExtension
+) {
+    if (!FileMap(ArchivePath, &Store->Memory, &Store->Length)) return false;
+    if (Store->Length < sizeof(struct _CaptchaArchiveHeader)) goto error;
+
+    struct _CaptchaArchiveHeader* Header = (struct _CaptchaArchiveHeader*)Store->Memory;
+    if (Header->Magic != CAPTCHA_ARCHIVE_MAGIC || Header->Version != CAPTCHA_ARCHIVE_VERSION) goto error;
+    if (Header->ProtocolIdentifier != ProtocolIdentifier ||
+        Header->ProtocolVersion != ProtocolVersion ||
+        Header->ProtocolExtension != ProtocolExtension ||
+        Header->Timeout != Timeout) goto error;
+
+    Int64 PacketOffset = sizeof(struct _CaptchaArchiveHeader) + (Int64)sizeof(struct _CaptchaEntry) * Header->EntryCount;
+    Int64 PacketLength = sizeof(S2C_DATA_SERVER_ENVIRONMENT) + sizeof(S2C_DATA_REFRESH_CAPTCHA);
+    if (Header->EntryCount < 0 || Store->Length != PacketOffset + PacketLength * Header->EntryCount) goto error;
+
+    Store->Header = Header;
+    Store->Entries = (CaptchaEntryRef)(Store->Memory + sizeof(struct _CaptchaArchiveHeader));
+    return true;
+
+error:
+    FileUnmap(Store->Memory, Store->Length);
+    Store->Memory = NULL;
+    Store->Length = 0;
+    return false;
+}
+
+CaptchaStoreRef CaptchaStoreCreate(
+    AllocatorRef Allocator,
+    CString ArchivePath,
+    CString DataPath,
+    UInt32 Timeout,
+    UInt16 ProtocolIdentifier,
+    UInt16 ProtocolVersion,
+    UInt16 ProtocolExtension
+) {
+    CaptchaStoreRef Store = (CaptchaStoreRef)AllocatorAllocate(Allocator, sizeof(struct _CaptchaStore));
+    if (!Store) Fatal("Memory allocation failed!");
+    memset(Store, 0, sizeof(struct _CaptchaStore));
+    Store->Allocator = Allocator;
+
+    if (CaptchaStoreLoadArchive(Store, ArchivePath, Timeout, ProtocolIdentifier, ProtocolVersion, ProtocolExtension)) {
+        return Store;
+    }
+
+    // NOTE: The archive is rebuilt when it is missing or was packed with different protocol parameters, delete it to pick up new captcha files
+    Info("Building captcha archive '%s' from '%s'", ArchivePath, DataPath);
+    if (!CaptchaStoreBuildArchive(Allocator, ArchivePath, DataPath, Timeout, ProtocolIdentifier, ProtocolVersion, ProtocolExtension)) {
+        Fatal("Couldn't write captcha archive '%s'", ArchivePath);
+    }
+
+    if (!CaptchaStoreLoadArchive(Store, ArchivePath, Timeout, ProtocolIdentifier, ProtocolVersion, ProtocolExtension)) {
+        Fatal("Couldn't load captcha archive '%s'", ArchivePath);
+    }
+
+    return Store;
+}
+
+Void CaptchaStoreDestroy(
+    CaptchaStoreRef Store
+) {
+    FileUnmap(Store->Memory, Store->Length);
+    AllocatorDeallocate(Store->Allocator, Store);
+}
+
+Int32 CaptchaStoreGetEntryCount(
+    CaptchaStoreRef Store
+) {
+    return Store->Header->EntryCount;
+}
+
+CaptchaEntryRef CaptchaStoreGetEntry(
+    CaptchaStoreRef Store,
+    Int32 Index
+) {
+    assert(0 <= Index && Index < Store->Header->EntryCount);
+    return &Store->Entries[Index];
+}
+
+Void* CaptchaStoreGetEnvironmentPacket(
+    CaptchaStoreRef Store,
+    CaptchaEntryRef Entry
+) {
+    return Store->Memory + Entry->EnvironmentPacketOffset;
+}
+
+Void* CaptchaStoreGetRefreshPacket(
+    CaptchaStoreRef Store,
+    CaptchaEntryRef Entry
+) {
+    return Store->Memory + Entry->RefreshPacketOffset;
+}
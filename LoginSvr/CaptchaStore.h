@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Base.h"
+
+EXTERN_C_BEGIN
+
+#define CAPTCHA_ARCHIVE_MAGIC           0x50414342
+#define CAPTCHA_ARCHIVE_VERSION         1
+#define CAPTCHA_ARCHIVE_MAX_NAME_LENGTH 16
+
+#pragma pack(push, 1)
+
+struct _CaptchaArchiveHeader {
+    UInt32 Magic;
+    UInt32 Version;
+    UInt16 ProtocolIdentifier;
+    UInt16 ProtocolVersion;
+    UInt16 ProtocolExtension;
+    UInt32 Timeout;
+    Int32 EntryCount;
+};
+
+struct _CaptchaEntry {
+    Char Name[CAPTCHA_ARCHIVE_MAX_NAME_LENGTH];
+    UInt32 EnvironmentPacketOffset;
+    UInt32 RefreshPacketOffset;
+};
+typedef struct _CaptchaEntry* CaptchaEntryRef;
+
+#pragma pack(pop)
+
+typedef struct _CaptchaStore* CaptchaStoreRef;
+
+CaptchaStoreRef CaptchaStoreCreate(
+    AllocatorRef Allocator,
+    CString ArchivePath,
+    CString DataPath,
+    UInt32 Timeout,
+    UInt16 ProtocolIdentifier,
+    UInt16 ProtocolVersion,
+    UInt16 ProtocolExtension
+);
+
+Void CaptchaStoreDestroy(
+    CaptchaStoreRef Store
+);
+
+Int32 CaptchaStoreGetEntryCount(
+    CaptchaStoreRef Store
+);
+
+CaptchaEntryRef CaptchaStoreGetEntry(
+    CaptchaStoreRef Store,
+    Int32 Index
+);
+
+Void* CaptchaStoreGetEnvironmentPacket(
+    CaptchaStoreRef Store,
+    CaptchaEntryRef Entry
+);
+
+Void* CaptchaStoreGetRefreshPacket(
+    CaptchaStoreRef Store,
+    CaptchaEntryRef Entry
+);
+
+EXTERN_C_END
@@ -31,6 +31,7 @@ CONFIG_PARAMETER(Bool, AutoCreateAccountOnLogin, "LoginSvr.AutoCreateAccountOnLo
 CONFIG_PARAMETER(Bool, EmailVerificationEnabled, "LoginSvr.EmailVerificationEnabled", 0)
 CONFIG_PARAMETER(UInt64, WorldListBroadcastInterval, "LoginSvr.WorldListBroadcastInterval", 1000)
 CONFIG_PARAMETER_ARRAY(Char, MAX_PATH, CaptchaDataPath, "LoginSvr.CaptchaDataPath", ServerData\\Captcha)
+CONFIG_PARAMETER_ARRAY(Char, MAX_PATH, CaptchaArchivePath, "LoginSvr.CaptchaArchivePath", ServerData\\Captcha.bin)
 CONFIG_PARAMETER(Bool, CaptchaVerificationEnabled, "LoginSvr.CaptchaVerificationEnabled", 0)
 CONFIG_PARAMETER(Int32, LogLevel, "LoginSvr.LogLevel", 5)
 CONFIG_PARAMETER(Int32, HashIterations, "LoginSvr.HashIterations", 1000)
@@ -87,6 +88,7 @@ CONFIG_PARAMETER(Int32, ReadBufferSize, "NetLib.ReadBufferSize", 0x1FFFF)
 CONFIG_PARAMETER(Int32, WriteBufferSize, "NetLib.WriteBufferSize", 0x1FFFF)
 CONFIG_PARAMETER(Int32, PacketBufferBacklogSize, "NetLib.PacketBufferBacklogSize", 8)
 CONFIG_PARAMETER(Bool, LogPackets, "NetLib.LogPackets", 0)
+CONFIG_PARAMETER(UInt16, MetricsPort, "NetLib.MetricsPort", 0)
 CONFIG_PARAMETER(Bool, UseEncryption, "NetLib.UseEncryption", 1)
 CONFIG_END(NetLib)
 
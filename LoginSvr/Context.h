@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Base.h"
+#include "CaptchaStore.h"
 #include "Config.h"
 #include "Constants.h"
 
@@ -16,15 +17,9 @@ enum {
     CLIENT_FLAGS_AUTHENTICATED          = 1 << 6,
     CLIENT_FLAGS_VERIFIED               = 1 << 7,
     CLIENT_FLAGS_CHECK_DISCONNECT_TIMER = 1 << 8,
+    CLIENT_FLAGS_AUTHENTICATING         = 1 << 9,
 };
 
-struct _CaptchaInfo {
-    Char Name[MAX_PATH];
-    Int32 DataLength;
-    Void* Data;
-};
-typedef struct _CaptchaInfo* CaptchaInfoRef;
-
 struct _WorldServerInfo {
     IPCNodeID NodeID;
     UInt16 PlayerCount;
@@ -35,6 +30,14 @@ struct _WorldServerInfo {
 };
 typedef struct _WorldServerInfo* WorldServerInfoRef;
 
+enum {
+    WORLD_LIST_PACKET_REMOTE,
+    WORLD_LIST_PACKET_LOCAL,
+    WORLD_LIST_PACKET_UNKNOWN_124,
+
+    WORLD_LIST_PACKET_COUNT,
+};
+
 struct _ServerContext {
     AllocatorRef Allocator;
     ServerConfig Config;
@@ -42,7 +45,11 @@ struct _ServerContext {
     DatabaseRef Database;
     Timestamp WorldListBroadcastTimestamp;
     DictionaryRef WorldServerTable;
-    ArrayRef CaptchaInfoList;
+    UInt32 WorldListVersion;
+    UInt8 WorldListGroupIndex;
+    PacketBufferRef WorldListPacketBuffers[WORLD_LIST_PACKET_COUNT];
+    Void* WorldListPackets[WORLD_LIST_PACKET_COUNT];
+    CaptchaStoreRef CaptchaStore;
 };
 typedef struct _ServerContext* ServerContextRef;
 
@@ -59,7 +66,7 @@ struct _ClientContext {
     Int32 AccountStatus; 
     Char SessionKey[MAX_SESSIONKEY_LENGTH];
     Char Username[MAX_USERNAME_LENGTH];
-    CaptchaInfoRef Captcha;
+    CaptchaEntryRef Captcha;
 };
 typedef struct _ClientContext* ClientContextRef;
 
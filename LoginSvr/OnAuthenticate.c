@@ -4,6 +4,7 @@
 #include "ClientSocket.h"
 #include "Enumerations.h"
 #include "IPCProcedures.h"
+#include "PasswordHash.h"
 #include "Server.h"
 
 Void StartAuthTimer(
@@ -145,101 +146,14 @@ Void SendMessageLoginSuccess(
     SocketSend(Socket, Connection, Response);
 }
 
-CLIENT_PROCEDURE_BINDING(AUTHENTICATE) {
-    if (!(Client->Flags & CLIENT_FLAGS_AUTHORIZED)) {
-        SocketDisconnect(Socket, Connection);
-        return;
-    }
-
-    if (Packet->SubMessageType == 21) {
-        PacketBufferRef PacketBuffer = SocketGetNextPacketBuffer(Socket);
-        S2C_DATA_AUTHENTICATE* Response = PacketBufferInit(PacketBuffer, S2C, AUTHENTICATE);
-        Response->KeepAlive = 1;
-        Response->Unknown2 = -1;
-        Response->SubMessageType = 21;
-        Response->LoginStatus = Client->LoginStatus;
-        Response->AccountStatus = Client->AccountStatus;
-
-        PacketBufferAppendStruct(PacketBuffer, S2C_DATA_AUTHENTICATE_EXTENSION_UNKNOWN_21);
-        SocketSend(Socket, Connection, Response);
-        return;
-    }
-
-    if (Packet->SubMessageType == 25) {
-        PacketBufferRef PacketBuffer = SocketGetNextPacketBuffer(Socket);
-        S2C_DATA_AUTHENTICATE* Response = PacketBufferInit(PacketBuffer, S2C, AUTHENTICATE);
-        Response->KeepAlive = 1;
-        Response->Unknown2 = -1;
-        Response->SubMessageType = 25;
-        Response->LoginStatus = Client->LoginStatus;
-        Response->AccountStatus = Client->AccountStatus;
-
-        PacketBufferAppendStruct(PacketBuffer, S2C_DATA_AUTHENTICATE_EXTENSION_UNKNOWN_25);
-        SocketSend(Socket, Connection, Response);
-        return;
-    }
-
-    assert(Client->RSA);
-    Int32 Length = RSA_size(Client->RSA);
-    Int32 DecryptedPayloadLength = RSA_private_decrypt(
-        Length,
-        Packet->Payload,
-        Client->RSAPayloadBuffer,
-        Client->RSA,
-        RSA_PKCS1_OAEP_PADDING
-    );
-
-    if (CLIENT_RSA_PAYLOAD_LENGTH != DecryptedPayloadLength) goto error;
-
-    CString Username = (CString)&Client->RSAPayloadBuffer[0];
-    Int32 UsernameLength = (Int32)strlen(Username);
-    if (UsernameLength > MAX_USERNAME_LENGTH) goto error;
-
-    CString Password = (CString)&Client->RSAPayloadBuffer[129];
-    Int32 PasswordLength = (Int32)strlen(Password);
-    if (PasswordLength > MAX_PASSWORD_LENGTH) goto error;
-
-    Bool InsertedAccount = false;
-
-authenticate:
-    GenerateRandomKey(Client->SessionKey, sizeof(Client->SessionKey));
-
-    Bool Success = DatabaseCallProcedure(
-        Context->Database,
-        "Authenticate",
-        DB_INPUT_STRING(Username, strlen(Username)),
-        DB_INPUT_STRING(Password, strlen(Password)),
-        DB_INPUT_INT32(Context->Config.Login.HashIterations),
-        DB_INPUT_STRING(Connection->AddressIP, strlen(Connection->AddressIP)),
-        DB_INPUT_STRING(Client->SessionKey, strlen(Client->SessionKey)),
-        DB_INPUT_BOOL(Context->Config.Login.EmailVerificationEnabled),
-        DB_OUTPUT_INT32(Client->LoginStatus),
-        DB_OUTPUT_INT32(Client->AccountStatus),
-        DB_OUTPUT_INT32(Client->AccountID),
-        DB_PARAM_END
-    );
-
-    if (!Success) {
-        Client->LoginStatus = LOGIN_STATUS_ERROR;
-        Client->AccountStatus = ACCOUNT_STATUS_OUT_OF_SERVICE;
-    }
-
-    if (!InsertedAccount && Context->Config.Login.AutoCreateAccountOnLogin &&
-        Client->AccountStatus == ACCOUNT_STATUS_INVALID_CREDENTIALS) {
-
-        DatabaseCallProcedure(
-            Context->Database,
-            "InsertAccount",
-            DB_INPUT_STRING(Username, strlen(Username)),
-            DB_INPUT_STRING(Username, strlen(Username)),
-            DB_INPUT_STRING(Password, strlen(Password)),
-            DB_INPUT_INT32(Context->Config.Login.HashIterations),
-            DB_PARAM_END
-        );
-
-        InsertedAccount = true;
-        goto authenticate;
-    }
+Void AuthenticateClientFinish(
+    ServerRef Server,
+    ServerContextRef Context,
+    SocketRef Socket,
+    SocketConnectionRef Connection,
+    ClientContextRef Client
+) {
+    Client->Flags &= ~CLIENT_FLAGS_AUTHENTICATING;
 
     PacketBufferRef PacketBuffer = SocketGetNextPacketBuffer(Socket);
     S2C_DATA_AUTHENTICATE* Response = PacketBufferInit(PacketBuffer, S2C, AUTHENTICATE);
@@ -297,11 +211,12 @@ authenticate:
     // Just clearing the payload buffer to avoid keeping sensitive data in memory!
     memset(Client->RSAPayloadBuffer, 0, sizeof(Client->RSAPayloadBuffer));
 
-    IPC_L2M_DATA_GET_WORLD_LIST* Request = IPCPacketBufferInit(Server->IPCSocket->PacketBuffer, L2M, GET_WORLD_LIST);
-    Request->Header.Source = Server->IPCSocket->NodeID;
-    Request->Header.Target.Group = Server->IPCSocket->NodeID.Group;
-    Request->Header.Target.Type = IPC_TYPE_MASTER;
-    IPCSocketUnicast(Server->IPCSocket, Request);
+    if (Context->WorldListVersion) {
+        ServerSendWorldList(Context, Connection);
+    }
+    else {
+        ServerRequestWorldList(Server, Context);
+    }
 
     if (Client->AccountID > 0) {
         IPC_N2M_DATA_CLIENT_CONNECT* Notification = IPCPacketBufferInit(Server->IPCSocket->PacketBuffer, N2M, CLIENT_CONNECT);
@@ -320,3 +235,220 @@ error:
 
     SocketDisconnect(Socket, Connection);
 }
+
+struct _AuthenticateJob {
+    uv_work_t Request;
+    ServerRef Server;
+    ServerContextRef Context;
+    SocketRef Socket;
+    Int ConnectionID;
+    Bool InsertAccount;
+    Bool InsertedAccount;
+    Bool Success;
+    Int32 Iterations;
+    Int32 PasswordLength;
+    Char Username[MAX_USERNAME_LENGTH + 1];
+    Char Password[MAX_PASSWORD_LENGTH + 1];
+    UInt8 Salt[PASSWORD_SALT_LENGTH];
+    UInt8 PasswordHash[PASSWORD_HASH_LENGTH];
+};
+typedef struct _AuthenticateJob* AuthenticateJobRef;
+
+static Void AuthenticateJobDestroy(
+    AuthenticateJobRef Job
+) {
+    // Just clearing the job to avoid keeping sensitive data in memory!
+    AllocatorRef Allocator = Job->Context->Allocator;
+    memset(Job, 0, sizeof(struct _AuthenticateJob));
+    AllocatorDeallocate(Allocator, Job);
+}
+
+static Void AuthenticateJobOnWork(
+    uv_work_t* Request
+) {
+    AuthenticateJobRef Job = (AuthenticateJobRef)Request->data;
+    Job->Success = PasswordComputeHash(Job->Password, Job->PasswordLength, Job->Salt, Job->Iterations, Job->PasswordHash);
+}
+
+static Void AuthenticateJobOnComplete(
+    uv_work_t* Request,
+    Int32 Status
+);
+
+static Bool AuthenticateJobSchedule(
+    AuthenticateJobRef Job
+) {
+    Job->Request.data = Job;
+    Job->Success = false;
+    return uv_queue_work(uv_default_loop(), &Job->Request, AuthenticateJobOnWork, AuthenticateJobOnComplete) == 0;
+}
+
+static Void AuthenticateJobOnComplete(
+    uv_work_t* Request,
+    Int32 Status
+) {
+    AuthenticateJobRef Job = (AuthenticateJobRef)Request->data;
+    ServerRef Server = Job->Server;
+    ServerContextRef Context = Job->Context;
+    SocketRef Socket = Job->Socket;
+
+    // NOTE: The client could have disconnected while the password was hashed on the worker thread
+    SocketConnectionRef Connection = SocketGetConnection(Socket, Job->ConnectionID);
+    ClientContextRef Client = (Connection) ? (ClientContextRef)Connection->Userdata : NULL;
+    if (!Client || !(Client->Flags & CLIENT_FLAGS_AUTHENTICATING)) {
+        AuthenticateJobDestroy(Job);
+        return;
+    }
+
+    if (Status < 0 || !Job->Success) {
+        Client->LoginStatus = LOGIN_STATUS_ERROR;
+        Client->AccountStatus = ACCOUNT_STATUS_OUT_OF_SERVICE;
+        AuthenticateJobDestroy(Job);
+        AuthenticateClientFinish(Server, Context, Socket, Connection, Client);
+        return;
+    }
+
+    if (Job->InsertAccount) {
+        DatabaseCallProcedure(
+            Context->Database,
+            "InsertAccountPasswordHash",
+            DB_INPUT_STRING(Job->Username, strlen(Job->Username)),
+            DB_INPUT_STRING(Job->Username, strlen(Job->Username)),
+            DB_INPUT_DATA(Job->PasswordHash, sizeof(Job->PasswordHash)),
+            DB_PARAM_END
+        );
+
+        Job->InsertAccount = false;
+        Job->InsertedAccount = true;
+    }
+
+    GenerateRandomKey(Client->SessionKey, sizeof(Client->SessionKey));
+
+    Bool Success = DatabaseCallProcedure(
+        Context->Database,
+        "AuthenticatePasswordHash",
+        DB_INPUT_STRING(Job->Username, strlen(Job->Username)),
+        DB_INPUT_DATA(Job->PasswordHash, sizeof(Job->PasswordHash)),
+        DB_INPUT_STRING(Connection->AddressIP, strlen(Connection->AddressIP)),
+        DB_INPUT_STRING(Client->SessionKey, strlen(Client->SessionKey)),
+        DB_INPUT_BOOL(Context->Config.Login.EmailVerificationEnabled),
+        DB_OUTPUT_INT32(Client->LoginStatus),
+        DB_OUTPUT_INT32(Client->AccountStatus),
+        DB_OUTPUT_INT32(Client->AccountID),
+        DB_PARAM_END
+    );
+
+    if (!Success) {
+        Client->LoginStatus = LOGIN_STATUS_ERROR;
+        Client->AccountStatus = ACCOUNT_STATUS_OUT_OF_SERVICE;
+    }
+
+    if (!Job->InsertedAccount && Context->Config.Login.AutoCreateAccountOnLogin &&
+        Client->AccountStatus == ACCOUNT_STATUS_INVALID_CREDENTIALS) {
+        Job->InsertAccount = true;
+        if (PasswordGenerateSalt(Job->Salt) && AuthenticateJobSchedule(Job)) return;
+
+        Client->LoginStatus = LOGIN_STATUS_ERROR;
+        Client->AccountStatus = ACCOUNT_STATUS_OUT_OF_SERVICE;
+    }
+
+    AuthenticateJobDestroy(Job);
+    AuthenticateClientFinish(Server, Context, Socket, Connection, Client);
+}
+
+CLIENT_PROCEDURE_BINDING(AUTHENTICATE) {
+    if (!(Client->Flags & CLIENT_FLAGS_AUTHORIZED)) {
+        SocketDisconnect(Socket, Connection);
+        return;
+    }
+
+    if (Packet->SubMessageType == 21) {
+        PacketBufferRef PacketBuffer = SocketGetNextPacketBuffer(Socket);
+        S2C_DATA_AUTHENTICATE* Response = PacketBufferInit(PacketBuffer, S2C, AUTHENTICATE);
+        Response->KeepAlive = 1;
+        Response->Unknown2 = -1;
+        Response->SubMessageType = 21;
+        Response->LoginStatus = Client->LoginStatus;
+        Response->AccountStatus = Client->AccountStatus;
+
+        PacketBufferAppendStruct(PacketBuffer, S2C_DATA_AUTHENTICATE_EXTENSION_UNKNOWN_21);
+        SocketSend(Socket, Connection, Response);
+        return;
+    }
+
+    if (Packet->SubMessageType == 25) {
+        PacketBufferRef PacketBuffer = SocketGetNextPacketBuffer(Socket);
+        S2C_DATA_AUTHENTICATE* Response = PacketBufferInit(PacketBuffer, S2C, AUTHENTICATE);
+        Response->KeepAlive = 1;
+        Response->Unknown2 = -1;
+        Response->SubMessageType = 25;
+        Response->LoginStatus = Client->LoginStatus;
+        Response->AccountStatus = Client->AccountStatus;
+
+        PacketBufferAppendStruct(PacketBuffer, S2C_DATA_AUTHENTICATE_EXTENSION_UNKNOWN_25);
+        SocketSend(Socket, Connection, Response);
+        return;
+    }
+
+    if (Client->Flags & CLIENT_FLAGS_AUTHENTICATING) return;
+
+    assert(Client->RSA);
+    Int32 Length = RSA_size(Client->RSA);
+    Int32 DecryptedPayloadLength = RSA_private_decrypt(
+        Length,
+        Packet->Payload,
+        Client->RSAPayloadBuffer,
+        Client->RSA,
+        RSA_PKCS1_OAEP_PADDING
+    );
+
+    if (CLIENT_RSA_PAYLOAD_LENGTH != DecryptedPayloadLength) goto error;
+
+    CString Username = (CString)&Client->RSAPayloadBuffer[0];
+    Int32 UsernameLength = (Int32)strlen(Username);
+    if (UsernameLength > MAX_USERNAME_LENGTH) goto error;
+
+    CString Password = (CString)&Client->RSAPayloadBuffer[129];
+    Int32 PasswordLength = (Int32)strlen(Password);
+    if (PasswordLength > MAX_PASSWORD_LENGTH) goto error;
+
+    // NOTE: Only the salt is read from the database, hashing runs on the libuv worker pool and the result is compared by the database
+    AuthenticateJobRef Job = (AuthenticateJobRef)AllocatorAllocate(Context->Allocator, sizeof(struct _AuthenticateJob));
+    if (!Job) Fatal("Memory allocation failed!");
+
+    memset(Job, 0, sizeof(struct _AuthenticateJob));
+    Job->Server = Server;
+    Job->Context = Context;
+    Job->Socket = Socket;
+    Job->ConnectionID = Connection->ID;
+    Job->Iterations = Context->Config.Login.HashIterations;
+    Job->PasswordLength = PasswordLength;
+    memcpy(Job->Username, Username, UsernameLength);
+    memcpy(Job->Password, Password, PasswordLength);
+
+    // Just clearing the payload buffer to avoid keeping sensitive data in memory!
+    memset(Client->RSAPayloadBuffer, 0, sizeof(Client->RSAPayloadBuffer));
+
+    Client->Flags |= CLIENT_FLAGS_AUTHENTICATING;
+
+    if (!DatabaseCallProcedure(
+        Context->Database,
+        "GetPasswordSalt",
+        DB_INPUT_STRING(Job->Username, strlen(Job->Username)),
+        DB_OUTPUT_DATA(Job->Salt, sizeof(Job->Salt)),
+        DB_PARAM_END
+    ) || !AuthenticateJobSchedule(Job)) {
+        AuthenticateJobDestroy(Job);
+        Client->LoginStatus = LOGIN_STATUS_ERROR;
+        Client->AccountStatus = ACCOUNT_STATUS_OUT_OF_SERVICE;
+        AuthenticateClientFinish(Server, Context, Socket, Connection, Client);
+    }
+
+    return;
+
+error:
+    // Just clearing the payload buffer to avoid keeping sensitive data in memory!
+    memset(Client->RSAPayloadBuffer, 0, sizeof(Client->RSAPayloadBuffer));
+
+    SocketDisconnect(Socket, Connection);
+}
@@ -3,71 +3,76 @@
 #include "ClientSocket.h"
 #include "IPCProtocol.h"
 #include "IPCProcedures.h"
+#include "Server.h"
 
 IPC_PROCEDURE_BINDING(M2L, GET_WORLD_LIST) {
-    Char LocalHost[] = "127.0.0.1";
-    SocketConnectionIteratorRef Iterator = SocketGetConnectionIterator(Context->ClientSocket);
-    while (Iterator) {
-        SocketConnectionRef Connection = SocketConnectionIteratorFetch(Context->ClientSocket, Iterator);
-        Iterator = SocketConnectionIteratorNext(Context->ClientSocket, Iterator);
+    if (Packet->Version == Context->WorldListVersion) return;
 
-        ClientContextRef Client = (ClientContextRef)Connection->Userdata;
-        Bool IsLocalHost = strcmp(Client->Connection->AddressIP, LocalHost) == 0;
-        Bool IsAuthorized = (
-            (Client->Flags & CLIENT_FLAGS_AUTHENTICATED) &&
-            !(Connection->Flags & SOCKET_CONNECTION_FLAGS_DISCONNECTED)
-        );
-        if (!IsAuthorized) {
-            Trace("AuthorizationState(%d, %d)", (Client->Flags & CLIENT_FLAGS_AUTHENTICATED), !(Connection->Flags & SOCKET_CONNECTION_FLAGS_DISCONNECTED));
-            continue;
-        }
-
-        PacketBufferRef PacketBuffer = SocketGetNextPacketBuffer(Context->ClientSocket);
-        S2C_DATA_SERVER_LIST* Notification = PacketBufferInit(PacketBuffer, S2C, SERVER_LIST);
-        Notification->ServerCount = Packet->GroupCount;
+    DictionaryRemoveAll(Context->WorldServerTable);
 
-        Int PacketOffset = sizeof(IPC_M2L_DATA_GET_WORLD_LIST);
-        for (Int GroupIndex = 0; GroupIndex < Packet->GroupCount; GroupIndex += 1) {
-            IPC_M2L_DATA_SERVER_GROUP* Group = (IPC_M2L_DATA_SERVER_GROUP*)((UInt8*)Packet + PacketOffset);
-            PacketOffset += sizeof(IPC_M2L_DATA_SERVER_GROUP);
+    Int PacketOffset = sizeof(IPC_M2L_DATA_GET_WORLD_LIST);
+    for (Int GroupIndex = 0; GroupIndex < Packet->GroupCount; GroupIndex += 1) {
+        IPC_M2L_DATA_SERVER_GROUP* Group = (IPC_M2L_DATA_SERVER_GROUP*)((UInt8*)Packet + PacketOffset);
+        PacketOffset += sizeof(IPC_M2L_DATA_SERVER_GROUP);
 
-            S2C_DATA_LOGIN_SERVER_LIST_INDEX* NotificationGroup = PacketBufferAppendStruct(PacketBuffer, S2C_DATA_LOGIN_SERVER_LIST_INDEX);
-            NotificationGroup->ServerID = Group->GroupIndex;
-            NotificationGroup->WorldCount = Group->NodeCount;
-            NotificationGroup->Language = Context->Config.Login.Language;
+        Context->WorldListGroupIndex = Group->GroupIndex;
 
-            for (Int NodeIndex = 0; NodeIndex < Group->NodeCount; NodeIndex += 1) {
-                IPC_M2L_DATA_SERVER_GROUP_NODE* Node = (IPC_M2L_DATA_SERVER_GROUP_NODE*)((UInt8*)Packet + PacketOffset);
-                PacketOffset += sizeof(IPC_M2L_DATA_SERVER_GROUP_NODE);
+        for (Int NodeIndex = 0; NodeIndex < Group->NodeCount; NodeIndex += 1) {
+            IPC_M2L_DATA_SERVER_GROUP_NODE* Node = (IPC_M2L_DATA_SERVER_GROUP_NODE*)((UInt8*)Packet + PacketOffset);
+            PacketOffset += sizeof(IPC_M2L_DATA_SERVER_GROUP_NODE);
 
-                S2C_DATA_LOGIN_SERVER_LIST_WORLD* NotificationNode = PacketBufferAppendStruct(PacketBuffer, S2C_DATA_LOGIN_SERVER_LIST_WORLD);
-                NotificationNode->ServerID = Group->GroupIndex;
-                NotificationNode->WorldID = Node->NodeIndex;
-                NotificationNode->PlayerCount = Node->PlayerCount;
-                NotificationNode->MaxPlayerCount = Node->MaxPlayerCount;
-                memcpy(NotificationNode->WorldHost, (IsLocalHost) ? LocalHost : Node->Host, (IsLocalHost) ? sizeof(LocalHost) : sizeof(Node->Host));
-                NotificationNode->WorldPort = Node->Port;
-                NotificationNode->WorldType = Node->Type;
-            }
+            struct _WorldServerInfo WorldInfo = { 0 };
+            WorldInfo.NodeID.Group = Group->GroupIndex;
+            WorldInfo.NodeID.Index = Node->NodeIndex;
+            WorldInfo.NodeID.Type = IPC_TYPE_WORLD;
+            WorldInfo.PlayerCount = Node->PlayerCount;
+            WorldInfo.MaxPlayerCount = Node->MaxPlayerCount;
+            CStringCopySafe(WorldInfo.WorldHost, sizeof(WorldInfo.WorldHost), Node->Host);
+            WorldInfo.WorldPort = Node->Port;
+            WorldInfo.WorldType = Node->Type;
 
-            NotificationGroup->WorldCount += 1;
-            PacketBufferAppendStruct(PacketBuffer, S2C_DATA_LOGIN_SERVER_LIST_WORLD);
+            Int WorldIndex = Node->NodeIndex;
+            DictionaryInsert(Context->WorldServerTable, &WorldIndex, &WorldInfo, sizeof(struct _WorldServerInfo));
         }
+    }
+
+    Context->WorldListVersion = Packet->Version;
+    ServerUpdateWorldList(Context);
+    ServerBroadcastWorldList(Context);
+}
 
-        SocketSend(Context->ClientSocket, Connection, Notification);
+IPC_PROCEDURE_BINDING(M2L, NFY_WORLD_LIST) {
+    // NOTE: A missed delta can't be applied on top of the cached list, so the full list is requested instead
+    if (!Context->WorldListVersion || Packet->Version != Context->WorldListVersion + 1) {
+        ServerRequestWorldList(Server, Context);
+        return;
+    }
 
-        PacketBuffer = SocketGetNextPacketBuffer(Context->ClientSocket);
-        S2C_DATA_UNKNOWN_124* Unknown124 = PacketBufferInit(PacketBuffer, S2C, UNKNOWN_124);
-        Unknown124->Unknown1 = 0;
-        Unknown124->Unknown2[0] = 100;
-        Unknown124->Unknown2[1] = 200;
-        Unknown124->Unknown2[2] = 300;
-        Unknown124->Unknown2[3] = 400;
-        Unknown124->Unknown3 = 1;
-        Unknown124->Unknown4[0] = 500;
-        Unknown124->Unknown4[1] = 600;
-        Unknown124->Unknown4[2] = 700;
-        Unknown124->Unknown4[3] = 800;
-        SocketSend(Context->ClientSocket, Connection, Unknown124);
+    Int WorldIndex = Packet->Node.NodeIndex;
+    if (Packet->IsRemoved) {
+        DictionaryRemove(Context->WorldServerTable, &WorldIndex);
     }
+    else {
+        WorldServerInfoRef WorldInfo = (WorldServerInfoRef)DictionaryLookup(Context->WorldServerTable, &WorldIndex);
+        if (!WorldInfo) {
+            struct _WorldServerInfo NewWorldInfo = { 0 };
+            DictionaryInsert(Context->WorldServerTable, &WorldIndex, &NewWorldInfo, sizeof(struct _WorldServerInfo));
+            WorldInfo = (WorldServerInfoRef)DictionaryLookup(Context->WorldServerTable, &WorldIndex);
+            assert(WorldInfo);
+        }
+
+        WorldInfo->NodeID.Group = Packet->GroupIndex;
+        WorldInfo->NodeID.Index = Packet->Node.NodeIndex;
+        WorldInfo->NodeID.Type = IPC_TYPE_WORLD;
+        WorldInfo->PlayerCount = Packet->Node.PlayerCount;
+        WorldInfo->MaxPlayerCount = Packet->Node.MaxPlayerCount;
+        CStringCopySafe(WorldInfo->WorldHost, sizeof(WorldInfo->WorldHost), Packet->Node.Host);
+        WorldInfo->WorldPort = Packet->Node.Port;
+        WorldInfo->WorldType = Packet->Node.Type;
+    }
+
+    Context->WorldListGroupIndex = Packet->GroupIndex;
+    Context->WorldListVersion = Packet->Version;
+    ServerUpdateWorldList(Context);
+    ServerBroadcastWorldList(Context);
 }
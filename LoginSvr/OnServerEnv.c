@@ -24,27 +24,25 @@ CLIENT_PROCEDURE_BINDING(SERVER_ENVIRONMENT) {
 
 DATA_PROCEDURE_BINDING(OnDataAccountInfo, IPC_DATA_ACCOUNTINFO, IPC_DATA_ACKACCOUNTINFO) {
 	*/
-	S2C_DATA_SERVER_ENVIRONMENT* Response = PacketBufferInit(SocketGetNextPacketBuffer(Socket), S2C, SERVER_ENVIRONMENT);
+	// TODO: Add support for image authentication
+	Client->Flags |= CLIENT_FLAGS_USERNAME_CHECKED;
+
 	if (Context->Config.Login.CaptchaVerificationEnabled) {
 		Int32 Seed = (Int32)PlatformGetTickCount();
-		Client->Captcha = (CaptchaInfoRef)ArrayGetElementAtIndex(
-			Context->CaptchaInfoList,
-			Random(&Seed) % ArrayGetElementCount(Context->CaptchaInfoList)
+		Client->Captcha = CaptchaStoreGetEntry(
+			Context->CaptchaStore,
+			Random(&Seed) % CaptchaStoreGetEntryCount(Context->CaptchaStore)
 		);
 
-		Response->Active = 1;
-		Response->Timeout = Context->Config.Login.AutoDisconnectDelay;
-		Response->CaptchaSize = Client->Captcha->DataLength;
 		Client->Flags |= CLIENT_FLAGS_CHECK_DISCONNECT_TIMER;
-		Client->DisconnectTimestamp = GetTimestampMs() + Response->Timeout;
-		memcpy(Response->Captcha, Client->Captcha->Data, Response->CaptchaSize);
-	}
-	else {
-		Client->Flags |= CLIENT_FLAGS_CAPTCHA_VERIFIED;
+		Client->DisconnectTimestamp = GetTimestampMs() + Context->Config.Login.AutoDisconnectDelay;
+		SocketSend(Socket, Connection, CaptchaStoreGetEnvironmentPacket(Context->CaptchaStore, Client->Captcha));
+		return;
 	}
 
-	// TODO: Add support for image authentication
-	Client->Flags |= CLIENT_FLAGS_USERNAME_CHECKED;
+	Client->Flags |= CLIENT_FLAGS_CAPTCHA_VERIFIED;
+
+	S2C_DATA_SERVER_ENVIRONMENT* Response = PacketBufferInit(SocketGetNextPacketBuffer(Socket), S2C, SERVER_ENVIRONMENT);
 	SocketSend(Socket, Connection, Response);
 }
 
@@ -54,24 +52,21 @@ CLIENT_PROCEDURE_BINDING(REFRESH_CAPTCHA) {
 		return;
 	}
 
-	S2C_DATA_REFRESH_CAPTCHA* Response = PacketBufferInit(SocketGetNextPacketBuffer(Socket), S2C, REFRESH_CAPTCHA);
 	if (Context->Config.Login.CaptchaVerificationEnabled) {
 		Int32 Seed = (Int32)PlatformGetTickCount();
-		Client->Captcha = (CaptchaInfoRef)ArrayGetElementAtIndex(
-			Context->CaptchaInfoList,
-			Random(&Seed) % ArrayGetElementCount(Context->CaptchaInfoList)
+		Client->Captcha = CaptchaStoreGetEntry(
+			Context->CaptchaStore,
+			Random(&Seed) % CaptchaStoreGetEntryCount(Context->CaptchaStore)
 		);
 
-		Response->Active = 1;
-		Response->Timeout = Context->Config.Login.AutoDisconnectDelay;
-		Response->CaptchaSize = Client->Captcha->DataLength;
 		Client->Flags |= CLIENT_FLAGS_CHECK_DISCONNECT_TIMER;
-		Client->DisconnectTimestamp = GetTimestampMs() + Response->Timeout;
-		memcpy(Response->Captcha, Client->Captcha->Data, Response->CaptchaSize);
-	}
-	else {
-		Client->Flags |= CLIENT_FLAGS_CAPTCHA_VERIFIED;
+		Client->DisconnectTimestamp = GetTimestampMs() + Context->Config.Login.AutoDisconnectDelay;
+		SocketSend(Socket, Connection, CaptchaStoreGetRefreshPacket(Context->CaptchaStore, Client->Captcha));
+		return;
 	}
 
+	Client->Flags |= CLIENT_FLAGS_CAPTCHA_VERIFIED;
+
+	S2C_DATA_REFRESH_CAPTCHA* Response = PacketBufferInit(SocketGetNextPacketBuffer(Socket), S2C, REFRESH_CAPTCHA);
 	SocketSend(Socket, Connection, Response);
 }
@@ -81,11 +81,12 @@ IPC_PROCEDURE_BINDING(W2L, WORLD_VERIFY_LINKS) {
     Client->Flags |= CLIENT_FLAGS_AUTHENTICATED;
     Client->DisconnectTimestamp = GetTimestampMs() + Context->Config.Login.AutoDisconnectDelay;
 
-    IPC_L2M_DATA_GET_WORLD_LIST* Request = IPCPacketBufferInit(Socket->PacketBuffer, L2M, GET_WORLD_LIST);
-    Request->Header.Source = Server->IPCSocket->NodeID;
-    Request->Header.Target.Group = Server->IPCSocket->NodeID.Group;
-    Request->Header.Target.Type = IPC_TYPE_MASTER;
-    IPCSocketUnicast(Socket, Request);
+    if (Context->WorldListVersion) {
+        ServerSendWorldList(Context, ClientConnection);
+    }
+    else {
+        ServerRequestWorldList(Server, Context);
+    }
 
     if (Client->AccountID > 0) {
         IPC_N2M_DATA_CLIENT_CONNECT* Notification = IPCPacketBufferInit(Server->IPCSocket->PacketBuffer, N2M, CLIENT_CONNECT);
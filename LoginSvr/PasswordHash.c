@@ -0,0 +1,41 @@
+#include "PasswordHash.h"
+
+#include <openssl/rand.h>
+
+Bool PasswordGenerateSalt(
+    UInt8* Salt
+) {
+    return RAND_bytes(Salt, PASSWORD_SALT_LENGTH) == 1;
+}
+
+Bool PasswordComputeHash(
+    CString Password,
+    Int32 PasswordLength,
+    UInt8* Salt,
+    Int32 Iterations,
+    UInt8* Hash
+) {
+    EVP_MD_CTX* DigestContext = EVP_MD_CTX_new();
+    if (!DigestContext) return false;
+
+    UInt8* Digest = Hash + PASSWORD_SALT_LENGTH;
+    UInt32 DigestLength = 0;
+    Bool Success = (
+        EVP_DigestInit_ex(DigestContext, EVP_sha512(), NULL) &&
+        EVP_DigestUpdate(DigestContext, Salt, PASSWORD_SALT_LENGTH) &&
+        EVP_DigestUpdate(DigestContext, Password, PasswordLength) &&
+        EVP_DigestFinal_ex(DigestContext, Digest, &DigestLength)
+    );
+
+    for (Int32 Index = 0; Success && Index < Iterations; Index += 1) {
+        Success = (
+            EVP_DigestInit_ex(DigestContext, EVP_sha512(), NULL) &&
+            EVP_DigestUpdate(DigestContext, Digest, PASSWORD_DIGEST_LENGTH) &&
+            EVP_DigestFinal_ex(DigestContext, Digest, &DigestLength)
+        );
+    }
+
+    EVP_MD_CTX_free(DigestContext);
+    memcpy(Hash, Salt, PASSWORD_SALT_LENGTH);
+    return Success && DigestLength == PASSWORD_DIGEST_LENGTH;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Base.h"
+
+EXTERN_C_BEGIN
+
+#define PASSWORD_SALT_LENGTH        16
+#define PASSWORD_DIGEST_LENGTH      64
+#define PASSWORD_HASH_LENGTH        (PASSWORD_SALT_LENGTH + PASSWORD_DIGEST_LENGTH)
+
+Bool PasswordGenerateSalt(
+    UInt8* Salt
+);
+
+// NOTE: This has to stay identical to the HashPassword procedure, the result is the salt followed by the iterated SHA-512 digest of salt and password
+Bool PasswordComputeHash(
+    CString Password,
+    Int32 PasswordLength,
+    UInt8* Salt,
+    Int32 Iterations,
+    UInt8* Hash
+);
+
+EXTERN_C_END
@@ -1,5 +1,6 @@
 #include "Server.h"
 #include "ClientProtocol.h"
+#include "IPCProtocol.h"
 
 Void StartDisconnectTimer(
     ServerRef Server,
@@ -37,6 +38,100 @@ ClientContextRef ServerGetClientByAuthKey(
     return NULL;
 }
 
+Void ServerRequestWorldList(
+    ServerRef Server,
+    ServerContextRef Context
+) {
+    IPC_L2M_DATA_GET_WORLD_LIST* Request = IPCPacketBufferInit(Server->IPCSocket->PacketBuffer, L2M, GET_WORLD_LIST);
+    Request->Header.Source = Server->IPCSocket->NodeID;
+    Request->Header.Target.Group = Server->IPCSocket->NodeID.Group;
+    Request->Header.Target.Type = IPC_TYPE_MASTER;
+    IPCSocketUnicast(Server->IPCSocket, Request);
+}
+
+static Void ServerBuildWorldListPacket(
+    ServerContextRef Context,
+    Int32 PacketIndex,
+    Bool IsLocalHost
+) {
+    Char LocalHost[] = "127.0.0.1";
+    PacketBufferRef PacketBuffer = Context->WorldListPacketBuffers[PacketIndex];
+    S2C_DATA_SERVER_LIST* Notification = PacketBufferInit(PacketBuffer, S2C, SERVER_LIST);
+    Notification->ServerCount = 1;
+
+    S2C_DATA_LOGIN_SERVER_LIST_INDEX* NotificationGroup = PacketBufferAppendStruct(PacketBuffer, S2C_DATA_LOGIN_SERVER_LIST_INDEX);
+    NotificationGroup->ServerID = Context->WorldListGroupIndex;
+    NotificationGroup->Language = Context->Config.Login.Language;
+
+    DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(Context->WorldServerTable);
+    while (Iterator.Key) {
+        WorldServerInfoRef WorldInfo = (WorldServerInfoRef)DictionaryLookup(Context->WorldServerTable, Iterator.Key);
+        Iterator = DictionaryKeyIteratorNext(Iterator);
+
+        S2C_DATA_LOGIN_SERVER_LIST_WORLD* NotificationNode = PacketBufferAppendStruct(PacketBuffer, S2C_DATA_LOGIN_SERVER_LIST_WORLD);
+        NotificationNode->ServerID = Context->WorldListGroupIndex;
+        NotificationNode->WorldID = WorldInfo->NodeID.Index;
+        NotificationNode->PlayerCount = WorldInfo->PlayerCount;
+        NotificationNode->MaxPlayerCount = WorldInfo->MaxPlayerCount;
+        CStringCopySafe(NotificationNode->WorldHost, sizeof(NotificationNode->WorldHost), (IsLocalHost) ? LocalHost : WorldInfo->WorldHost);
+        NotificationNode->WorldPort = WorldInfo->WorldPort;
+        NotificationNode->WorldType = WorldInfo->WorldType;
+        NotificationGroup->WorldCount += 1;
+    }
+
+    NotificationGroup->WorldCount += 1;
+    PacketBufferAppendStruct(PacketBuffer, S2C_DATA_LOGIN_SERVER_LIST_WORLD);
+
+    Context->WorldListPackets[PacketIndex] = Notification;
+}
+
+Void ServerUpdateWorldList(
+    ServerContextRef Context
+) {
+    ServerBuildWorldListPacket(Context, WORLD_LIST_PACKET_REMOTE, false);
+    ServerBuildWorldListPacket(Context, WORLD_LIST_PACKET_LOCAL, true);
+
+    S2C_DATA_UNKNOWN_124* Unknown124 = PacketBufferInit(Context->WorldListPacketBuffers[WORLD_LIST_PACKET_UNKNOWN_124], S2C, UNKNOWN_124);
+    Unknown124->Unknown1 = 0;
+    Unknown124->Unknown2[0] = 100;
+    Unknown124->Unknown2[1] = 200;
+    Unknown124->Unknown2[2] = 300;
+    Unknown124->Unknown2[3] = 400;
+    Unknown124->Unknown3 = 1;
+    Unknown124->Unknown4[0] = 500;
+    Unknown124->Unknown4[1] = 600;
+    Unknown124->Unknown4[2] = 700;
+    Unknown124->Unknown4[3] = 800;
+    Context->WorldListPackets[WORLD_LIST_PACKET_UNKNOWN_124] = Unknown124;
+}
+
+Void ServerSendWorldList(
+    ServerContextRef Context,
+    SocketConnectionRef Connection
+) {
+    if (!Context->WorldListVersion) return;
+
+    Bool IsLocalHost = strcmp(Connection->AddressIP, "127.0.0.1") == 0;
+    SocketSend(Context->ClientSocket, Connection, Context->WorldListPackets[(IsLocalHost) ? WORLD_LIST_PACKET_LOCAL : WORLD_LIST_PACKET_REMOTE]);
+    SocketSend(Context->ClientSocket, Connection, Context->WorldListPackets[WORLD_LIST_PACKET_UNKNOWN_124]);
+}
+
+Void ServerBroadcastWorldList(
+    ServerContextRef Context
+) {
+    SocketConnectionIteratorRef Iterator = SocketGetConnectionIterator(Context->ClientSocket);
+    while (Iterator) {
+        SocketConnectionRef Connection = SocketConnectionIteratorFetch(Context->ClientSocket, Iterator);
+        Iterator = SocketConnectionIteratorNext(Context->ClientSocket, Iterator);
+
+        ClientContextRef Client = (ClientContextRef)Connection->Userdata;
+        if (!(Client->Flags & CLIENT_FLAGS_AUTHENTICATED)) continue;
+        if (Connection->Flags & SOCKET_CONNECTION_FLAGS_DISCONNECTED) continue;
+
+        ServerSendWorldList(Context, Connection);
+    }
+}
+
 Void ServerLoadMigrationData(
     ServerConfig Config,
     ServerContextRef Context
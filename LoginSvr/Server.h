@@ -20,6 +20,24 @@ ClientContextRef ServerGetClientByAuthKey(
     UInt16 EntityID
 );
 
+Void ServerRequestWorldList(
+    ServerRef Server,
+    ServerContextRef Context
+);
+
+Void ServerUpdateWorldList(
+    ServerContextRef Context
+);
+
+Void ServerSendWorldList(
+    ServerContextRef Context,
+    SocketConnectionRef Connection
+);
+
+Void ServerBroadcastWorldList(
+    ServerContextRef Context
+);
+
 Void ServerLoadMigrationData(
     ServerConfig Config,
     ServerContextRef Context
@@ -86,34 +86,10 @@ Void ServerOnUpdate(
         }
     }
 
+    // NOTE: Changes are pushed by the master server, the full list is only requested to resynchronize the version
     if (Context->WorldListBroadcastTimestamp < CurrentTimestamp) {
         Context->WorldListBroadcastTimestamp = CurrentTimestamp + Context->Config.Login.WorldListBroadcastInterval;
-        IPC_L2M_DATA_GET_WORLD_LIST* Request = IPCPacketBufferInit(Server->IPCSocket->PacketBuffer, L2M, GET_WORLD_LIST);
-        Request->Header.Source = Server->IPCSocket->NodeID;
-        Request->Header.Target.Group = Server->IPCSocket->NodeID.Group;
-        Request->Header.Target.Type = IPC_TYPE_MASTER;
-        IPCSocketUnicast(Server->IPCSocket, Request);
-    }
-}
-
-Void ContextAddCaptchaFile(
-    CString FileName,
-    FileRef File,
-    Void* UserData
-) {
-    ServerContextRef Context = (ServerContextRef)UserData;
-    CaptchaInfoRef Captcha = (CaptchaInfoRef)ArrayAppendUninitializedElement(Context->CaptchaInfoList);
-
-    CStringCopySafe(Captcha->Name, MAX_PATH, FileName);
-
-    CString ExtensionOffset = strstr(FileName, ".jpg");
-    if (ExtensionOffset != NULL) {
-        Int32 CaptchaLength = (Int32)(ExtensionOffset - FileName);
-        Captcha->Name[CaptchaLength] = '\0';
-    }
-
-    if (!FileRead(File, (UInt8**)&Captcha->Data, &Captcha->DataLength)) {
-        Fatal("Couldn't load captcha file content '%s'", FileName);
+        ServerRequestWorldList(Server, Context);
     }
 }
 
@@ -133,15 +109,23 @@ Int32 main(Int32 argc, CString* argv) {
     ServerContext.Database = NULL;
     ServerContext.WorldListBroadcastTimestamp = 0;
     ServerContext.WorldServerTable = IndexDictionaryCreate(Allocator, 256);
-    ServerContext.CaptchaInfoList = ArrayCreateEmpty(Allocator, sizeof(struct _CaptchaInfo), 8);
+    ServerContext.WorldListVersion = 0;
+    ServerContext.CaptchaStore = NULL;
 
     if (Config.Login.CaptchaVerificationEnabled) {
-        FilesProcess(
+        ServerContext.CaptchaStore = CaptchaStoreCreate(
+            Allocator,
+            Config.Login.CaptchaArchivePath,
             Config.Login.CaptchaDataPath,
-            "*.jpg",
-            ContextAddCaptchaFile,
-            &ServerContext
+            Config.Login.AutoDisconnectDelay,
+            Config.NetLib.ProtocolIdentifier,
+            Config.NetLib.ProtocolVersion,
+            Config.NetLib.ProtocolExtension
         );
+
+        if (CaptchaStoreGetEntryCount(ServerContext.CaptchaStore) < 1) {
+            Fatal("No captcha files found in '%s'", Config.Login.CaptchaDataPath);
+        }
     }
 
     IPCNodeID NodeID = kIPCNodeIDNull;
@@ -161,6 +145,7 @@ Int32 main(Int32 argc, CString* argv) {
         &ServerOnUpdate,
         &ServerContext
     );
+    ServerEnableMetrics(Server, Config.NetLib.MetricsPort);
 
     ServerContext.ClientSocket = ServerCreateSocket(
         Server,
@@ -196,6 +181,18 @@ Int32 main(Int32 argc, CString* argv) {
     IPCSocketRegisterCommandCallback(Server->IPCSocket, IPC_M2N_ ## __NAME__, &SERVER_IPC_M2N_PROC_ ## __NAME__);
 #include "IPCCommands.h"
 
+    for (Int Index = 0; Index < WORLD_LIST_PACKET_COUNT; Index += 1) {
+        ServerContext.WorldListPacketBuffers[Index] = PacketBufferCreate(
+            Allocator,
+            Config.NetLib.ProtocolIdentifier,
+            Config.NetLib.ProtocolVersion,
+            Config.NetLib.ProtocolExtension,
+            4,
+            Config.NetLib.WriteBufferSize,
+            false
+        );
+    }
+
     ServerContext.Database = DatabaseConnect(
         Allocator,
         Config.Database.Driver,
@@ -215,12 +212,12 @@ Int32 main(Int32 argc, CString* argv) {
     ServerDestroy(Server);
     DatabaseDisconnect(ServerContext.Database);
 
-    for (Int Index = 0; Index < ArrayGetElementCount(ServerContext.CaptchaInfoList); Index += 1) {
-        CaptchaInfoRef Captcha = (CaptchaInfoRef)ArrayGetElementAtIndex(ServerContext.CaptchaInfoList, Index);
-        free(Captcha->Data);
-    }
+    if (ServerContext.CaptchaStore) CaptchaStoreDestroy(ServerContext.CaptchaStore);
+    DictionaryDestroy(ServerContext.WorldServerTable);
 
-    ArrayDestroy(ServerContext.CaptchaInfoList);
+    for (Int Index = 0; Index < WORLD_LIST_PACKET_COUNT; Index += 1) {
+        PacketBufferDestroy(ServerContext.WorldListPacketBuffers[Index]);
+    }
 
     return EXIT_SUCCESS;
 }
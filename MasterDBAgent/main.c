@@ -64,6 +64,7 @@ Int32 main(Int32 argc, CString* argv) {
         &ServerOnUpdate,
         &ServerContext
     );
+    ServerEnableMetrics(Server, Config.NetLib.MetricsPort);
 
     Int64 DatabaseResultBufferSize = 0;
 
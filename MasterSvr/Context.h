@@ -26,6 +26,7 @@ struct _ServerContext {
     ServerConfig Config;
     DictionaryRef WorldInfoTable;
     DictionaryRef ClientInfoTable;
+    UInt32 WorldListVersion;
 };
 typedef struct _ServerContext* ServerContextRef;
 
@@ -1,29 +1,30 @@
 #include "IPCProtocol.h"
 #include "IPCProcedures.h"
+#include "Server.h"
 
 IPC_PROCEDURE_BINDING(L2M, GET_WORLD_LIST) {
+    // NOTE: Worlds which have disconnected are removed here, the login servers request the full list periodically
+    ServerPruneWorldInfoTable(Server, Context);
+
     IPC_M2L_DATA_GET_WORLD_LIST* Response = IPCPacketBufferInit(Connection->PacketBuffer, M2L, GET_WORLD_LIST);
     Response->Header.Source = Server->IPCSocket->NodeID;
     Response->Header.Target = Packet->Header.Source;
     Response->Header.TargetConnectionID = Packet->Header.SourceConnectionID;
+    Response->Version = Context->WorldListVersion;
     Response->GroupCount = 1;
 
     IPC_M2L_DATA_SERVER_GROUP* ServerGroup = IPCPacketBufferAppendStruct(Connection->PacketBuffer, IPC_M2L_DATA_SERVER_GROUP);
     ServerGroup->GroupIndex = Server->IPCSocket->NodeID.Group;
 
-    DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(Socket->NodeTable);
+    DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(Context->WorldInfoTable);
     while (Iterator.Key) {
-        IPCNodeID Node = *(IPCNodeID*)Iterator.Key;
+        WorldInfoRef WorldInfo = (WorldInfoRef)DictionaryLookup(Context->WorldInfoTable, Iterator.Key);
         Iterator = DictionaryKeyIteratorNext(Iterator);
 
-        if (Node.Type != IPC_TYPE_WORLD) continue;
-        if (Node.Group != Server->IPCSocket->NodeID.Group) continue;
-
-        WorldInfoRef WorldInfo = (WorldInfoRef)DictionaryLookup(Context->WorldInfoTable, &Node);
-        if (!WorldInfo) continue;
+        if (WorldInfo->NodeID.Group != Server->IPCSocket->NodeID.Group) continue;
 
         IPC_M2L_DATA_SERVER_GROUP_NODE* ServerGroupNode = IPCPacketBufferAppendStruct(Connection->PacketBuffer, IPC_M2L_DATA_SERVER_GROUP_NODE);
-        ServerGroupNode->NodeIndex = Node.Index;
+        ServerGroupNode->NodeIndex = WorldInfo->NodeID.Index;
         ServerGroupNode->PlayerCount = WorldInfo->PlayerCount;
         ServerGroupNode->MaxPlayerCount = WorldInfo->MaxPlayerCount;
         CStringCopySafe(ServerGroupNode->Host, 64 + 1, WorldInfo->Host);
@@ -42,11 +43,13 @@ IPC_PROCEDURE_BINDING(W2M, GET_WORLD_LIST) {
     Response->Header.Target = Packet->Header.Source;
     Response->Header.TargetConnectionID = Packet->Header.SourceConnectionID;
 
-    DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(Socket->NodeTable);
-    while (Iterator.Key) {
-        IPCNodeID Node = *(IPCNodeID*)Iterator.Key;
-        Iterator = DictionaryKeyIteratorNext(Iterator);
+    IPCSocketConnectionIteratorRef Iterator = IPCSocketGetConnectionIterator(Socket);
+    while (Iterator) {
+        IPCSocketConnectionRef NodeConnection = IPCSocketConnectionIteratorFetch(Socket, Iterator);
+        Iterator = IPCSocketConnectionIteratorNext(Socket, Iterator);
+        if (!NodeConnection->Userdata) continue;
 
+        IPCNodeID Node = ((IPCNodeContextRef)NodeConnection->Userdata)->NodeID;
         if (Node.Type != IPC_TYPE_WORLD) continue;
         if (Node.Group != Context->Config.MasterSvr.GroupIndex) continue;
 
@@ -1,5 +1,6 @@
 #include "IPCProtocol.h"
 #include "IPCProcedures.h"
+#include "Server.h"
 
 IPC_PROCEDURE_BINDING(W2M, NFY_WORLD_INFO) {
 	if (IPCNodeIDIsNull(ConnectionContext->NodeID)) return;
@@ -12,10 +13,21 @@ IPC_PROCEDURE_BINDING(W2M, NFY_WORLD_INFO) {
 		WorldInfo = (WorldInfoRef)DictionaryLookup(Context->WorldInfoTable, &ConnectionContext->NodeID);
 		assert(WorldInfo);
 	}
+	else if (
+		WorldInfo->PlayerCount == Packet->PlayerCount &&
+		WorldInfo->MaxPlayerCount == Packet->MaxPlayerCount &&
+		WorldInfo->Port == Packet->Port &&
+		WorldInfo->Type == Packet->Type &&
+		strncmp(WorldInfo->Host, Packet->Host, sizeof(WorldInfo->Host)) == 0
+	) {
+		return;
+	}
 
 	WorldInfo->PlayerCount = Packet->PlayerCount;
 	WorldInfo->MaxPlayerCount = Packet->MaxPlayerCount;
 	CStringCopySafe(WorldInfo->Host, 64 + 1, Packet->Host);
 	WorldInfo->Port = Packet->Port;
 	WorldInfo->Type = Packet->Type;
+
+	ServerBroadcastWorldInfo(Server, Context, WorldInfo, false);
 }
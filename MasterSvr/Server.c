@@ -0,0 +1,61 @@
+#include "IPCProtocol.h"
+#include "Server.h"
+
+Void ServerBroadcastWorldInfo(
+    ServerRef Server,
+    ServerContextRef Context,
+    WorldInfoRef WorldInfo,
+    Bool IsRemoved
+) {
+    Context->WorldListVersion += 1;
+
+    IPCSocketConnectionIteratorRef Iterator = IPCSocketGetConnectionIterator(Server->IPCSocket);
+    while (Iterator) {
+        IPCSocketConnectionRef Connection = IPCSocketConnectionIteratorFetch(Server->IPCSocket, Iterator);
+        Iterator = IPCSocketConnectionIteratorNext(Server->IPCSocket, Iterator);
+        if (!Connection->Userdata) continue;
+
+        IPCNodeID Node = ((IPCNodeContextRef)Connection->Userdata)->NodeID;
+        if (Node.Type != IPC_TYPE_LOGIN) continue;
+
+        IPC_M2L_DATA_NFY_WORLD_LIST* Notification = IPCPacketBufferInit(Server->IPCSocket->PacketBuffer, M2L, NFY_WORLD_LIST);
+        Notification->Header.Source = Server->IPCSocket->NodeID;
+        Notification->Header.Target = Node;
+        Notification->Version = Context->WorldListVersion;
+        Notification->GroupIndex = WorldInfo->NodeID.Group;
+        Notification->IsRemoved = IsRemoved;
+        Notification->Node.NodeIndex = WorldInfo->NodeID.Index;
+        Notification->Node.PlayerCount = WorldInfo->PlayerCount;
+        Notification->Node.MaxPlayerCount = WorldInfo->MaxPlayerCount;
+        CStringCopySafe(Notification->Node.Host, 64 + 1, WorldInfo->Host);
+        Notification->Node.Port = WorldInfo->Port;
+        Notification->Node.Type = WorldInfo->Type;
+        IPCSocketUnicast(Server->IPCSocket, Notification);
+    }
+}
+
+Void ServerPruneWorldInfoTable(
+    ServerRef Server,
+    ServerContextRef Context
+) {
+    while (true) {
+        WorldInfoRef StaleWorldInfo = NULL;
+
+        DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(Context->WorldInfoTable);
+        while (Iterator.Key) {
+            WorldInfoRef WorldInfo = (WorldInfoRef)DictionaryLookup(Context->WorldInfoTable, Iterator.Key);
+            Iterator = DictionaryKeyIteratorNext(Iterator);
+
+            if (!IPCSocketGetNodeConnection(Server->IPCSocket, WorldInfo->NodeID)) {
+                StaleWorldInfo = WorldInfo;
+                break;
+            }
+        }
+
+        if (!StaleWorldInfo) break;
+
+        IPCNodeID NodeID = StaleWorldInfo->NodeID;
+        ServerBroadcastWorldInfo(Server, Context, StaleWorldInfo, true);
+        DictionaryRemove(Context->WorldInfoTable, &NodeID);
+    }
+}
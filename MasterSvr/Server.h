@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Base.h"
+#include "Context.h"
+
+EXTERN_C_BEGIN
+
+Void ServerBroadcastWorldInfo(
+    ServerRef Server,
+    ServerContextRef Context,
+    WorldInfoRef WorldInfo,
+    Bool IsRemoved
+);
+
+Void ServerPruneWorldInfoTable(
+    ServerRef Server,
+    ServerContextRef Context
+);
+
+EXTERN_C_END
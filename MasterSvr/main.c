@@ -50,6 +50,8 @@ Int32 main(Int32 argc, CString* argv) {
     ServerContext.Config = Config;
     ServerContext.WorldInfoTable = IPCNodeIDDictionaryCreate(Allocator, Config.MasterSvr.MaxWorldCount);
     ServerContext.ClientInfoTable = IndexDictionaryCreate(Allocator, 4096);
+    // NOTE: Seeding the version with the start time lets login servers detect a restart of the master server
+    ServerContext.WorldListVersion = MAX(1, (UInt32)GetTimestamp());
 
     IPCNodeID NodeID = kIPCNodeIDNull;
     NodeID.Group = Config.MasterSvr.GroupIndex;
@@ -67,6 +69,7 @@ Int32 main(Int32 argc, CString* argv) {
         &ServerOnUpdate,
         &ServerContext
     );
+    ServerEnableMetrics(Server, Config.NetLib.MetricsPort);
 
 #define IPC_L2M_COMMAND(__NAME__) \
     IPCSocketRegisterCommandCallback(Server->IPCSocket, IPC_L2M_ ## __NAME__, &SERVER_IPC_L2M_PROC_ ## __NAME__);
@@ -62,6 +62,27 @@ Void* IPCPacketBufferAppendCopy(
     return Memory;
 }
 
+Int32 IPCPacketBufferAppendSparse(
+    IPCPacketBufferRef PacketBuffer,
+    SparseSchemaRef Schema,
+    Void* Source
+) {
+    Int32 Capacity = SparseGetMaxEncodedLength(Schema);
+    UInt8* Memory = (UInt8*)IPCPacketBufferAppend(PacketBuffer, Capacity);
+    Int32 Length = SparseEncode(Schema, Source, Memory, Capacity);
+    assert(Length >= 0);
+
+    // NOTE: The encoding is reserved at its maximum length and the unused tail is released again
+    Int32 UnusedLength = Capacity - Length;
+    if (UnusedLength > 0) {
+        IPCPacketRef Packet = (IPCPacketRef)MemoryBufferGetMemory(PacketBuffer->MemoryBuffer, 0);
+        MemoryBufferRemove(PacketBuffer->MemoryBuffer, MemoryBufferGetWriteOffset(PacketBuffer->MemoryBuffer) - UnusedLength, UnusedLength);
+        Packet->Length -= UnusedLength;
+    }
+
+    return Length;
+}
+
 CString IPCPacketBufferAppendCString(
     IPCPacketBufferRef PacketBuffer,
     CString Value
@@ -41,6 +41,13 @@ CString IPCPacketBufferAppendCString(
     CString Value
 );
 
+// NOTE: Returns the encoded length which is appended to the packet
+Int32 IPCPacketBufferAppendSparse(
+    IPCPacketBufferRef PacketBuffer,
+    SparseSchemaRef Schema,
+    Void* Source
+);
+
 #define IPCPacketBufferAppendValue(PacketBuffer, __TYPE__, __VALUE__) \
 *((__TYPE__*)IPCPacketBufferAppend(PacketBuffer, sizeof(__TYPE__))) = __VALUE__
 
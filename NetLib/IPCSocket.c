@@ -33,6 +33,82 @@ Bool IPCSocketFetchReadBuffer(
     IPCSocketConnectionRef Connection
 );
 
+static IPCSocketConnectionRef* IPCSocketGetNodeDirectorySlot(
+    IPCSocketRef Socket,
+    IPCNodeID NodeID,
+    Bool Create
+) {
+    if (NodeID.Type < 0 || NodeID.Type >= IPC_TYPE_COUNT) return NULL;
+    if (NodeID.Group < 0 || NodeID.Group >= IPC_NODE_DIRECTORY_GROUP_COUNT) return NULL;
+    if (NodeID.Index < 0 || NodeID.Index >= IPC_NODE_DIRECTORY_INDEX_COUNT) return NULL;
+
+    IPCSocketConnectionRef** Groups = Socket->NodeDirectory[NodeID.Type];
+    if (!Groups) {
+        if (!Create) return NULL;
+
+        Groups = (IPCSocketConnectionRef**)AllocatorAllocate(Socket->Allocator, sizeof(IPCSocketConnectionRef*) * IPC_NODE_DIRECTORY_GROUP_COUNT);
+        if (!Groups) Fatal("Memory allocation failed!");
+
+        memset(Groups, 0, sizeof(IPCSocketConnectionRef*) * IPC_NODE_DIRECTORY_GROUP_COUNT);
+        Socket->NodeDirectory[NodeID.Type] = Groups;
+    }
+
+    IPCSocketConnectionRef* Nodes = Groups[NodeID.Group];
+    if (!Nodes) {
+        if (!Create) return NULL;
+
+        Nodes = (IPCSocketConnectionRef*)AllocatorAllocate(Socket->Allocator, sizeof(IPCSocketConnectionRef) * IPC_NODE_DIRECTORY_INDEX_COUNT);
+        if (!Nodes) Fatal("Memory allocation failed!");
+
+        memset(Nodes, 0, sizeof(IPCSocketConnectionRef) * IPC_NODE_DIRECTORY_INDEX_COUNT);
+        Groups[NodeID.Group] = Nodes;
+    }
+
+    return &Nodes[NodeID.Index];
+}
+
+static Void IPCSocketEnqueuePendingPacket(
+    IPCSocketRef Socket,
+    IPCPacketRef Packet
+) {
+    if (ArrayGetElementCount(Socket->PendingPackets) >= IPC_SOCKET_MAX_PENDING_COUNT) {
+        MetricsCounterAdd("ipc_packets_dropped", 1);
+        return;
+    }
+
+    struct _IPCSocketPendingPacket PendingPacket = { 0 };
+    PendingPacket.Timeout = GetTimestampMs() + IPC_SOCKET_PENDING_TIMEOUT;
+    PendingPacket.Packet = (IPCPacketRef)AllocatorAllocate(Socket->Allocator, Packet->Length);
+    if (!PendingPacket.Packet) Fatal("Memory allocation failed!");
+
+    memcpy(PendingPacket.Packet, Packet, Packet->Length);
+    ArrayAppendElement(Socket->PendingPackets, &PendingPacket);
+}
+
+static Void IPCSocketFlushPendingPackets(
+    IPCSocketRef Socket
+) {
+    Timestamp CurrentTimestamp = GetTimestampMs();
+    Int Index = 0;
+    while (Index < ArrayGetElementCount(Socket->PendingPackets)) {
+        IPCSocketPendingPacketRef PendingPacket = (IPCSocketPendingPacketRef)ArrayGetElementAtIndex(Socket->PendingPackets, Index);
+        IPCSocketConnectionRef Connection = IPCSocketGetNodeConnection(Socket, PendingPacket->Packet->Target);
+        if (Connection) {
+            IPCSocketSend(Socket, Connection, PendingPacket->Packet);
+        }
+        else if (PendingPacket->Timeout > CurrentTimestamp) {
+            Index += 1;
+            continue;
+        }
+        else {
+            MetricsCounterAdd("ipc_packets_dropped", 1);
+        }
+
+        AllocatorDeallocate(Socket->Allocator, PendingPacket->Packet);
+        ArrayRemoveElementAtIndex(Socket->PendingPackets, Index);
+    }
+}
+
 Void IPCSocketOnConnect(
     IPCSocketRef Socket,
     IPCSocketConnectionRef Connection
@@ -41,16 +117,20 @@ Void IPCSocketOnConnect(
     
     IPCNodeContextRef NodeContext = (IPCNodeContextRef)Connection->Userdata;
     NodeContext->ConnectionID = Connection->ID;
-
-    struct _IPCPacket Packet = { 0 };
-    Packet.Length = sizeof(struct _IPCPacket);
-    Packet.Command = IPC_COMMAND_REGISTER;
-    Packet.RouteType = IPC_ROUTE_TYPE_UNICAST;
-    Packet.Source = Socket->NodeID;
-    Packet.SourceConnectionID = 0;
-    Packet.Target = NodeContext->NodeID;
-    Packet.TargetConnectionID = 0;
-    IPCSocketSend(Socket, Connection, &Packet);
+    NodeContext->Capabilities = 0;
+    NodeContext->ReadBufferSize = 0;
+
+    struct _IPCRegisterPacket Packet = { 0 };
+    Packet.Header.Length = sizeof(struct _IPCRegisterPacket);
+    Packet.Header.Command = IPC_COMMAND_REGISTER;
+    Packet.Header.SubCommand = IPC_CAPABILITY_ALL;
+    Packet.Header.RouteType = IPC_ROUTE_TYPE_UNICAST;
+    Packet.Header.Source = Socket->NodeID;
+    Packet.Header.SourceConnectionID = 0;
+    Packet.Header.Target = NodeContext->NodeID;
+    Packet.Header.TargetConnectionID = 0;
+    Packet.ReadBufferSize = Socket->ReadBufferSize;
+    IPCSocketSend(Socket, Connection, &Packet.Header);
 }
 
 Void OnReconnectTimerClose(
@@ -76,9 +156,8 @@ Void IPCSocketOnDisconnect(
 ) {
     IPCNodeContextRef NodeContext = (IPCNodeContextRef)Connection->Userdata;
 
-    if (!IPCNodeIDIsNull(NodeContext->NodeID)) {
-        DictionaryRemove(Socket->NodeTable, &NodeContext->NodeID);
-    }
+    IPCSocketConnectionRef* NodeSlot = IPCSocketGetNodeDirectorySlot(Socket, NodeContext->NodeID, false);
+    if (NodeSlot && *NodeSlot == Connection) *NodeSlot = NULL;
 
     MemoryPoolRelease(Socket->ConnectionContextPool, Connection->ConnectionPoolIndex);
     Connection->Userdata = NULL;
@@ -93,31 +172,54 @@ Void IPCSocketOnReceived(
     
     if (Socket->LogPackets) IPCPacketLogBytes(Packet);
 
+    MetricsCounterAdd("ipc_packets_received", 1);
+    MetricsCounterAdd("ipc_bytes_received", Packet->Length);
+
     if (Packet->Command == IPC_COMMAND_REGISTER) {
         if (Packet->Source.Group != Socket->NodeID.Group) goto error;
 
+        IPCSocketConnectionRef* NodeSlot = IPCSocketGetNodeDirectorySlot(Socket, Packet->Source, true);
+        if (!NodeSlot) goto error;
+
         NodeContext->NodeID = Packet->Source;
-        DictionaryInsert(Socket->NodeTable, &Packet->Source, &Connection->ID, sizeof(Int));
+        NodeContext->Capabilities = Packet->SubCommand & IPC_CAPABILITY_ALL;
+        NodeContext->ReadBufferSize = 0;
+        if (Packet->Length >= sizeof(struct _IPCRegisterPacket)) {
+            NodeContext->ReadBufferSize = ((IPCRegisterPacketRef)Packet)->ReadBufferSize;
+        }
+
+        // NOTE: Frames can't be sized for a node which doesn't advertise its read buffer
+        if (NodeContext->ReadBufferSize <= (Int32)sizeof(struct _IPCFrame)) {
+            NodeContext->Capabilities &= ~IPC_CAPABILITY_FRAMES;
+        }
+        *NodeSlot = Connection;
+
+        if (ArrayGetElementCount(Socket->PendingPackets) > 0) IPCSocketFlushPendingPackets(Socket);
     }
 
     if (Packet->Command == IPC_COMMAND_ROUTE) {
         if (IPCNodeIDIsEqual(Packet->Target, Socket->NodeID)) {
             Int Command = Packet->SubCommand;
-            IPCSocketCommandCallback* CommandCallback = (IPCSocketCommandCallback*)DictionaryLookup(Socket->CommandRegistry, &Command);
-            if (CommandCallback) (*CommandCallback)(
-                Socket,
-                Connection,
-                Packet
-            );
+            if (Command < Socket->CommandSlotCount && Socket->CommandSlots[Command].Callback) {
+                IPCSocketCommandSlotRef CommandSlot = &Socket->CommandSlots[Command];
+                Timestamp HandlerTimestamp = PlatformGetTickCountUs();
+                CommandSlot->Callback(
+                    Socket,
+                    Connection,
+                    Packet
+                );
+                CommandSlot->InvocationCount += 1;
+                CommandSlot->HandlerDuration += PlatformGetTickCountUs() - HandlerTimestamp;
+            }
         }
         else if (Packet->RouteType == IPC_ROUTE_TYPE_UNICAST) {
-            Int* TargetConnectionID = DictionaryLookup(Socket->NodeTable, &Packet->Target);
-            if (!TargetConnectionID) return;
-
-            IPCSocketConnectionRef TargetConnection = IPCSocketGetConnection(Socket, *TargetConnectionID);
-            if (!TargetConnection) return;
-
-            IPCSocketSend(Socket, TargetConnection, Packet);
+            IPCSocketConnectionRef TargetConnection = IPCSocketGetNodeConnection(Socket, Packet->Target);
+            if (TargetConnection) {
+                IPCSocketSend(Socket, TargetConnection, Packet);
+            }
+            else if (!Socket->Host) {
+                IPCSocketEnqueuePendingPacket(Socket, Packet);
+            }
         }
         else if (Packet->RouteType == IPC_ROUTE_TYPE_BROADCAST) {
             IPCSocketConnectionIteratorRef Iterator = IPCSocketGetConnectionIterator(Socket);
@@ -350,8 +452,13 @@ IPCSocketRef IPCSocketCreate(
     Socket->ConnectionIndices = IndexSetCreate(Allocator, MaxConnectionCount);
     Socket->ConnectionPool = MemoryPoolCreate(Allocator, sizeof(struct _IPCSocketConnection), MaxConnectionCount);
     Socket->ConnectionContextPool = MemoryPoolCreate(Allocator, sizeof(struct _IPCNodeContext), MaxConnectionCount);
-    Socket->CommandRegistry = IndexDictionaryCreate(Allocator, 8);
-    Socket->NodeTable = IPCNodeIDDictionaryCreate(Allocator, 8);
+    Socket->CommandSlots = NULL;
+    Socket->CommandSlotCount = 0;
+    memset(Socket->NodeDirectory, 0, sizeof(Socket->NodeDirectory));
+    Socket->PendingPackets = ArrayCreateEmpty(Allocator, sizeof(struct _IPCSocketPendingPacket), 8);
+    Socket->FrameBuffer = (UInt8*)AllocatorAllocate(Allocator, ReadBufferSize);
+    if (!Socket->FrameBuffer) Fatal("Memory allocation failed!");
+
     Socket->Userdata = Userdata;
 
     if (Host) {
@@ -371,8 +478,26 @@ Void IPCSocketDestroy(
     uv_tcp_close_reset(&Socket->Handle, NULL);
     uv_loop_close(Socket->Loop);
     free(Socket->Loop);
-    DictionaryDestroy(Socket->CommandRegistry);
-    DictionaryDestroy(Socket->NodeTable);
+    if (Socket->CommandSlots) AllocatorDeallocate(Socket->Allocator, Socket->CommandSlots);
+
+    for (Int Type = 0; Type < IPC_TYPE_COUNT; Type += 1) {
+        IPCSocketConnectionRef** Groups = Socket->NodeDirectory[Type];
+        if (!Groups) continue;
+
+        for (Int Group = 0; Group < IPC_NODE_DIRECTORY_GROUP_COUNT; Group += 1) {
+            if (Groups[Group]) AllocatorDeallocate(Socket->Allocator, Groups[Group]);
+        }
+
+        AllocatorDeallocate(Socket->Allocator, Groups);
+    }
+
+    for (Int Index = 0; Index < ArrayGetElementCount(Socket->PendingPackets); Index += 1) {
+        IPCSocketPendingPacketRef PendingPacket = (IPCSocketPendingPacketRef)ArrayGetElementAtIndex(Socket->PendingPackets, Index);
+        AllocatorDeallocate(Socket->Allocator, PendingPacket->Packet);
+    }
+
+    ArrayDestroy(Socket->PendingPackets);
+    AllocatorDeallocate(Socket->Allocator, Socket->FrameBuffer);
     IPCPacketBufferDestroy(Socket->PacketBuffer);
     IndexSetDestroy(Socket->ConnectionIndices);
     MemoryPoolDestroy(Socket->ConnectionPool);
@@ -384,8 +509,35 @@ Void IPCSocketRegisterCommandCallback(
     Int Command,
     IPCSocketCommandCallback Callback
 ) {
-    assert(!DictionaryLookup(Socket->CommandRegistry, &Command));
-    DictionaryInsert(Socket->CommandRegistry, &Command, &Callback, sizeof(IPCSocketCommandCallback));
+    assert(Command >= 0);
+
+    if (Command >= Socket->CommandSlotCount) {
+        Int SlotCount = MAX(Socket->CommandSlotCount, 64);
+        while (SlotCount <= Command) SlotCount <<= 1;
+
+        Socket->CommandSlots = (IPCSocketCommandSlotRef)AllocatorReallocate(Socket->Allocator, Socket->CommandSlots, sizeof(struct _IPCSocketCommandSlot) * SlotCount);
+        if (!Socket->CommandSlots) Fatal("Memory allocation failed!");
+
+        memset(&Socket->CommandSlots[Socket->CommandSlotCount], 0, sizeof(struct _IPCSocketCommandSlot) * (SlotCount - Socket->CommandSlotCount));
+        Socket->CommandSlotCount = SlotCount;
+    }
+
+    assert(!Socket->CommandSlots[Command].Callback);
+    Socket->CommandSlots[Command].Callback = Callback;
+}
+
+Bool IPCSocketGetCommandStatistics(
+    IPCSocketRef Socket,
+    Int Command,
+    UInt64* InvocationCount,
+    Timestamp* HandlerDuration
+) {
+    if (Command < 0 || Command >= Socket->CommandSlotCount) return false;
+
+    IPCSocketCommandSlotRef CommandSlot = &Socket->CommandSlots[Command];
+    *InvocationCount = CommandSlot->InvocationCount;
+    *HandlerDuration = CommandSlot->HandlerDuration;
+    return true;
 }
 
 IPCSocketConnectionRef IPCSocketReserveConnection(
@@ -399,6 +551,7 @@ IPCSocketConnectionRef IPCSocketReserveConnection(
     Connection->ConnectionPoolIndex = ConnectionPoolIndex;
     Connection->PacketBuffer = IPCPacketBufferCreate(Socket->Allocator, 4, Socket->WriteBufferSize);
     Connection->ReadBuffer = MemoryBufferCreate(Socket->Allocator, 4, Socket->ReadBufferSize);
+    Connection->WriteBuffer = ArrayCreateEmpty(Socket->Allocator, sizeof(UInt8), Socket->WriteBufferSize);
     return Connection;
 }
 
@@ -408,6 +561,7 @@ Void IPCSocketReleaseConnection(
 ) {
     IPCPacketBufferDestroy(Connection->PacketBuffer);
     MemoryBufferDestroy(Connection->ReadBuffer);
+    ArrayDestroy(Connection->WriteBuffer);
     IndexSetRemove(Socket->ConnectionIndices, Connection->ConnectionPoolIndex);
     MemoryPoolRelease(Socket->ConnectionPool, Connection->ConnectionPoolIndex);
 }
@@ -476,17 +630,12 @@ Void OnWrite(
     AllocatorDeallocate(Connection->Socket->Allocator, WriteRequest);
 }
 
-Void IPCSocketSend(
+static struct _IPCSocketConnectionWriteRequest* IPCSocketCreateWriteRequest(
     IPCSocketRef Socket,
     IPCSocketConnectionRef Connection,
-    IPCPacketRef Packet
+    Int32 Length
 ) {
-    assert(Socket->State == IPC_SOCKET_STATE_CONNECTED);
-    assert(!(Connection->Flags & IPC_SOCKET_CONNECTION_FLAGS_DISCONNECTED));
-
-    if (Socket->LogPackets) IPCPacketLogBytes(Packet);
-
-    Int32 MemoryLength = sizeof(struct _IPCSocketConnectionWriteRequest) + Packet->Length;
+    Int32 MemoryLength = sizeof(struct _IPCSocketConnectionWriteRequest) + Length;
     UInt8* Memory = AllocatorAllocate(Socket->Allocator, MemoryLength);
     if (!Memory) {
         Fatal("Memory allocation failed!");
@@ -495,11 +644,149 @@ Void IPCSocketSend(
     struct _IPCSocketConnectionWriteRequest* WriteRequest = (struct _IPCSocketConnectionWriteRequest*)Memory;
     WriteRequest->Request.data = Connection;
     WriteRequest->Buffer.base = (CString)(Memory + sizeof(struct _IPCSocketConnectionWriteRequest));
-    WriteRequest->Buffer.len = Packet->Length;
-    memcpy(WriteRequest->Buffer.base, Packet, Packet->Length);
+    WriteRequest->Buffer.len = Length;
+    return WriteRequest;
+}
+
+static Void IPCSocketWrite(
+    IPCSocketRef Socket,
+    IPCSocketConnectionRef Connection,
+    UInt8* Memory,
+    Int32 Length
+) {
+    struct _IPCSocketConnectionWriteRequest* WriteRequest = IPCSocketCreateWriteRequest(Socket, Connection, Length);
+    memcpy(WriteRequest->Buffer.base, Memory, Length);
     uv_write(&WriteRequest->Request, (uv_stream_t*)Connection->Handle, &WriteRequest->Buffer, 1, OnWrite);
 }
 
+static Void IPCSocketFlushConnection(
+    IPCSocketRef Socket,
+    IPCSocketConnectionRef Connection
+) {
+    Int32 PayloadLength = (Int32)ArrayGetElementCount(Connection->WriteBuffer);
+    if (PayloadLength < 1) return;
+
+    if ((Connection->Flags & IPC_SOCKET_CONNECTION_FLAGS_DISCONNECTED) || !Connection->Userdata) {
+        ArrayRemoveAllElements(Connection->WriteBuffer, true);
+        return;
+    }
+
+    UInt8* Payload = (UInt8*)ArrayGetElementAtIndex(Connection->WriteBuffer, 0);
+
+    // NOTE: A single packet is written as is, the frame header would only add overhead
+    if (((IPCPacketRef)Payload)->Length == PayloadLength) {
+        IPCSocketWrite(Socket, Connection, Payload, PayloadLength);
+        ArrayRemoveAllElements(Connection->WriteBuffer, true);
+        return;
+    }
+
+    IPCNodeContextRef NodeContext = (IPCNodeContextRef)Connection->Userdata;
+    Bool IsCompressed = (
+        (NodeContext->Capabilities & IPC_CAPABILITY_COMPRESSION) &&
+        PayloadLength >= IPC_SOCKET_COMPRESSION_THRESHOLD
+    );
+
+    Int32 DataCapacity = (IsCompressed) ? MAX(CompressionGetBound(PayloadLength), PayloadLength) : PayloadLength;
+    struct _IPCSocketConnectionWriteRequest* WriteRequest = IPCSocketCreateWriteRequest(Socket, Connection, sizeof(struct _IPCFrame) + DataCapacity);
+    IPCFrameRef Frame = (IPCFrameRef)WriteRequest->Buffer.base;
+    UInt8* Data = (UInt8*)WriteRequest->Buffer.base + sizeof(struct _IPCFrame);
+    Int32 DataLength = DataCapacity;
+
+    if (IsCompressed) {
+        IsCompressed = CompressionDeflate(Payload, PayloadLength, Data, &DataLength) && DataLength < PayloadLength;
+    }
+
+    if (!IsCompressed) {
+        memcpy(Data, Payload, PayloadLength);
+        DataLength = PayloadLength;
+    }
+
+    memset(Frame, 0, sizeof(struct _IPCFrame));
+    Frame->Header.Length = sizeof(struct _IPCFrame) + DataLength;
+    Frame->Header.Command = IPC_COMMAND_FRAME;
+    Frame->Header.SubCommand = (IsCompressed) ? IPC_FRAME_FLAGS_COMPRESSED : 0;
+    Frame->Header.RouteType = IPC_ROUTE_TYPE_UNICAST;
+    Frame->Header.Source = Socket->NodeID;
+    Frame->Header.Target = NodeContext->NodeID;
+    Frame->PayloadLength = PayloadLength;
+    WriteRequest->Buffer.len = Frame->Header.Length;
+    uv_write(&WriteRequest->Request, (uv_stream_t*)Connection->Handle, &WriteRequest->Buffer, 1, OnWrite);
+    ArrayRemoveAllElements(Connection->WriteBuffer, true);
+
+    MetricsCounterAdd("ipc_frames_sent", 1);
+    MetricsCounterAdd("ipc_frame_bytes_saved", PayloadLength - DataLength);
+}
+
+static Bool IPCSocketOnReceivedFrame(
+    IPCSocketRef Socket,
+    IPCSocketConnectionRef Connection,
+    IPCFrameRef Frame
+) {
+    if (Frame->Header.Length < sizeof(struct _IPCFrame)) return false;
+    if (Frame->PayloadLength > (UInt32)Socket->ReadBufferSize) return false;
+
+    Int32 DataLength = Frame->Header.Length - sizeof(struct _IPCFrame);
+    Int32 PayloadLength = Frame->PayloadLength;
+    UInt8* Payload = (UInt8*)Frame + sizeof(struct _IPCFrame);
+    if (Frame->Header.SubCommand & IPC_FRAME_FLAGS_COMPRESSED) {
+        if (!CompressionInflate(Payload, DataLength, Socket->FrameBuffer, PayloadLength)) return false;
+
+        Payload = Socket->FrameBuffer;
+    }
+    else if (DataLength != PayloadLength) {
+        return false;
+    }
+
+    Int32 Offset = 0;
+    while (Offset < PayloadLength) {
+        if (PayloadLength - Offset < sizeof(struct _IPCPacket)) return false;
+
+        IPCPacketRef Packet = (IPCPacketRef)(Payload + Offset);
+        if (Packet->Length < sizeof(struct _IPCPacket) || Packet->Length > (UInt32)(PayloadLength - Offset)) return false;
+        if (Packet->Command != IPC_COMMAND_ROUTE) return false;
+
+        IPCSocketOnReceived(Socket, Connection, Packet);
+        Offset += Packet->Length;
+    }
+
+    return true;
+}
+
+Void IPCSocketSend(
+    IPCSocketRef Socket,
+    IPCSocketConnectionRef Connection,
+    IPCPacketRef Packet
+) {
+    assert(Socket->State == IPC_SOCKET_STATE_CONNECTED);
+    assert(!(Connection->Flags & IPC_SOCKET_CONNECTION_FLAGS_DISCONNECTED));
+
+    if (Socket->LogPackets) IPCPacketLogBytes(Packet);
+
+    IPCNodeContextRef NodeContext = (IPCNodeContextRef)Connection->Userdata;
+    Bool IsFramed = (
+        Packet->Command == IPC_COMMAND_ROUTE &&
+        NodeContext &&
+        (NodeContext->Capabilities & IPC_CAPABILITY_FRAMES)
+    );
+    if (!IsFramed) {
+        IPCSocketWrite(Socket, Connection, (UInt8*)Packet, Packet->Length);
+        return;
+    }
+
+    // NOTE: Frames are bounded by the read buffers of both nodes as the payload is unpacked into the frame buffer of the receiver
+    Int32 FrameCapacity = MIN(Socket->ReadBufferSize, NodeContext->ReadBufferSize) - (Int32)sizeof(struct _IPCFrame);
+    if (ArrayGetElementCount(Connection->WriteBuffer) + Packet->Length > FrameCapacity) {
+        IPCSocketFlushConnection(Socket, Connection);
+    }
+
+    if (Packet->Length > (UInt32)FrameCapacity) {
+        IPCSocketWrite(Socket, Connection, (UInt8*)Packet, Packet->Length);
+        return;
+    }
+
+    ArrayAppendMemory(Connection->WriteBuffer, Packet, Packet->Length);
+}
+
 Void IPCSocketUnicast(
     IPCSocketRef Socket,
     Void* Packet
@@ -508,23 +795,23 @@ Void IPCSocketUnicast(
     IPCPacket->RouteType = IPC_ROUTE_TYPE_UNICAST;
 
     Bool IsHost = Socket->Host == NULL;
-    Int* ConnectionID = DictionaryLookup(Socket->NodeTable, &IPCPacket->Target);
-    if (ConnectionID) {
-        IPCSocketConnectionRef Connection = IPCSocketGetConnection(Socket, *ConnectionID);
-        if (Connection) {
-            assert(!(Connection->Flags & IPC_SOCKET_CONNECTION_FLAGS_DISCONNECTED));
-            IPCSocketSend(Socket, Connection, IPCPacket); 
-        }
+    IPCSocketConnectionRef Connection = IPCSocketGetNodeConnection(Socket, IPCPacket->Target);
+    if (Connection) {
+        IPCSocketSend(Socket, Connection, IPCPacket);
     }
-    else if (!IsHost) {
+    else if (IsHost) {
+        IPCSocketEnqueuePendingPacket(Socket, IPCPacket);
+    }
+    else {
+        // NOTE: A node only has its upstream connection to the master so unknown targets are routed through it
         IndexSetIteratorRef Iterator = IndexSetGetIterator(Socket->ConnectionIndices);
         while (Iterator) {
             Int ConnectionPoolIndex = Iterator->Value;
             Iterator = IndexSetIteratorNext(Socket->ConnectionIndices, Iterator);
 
-            IPCSocketConnectionRef Connection = (IPCSocketConnectionRef)MemoryPoolFetch(Socket->ConnectionPool, ConnectionPoolIndex);
-            assert(!(Connection->Flags & IPC_SOCKET_CONNECTION_FLAGS_DISCONNECTED));
-            IPCSocketSend(Socket, Connection, IPCPacket);
+            IPCSocketConnectionRef UpstreamConnection = (IPCSocketConnectionRef)MemoryPoolFetch(Socket->ConnectionPool, ConnectionPoolIndex);
+            assert(!(UpstreamConnection->Flags & IPC_SOCKET_CONNECTION_FLAGS_DISCONNECTED));
+            IPCSocketSend(Socket, UpstreamConnection, IPCPacket);
         }
     }
 }
@@ -566,7 +853,18 @@ Bool IPCSocketFetchReadBuffer(
 
         // TODO: Add error handling when packet is dropped or not fully received to meet the desired PacketLength
         if (MemoryBufferGetWriteOffset(Connection->ReadBuffer) >= Packet->Length) {
-            IPCSocketOnReceived(Socket, Connection, Packet);
+            if (Packet->Command == IPC_COMMAND_FRAME) {
+                if (!IPCSocketOnReceivedFrame(Socket, Connection, (IPCFrameRef)Packet)) {
+                    Error("Received malformed frame from ipc connection: %d", (Int32)Connection->ID);
+                    MemoryBufferClear(Connection->ReadBuffer);
+                    IPCSocketDisconnect(Socket, Connection);
+                    return false;
+                }
+            }
+            else {
+                IPCSocketOnReceived(Socket, Connection, Packet);
+            }
+
             MemoryBufferPopFront(Connection->ReadBuffer, Packet->Length);
         }
         else {
@@ -581,6 +879,15 @@ Void IPCSocketUpdate(
     IPCSocketRef Socket
 ) {
     uv_run(Socket->Loop, UV_RUN_NOWAIT);
+
+    if (ArrayGetElementCount(Socket->PendingPackets) > 0) IPCSocketFlushPendingPackets(Socket);
+
+    IndexSetIteratorRef Iterator = IndexSetGetIterator(Socket->ConnectionIndices);
+    while (Iterator) {
+        IPCSocketConnectionRef Connection = (IPCSocketConnectionRef)MemoryPoolFetch(Socket->ConnectionPool, Iterator->Value);
+        Iterator = IndexSetIteratorNext(Socket->ConnectionIndices, Iterator);
+        IPCSocketFlushConnection(Socket, Connection);
+    }
 }
 
 Void IPCSocketDisconnect(
@@ -598,6 +905,17 @@ Int IPCSocketGetConnectionCount(
     return IndexSetGetElementCount(Socket->ConnectionIndices);
 }
 
+IPCSocketConnectionRef IPCSocketGetNodeConnection(
+    IPCSocketRef Socket,
+    IPCNodeID NodeID
+) {
+    IPCSocketConnectionRef* NodeSlot = IPCSocketGetNodeDirectorySlot(Socket, NodeID, false);
+    if (!NodeSlot || !*NodeSlot) return NULL;
+    if ((*NodeSlot)->Flags & IPC_SOCKET_CONNECTION_FLAGS_DISCONNECTED) return NULL;
+
+    return *NodeSlot;
+}
+
 IPCSocketConnectionRef IPCSocketGetConnection(
     IPCSocketRef Socket,
     Int ConnectionID
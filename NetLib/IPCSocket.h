@@ -12,6 +12,11 @@ EXTERN_C_BEGIN
 #define IPC_SOCKET_RECONNECT_DELAY      1000
 #define IPC_SOCKET_RECV_BUFFER_SIZE     4096
 #define IPC_SOCKET_KEEP_ALIVE_TIMEOUT   10
+#define IPC_SOCKET_PENDING_TIMEOUT      5000
+#define IPC_SOCKET_MAX_PENDING_COUNT    1024
+#define IPC_NODE_DIRECTORY_GROUP_COUNT  256
+#define IPC_NODE_DIRECTORY_INDEX_COUNT  256
+#define IPC_SOCKET_COMPRESSION_THRESHOLD 1024
 
 enum {
     IPC_TYPE_ALL        = 0,
@@ -29,6 +34,19 @@ enum {
 enum {
     IPC_COMMAND_REGISTER    = 0,
     IPC_COMMAND_ROUTE       = 1,
+    IPC_COMMAND_FRAME       = 2,
+};
+
+// NOTE: Capabilities are advertised in the SubCommand of the register packet, older nodes always send 0
+enum {
+    IPC_CAPABILITY_FRAMES       = 1 << 0,
+    IPC_CAPABILITY_COMPRESSION  = 1 << 1,
+
+    IPC_CAPABILITY_ALL          = IPC_CAPABILITY_FRAMES | IPC_CAPABILITY_COMPRESSION,
+};
+
+enum {
+    IPC_FRAME_FLAGS_COMPRESSED  = 1 << 0,
 };
 
 enum {
@@ -39,6 +57,8 @@ enum {
 struct _IPCNodeContext {
     IPCNodeID NodeID;
     Int ConnectionID;
+    UInt32 Capabilities;
+    Int32 ReadBufferSize;
 };
 typedef struct _IPCNodeContext* IPCNodeContextRef;
 
@@ -54,6 +74,21 @@ struct _IPCPacket {
     // UInt8 Data[0];
 };
 typedef struct _IPCPacket* IPCPacketRef;
+
+// NOTE: The register packet appends the read buffer size of the node, older nodes only send the header
+struct _IPCRegisterPacket {
+    struct _IPCPacket Header;
+    Int32 ReadBufferSize;
+};
+typedef struct _IPCRegisterPacket* IPCRegisterPacketRef;
+
+// NOTE: A frame carries all route packets written to a connection in one loop iteration, the SubCommand holds the frame flags
+struct _IPCFrame {
+    struct _IPCPacket Header;
+    UInt32 PayloadLength;
+    // UInt8 Data[0];
+};
+typedef struct _IPCFrame* IPCFrameRef;
 typedef struct _IPCSocket* IPCSocketRef;
 typedef struct _IPCSocketConnection* IPCSocketConnectionRef;
 
@@ -96,6 +131,19 @@ typedef Void (*IPCSocketCommandCallback)(
 
 typedef Void* IPCSocketConnectionIteratorRef;
 
+struct _IPCSocketCommandSlot {
+    IPCSocketCommandCallback Callback;
+    UInt64 InvocationCount;
+    Timestamp HandlerDuration;
+};
+typedef struct _IPCSocketCommandSlot* IPCSocketCommandSlotRef;
+
+struct _IPCSocketPendingPacket {
+    Timestamp Timeout;
+    IPCPacketRef Packet;
+};
+typedef struct _IPCSocketPendingPacket* IPCSocketPendingPacketRef;
+
 struct _IPCSocket {
     AllocatorRef Allocator;
     IPCNodeID NodeID;
@@ -120,8 +168,12 @@ struct _IPCSocket {
     IndexSetRef ConnectionIndices;
     MemoryPoolRef ConnectionPool; 
     MemoryPoolRef ConnectionContextPool;
-    DictionaryRef CommandRegistry;
-    DictionaryRef NodeTable;
+    IPCSocketCommandSlotRef CommandSlots;
+    Int CommandSlotCount;
+    // NOTE: Registered nodes are resolved by Type, Group and Index, the group and index tables are allocated on first use
+    IPCSocketConnectionRef** NodeDirectory[IPC_TYPE_COUNT];
+    ArrayRef PendingPackets;
+    UInt8* FrameBuffer;
     Void* Userdata;
 };
 
@@ -138,6 +190,7 @@ struct _IPCSocketConnection {
     MemoryRef RecvBuffer;
     Int32 RecvBufferLength;
     MemoryBufferRef ReadBuffer;
+    ArrayRef WriteBuffer;
     Void* Userdata;
 };
 
@@ -167,6 +220,13 @@ Void IPCSocketRegisterCommandCallback(
     IPCSocketCommandCallback Callback
 );
 
+Bool IPCSocketGetCommandStatistics(
+    IPCSocketRef Socket,
+    Int Command,
+    UInt64* InvocationCount,
+    Timestamp* HandlerDuration
+);
+
 Void IPCSocketSend(
     IPCSocketRef Socket,
     IPCSocketConnectionRef Connection,
@@ -196,6 +256,11 @@ Int IPCSocketGetConnectionCount(
     IPCSocketRef Socket
 );
 
+IPCSocketConnectionRef IPCSocketGetNodeConnection(
+    IPCSocketRef Socket,
+    IPCNodeID NodeID
+);
+
 IPCSocketConnectionRef IPCSocketGetConnection(
     IPCSocketRef Socket,
     Int ConnectionID
@@ -0,0 +1,186 @@
+#include "MetricsSocket.h"
+
+struct _MetricsSocketConnection {
+    MetricsSocketRef Socket;
+    uv_tcp_t Handle;
+    uv_write_t WriteRequest;
+    uv_buf_t WriteBuffer;
+    Bool IsResponding;
+    Char ReadBuffer[METRICS_SOCKET_MAX_REQUEST_LENGTH];
+    Char Response[METRICS_SOCKET_MAX_RESPONSE_LENGTH];
+};
+typedef struct _MetricsSocketConnection* MetricsSocketConnectionRef;
+
+struct _MetricsSocket {
+    AllocatorRef Allocator;
+    uv_loop_t* Loop;
+    uv_tcp_t Handle;
+    Int32 ConnectionCount;
+    MetricsSocketWriteCallback OnWrite;
+    Void* Userdata;
+};
+
+static Void _MetricsSocketOnCloseConnection(
+    uv_handle_t* Handle
+) {
+    MetricsSocketConnectionRef Connection = (MetricsSocketConnectionRef)Handle->data;
+    Connection->Socket->ConnectionCount -= 1;
+    AllocatorDeallocate(Connection->Socket->Allocator, Connection);
+}
+
+static Void _MetricsSocketCloseConnection(
+    MetricsSocketConnectionRef Connection
+) {
+    if (uv_is_closing((uv_handle_t*)&Connection->Handle)) return;
+
+    uv_close((uv_handle_t*)&Connection->Handle, _MetricsSocketOnCloseConnection);
+}
+
+static Void _MetricsSocketOnWrite(
+    uv_write_t* WriteRequest,
+    Int32 Status
+) {
+    _MetricsSocketCloseConnection((MetricsSocketConnectionRef)WriteRequest->data);
+}
+
+static Void _MetricsSocketAllocateBuffer(
+    uv_handle_t* Handle,
+    size_t SuggestedSize,
+    uv_buf_t* Buffer
+) {
+    MetricsSocketConnectionRef Connection = (MetricsSocketConnectionRef)Handle->data;
+    Buffer->base = Connection->ReadBuffer;
+    Buffer->len = sizeof(Connection->ReadBuffer);
+}
+
+static Void _MetricsSocketOnRead(
+    uv_stream_t* Stream,
+    ssize_t ReadLength,
+    const uv_buf_t* Buffer
+) {
+    MetricsSocketConnectionRef Connection = (MetricsSocketConnectionRef)Stream->data;
+    if (ReadLength < 0) {
+        _MetricsSocketCloseConnection(Connection);
+        return;
+    }
+
+    // NOTE: There is only a single resource so the request itself is not parsed
+    if (ReadLength == 0 || Connection->IsResponding) return;
+
+    Connection->IsResponding = true;
+    uv_read_stop(Stream);
+
+    CString Header = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nConnection: close\r\n\r\n";
+    Int32 HeaderLength = (Int32)strlen(Header);
+    memcpy(Connection->Response, Header, HeaderLength);
+
+    Int32 BodyLength = MetricsWriteText(Connection->Response + HeaderLength, METRICS_SOCKET_MAX_RESPONSE_LENGTH - HeaderLength);
+    if (Connection->Socket->OnWrite) {
+        BodyLength += Connection->Socket->OnWrite(
+            Connection->Socket,
+            Connection->Response + HeaderLength + BodyLength,
+            METRICS_SOCKET_MAX_RESPONSE_LENGTH - HeaderLength - BodyLength,
+            Connection->Socket->Userdata
+        );
+    }
+
+    Connection->WriteBuffer = uv_buf_init(Connection->Response, HeaderLength + BodyLength);
+    Connection->WriteRequest.data = Connection;
+
+    Int32 Result = uv_write(&Connection->WriteRequest, Stream, &Connection->WriteBuffer, 1, _MetricsSocketOnWrite);
+    if (Result) _MetricsSocketCloseConnection(Connection);
+}
+
+static Void _MetricsSocketOnCloseRejected(
+    uv_handle_t* Handle
+) {
+    MetricsSocketRef Socket = (MetricsSocketRef)Handle->data;
+    AllocatorDeallocate(Socket->Allocator, Handle);
+}
+
+static Void _MetricsSocketOnNewConnection(
+    uv_stream_t* Stream,
+    Int32 Status
+) {
+    if (Status < 0) {
+        Error("Metrics socket new connection error: %s", uv_strerror(Status));
+        return;
+    }
+
+    MetricsSocketRef Socket = (MetricsSocketRef)Stream->data;
+
+    // NOTE: Pending connections have to be accepted, otherwise libuv stops reading the listen socket
+    if (Socket->ConnectionCount >= METRICS_SOCKET_MAX_CONNECTION_COUNT) {
+        uv_tcp_t* Handle = (uv_tcp_t*)AllocatorAllocate(Socket->Allocator, sizeof(uv_tcp_t));
+        if (!Handle) Fatal("Memory allocation failed!");
+
+        uv_tcp_init(Socket->Loop, Handle);
+        Handle->data = Socket;
+        uv_accept(Stream, (uv_stream_t*)Handle);
+        uv_close((uv_handle_t*)Handle, _MetricsSocketOnCloseRejected);
+        return;
+    }
+
+    MetricsSocketConnectionRef Connection = (MetricsSocketConnectionRef)AllocatorAllocate(Socket->Allocator, sizeof(struct _MetricsSocketConnection));
+    if (!Connection) Fatal("Memory allocation failed!");
+
+    Connection->Socket = Socket;
+    Connection->IsResponding = false;
+    Socket->ConnectionCount += 1;
+    uv_tcp_init(Socket->Loop, &Connection->Handle);
+    Connection->Handle.data = Connection;
+
+    if (uv_accept(Stream, (uv_stream_t*)&Connection->Handle)) {
+        _MetricsSocketCloseConnection(Connection);
+        return;
+    }
+
+    uv_read_start((uv_stream_t*)&Connection->Handle, _MetricsSocketAllocateBuffer, _MetricsSocketOnRead);
+}
+
+MetricsSocketRef MetricsSocketCreate(
+    AllocatorRef Allocator,
+    UInt16 Port,
+    MetricsSocketWriteCallback OnWrite,
+    Void* Userdata
+) {
+    MetricsSocketRef Socket = (MetricsSocketRef)AllocatorAllocate(Allocator, sizeof(struct _MetricsSocket));
+    if (!Socket) Fatal("Memory allocation failed!");
+
+    Socket->Allocator = Allocator;
+    Socket->Loop = uv_default_loop();
+    Socket->ConnectionCount = 0;
+    Socket->OnWrite = OnWrite;
+    Socket->Userdata = Userdata;
+    uv_tcp_init(Socket->Loop, &Socket->Handle);
+    Socket->Handle.data = Socket;
+
+    SocketAddress Address;
+    uv_ip4_addr("127.0.0.1", Port, &Address);
+
+    Int32 Result = uv_tcp_bind(&Socket->Handle, (const struct sockaddr*)&Address, 0);
+    if (Result) {
+        Fatal("Metrics socket binding failed: %s", uv_strerror(Result));
+    }
+
+    Result = uv_listen((uv_stream_t*)&Socket->Handle, METRICS_SOCKET_MAX_CONNECTION_COUNT, _MetricsSocketOnNewConnection);
+    if (Result) {
+        Fatal("Metrics socket listening failed: %s", uv_strerror(Result));
+    }
+
+    Info("Metrics socket started listening on port: %d", Port);
+    return Socket;
+}
+
+static Void _MetricsSocketOnClose(
+    uv_handle_t* Handle
+) {
+    MetricsSocketRef Socket = (MetricsSocketRef)Handle->data;
+    AllocatorDeallocate(Socket->Allocator, Socket);
+}
+
+Void MetricsSocketDestroy(
+    MetricsSocketRef Socket
+) {
+    uv_close((uv_handle_t*)&Socket->Handle, _MetricsSocketOnClose);
+}
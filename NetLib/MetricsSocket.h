@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Base.h"
+
+EXTERN_C_BEGIN
+
+#define METRICS_SOCKET_MAX_CONNECTION_COUNT     8
+#define METRICS_SOCKET_MAX_REQUEST_LENGTH       1024
+#define METRICS_SOCKET_MAX_RESPONSE_LENGTH      0x20000
+
+typedef struct _MetricsSocket* MetricsSocketRef;
+
+// NOTE: Appends metrics which are not kept in the registry to the response and returns the written length
+typedef Int32 (*MetricsSocketWriteCallback)(
+    MetricsSocketRef Socket,
+    CString Buffer,
+    Int32 Length,
+    Void* Userdata
+);
+
+// NOTE: Serves the metrics registry as plain text over http on the loopback interface, it is driven by the default loop of the server sockets
+MetricsSocketRef MetricsSocketCreate(
+    AllocatorRef Allocator,
+    UInt16 Port,
+    MetricsSocketWriteCallback OnWrite,
+    Void* Userdata
+);
+
+Void MetricsSocketDestroy(
+    MetricsSocketRef Socket
+);
+
+EXTERN_C_END
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <NetLib/IPCSocket.h>
+#include <NetLib/MetricsSocket.h>
 #include <NetLib/PacketBuffer.h>
 #include <NetLib/PacketSignature.h>
 #include <NetLib/Socket.h>
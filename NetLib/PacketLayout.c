@@ -3,6 +3,8 @@
 #define PACKET_MANAGER_GLOBAL_INSTANCE_NAME "_PacketManager"
 #define PACKET_MANAGER_GLOBAL_SOCKET_NAME "_Socket"
 #define PACKET_MANAGER_GLOBAL_SOCKET_CONNECTION_NAME "_SocketConnection"
+#define PACKET_VIEW_METATABLE_NAME "PacketView"
+#define PACKET_LAYOUT_MAX_FIELD_COUNT 64
 
 enum {
     PACKET_FIELD_TYPE_INT8,
@@ -53,8 +55,9 @@ struct _PacketField {
     Int Length;
     Int ChildIndex;
     Int CountIndex;
-    Int StackOffset;
+    Int Offset;
     Int ArrayIndex;
+    Int32 NameReference;
     Char Name[MAX_PATH];
 };
 
@@ -62,11 +65,22 @@ struct _PacketLayout {
     PacketManagerRef Manager;
     Int Index;
     Bool IsIntrinsic;
+    Int FixedSize;
     Char Name[MAX_PATH];
     ArrayRef Fields;
     DictionaryRef NameToField;
 };
 
+struct _PacketView {
+    PacketLayoutRef Layout;
+    UInt8* Buffer;
+    Int Offset;
+    Int Length;
+    Int Count;
+    UInt32 Generation;
+};
+typedef struct _PacketView* PacketViewRef;
+
 struct _PacketHandler {
     Int Command;
     Int LayoutIndex;
@@ -79,7 +93,9 @@ struct _PacketManager {
     lua_State* State;
     ArrayRef PacketLayouts;
     DictionaryRef NameToPacketLayout;
-    DictionaryRef CommandToPacketHandler;
+    ArrayRef PacketHandlers;
+    Int32 RootViewReference;
+    UInt32 ViewGeneration;
 };
 
 Void PacketManagerRegisterScriptAPI(
@@ -91,12 +107,17 @@ Void PacketLayoutWriteZero(
     PacketBufferRef PacketBuffer
 );
 
-Bool PacketLayoutParse(
+Bool PacketLayoutMeasure(
     PacketLayoutRef PacketLayout,
     UInt8* Buffer,
-    Int* OutOffset,
+    Int Offset,
     Int Length,
-    lua_State* State
+    Int* FieldOffsets,
+    Int* OutSize
+);
+
+Void PacketManagerRegisterViewAPI(
+    PacketManagerRef PacketManager
 );
 
 Void PacketManagerRegisterIntrinsics(
@@ -141,9 +162,11 @@ PacketManagerRef PacketManagerCreate(
     
     PacketManager->PacketLayouts = ArrayCreateEmpty(Allocator, sizeof(struct _PacketLayout), 8);
     PacketManager->NameToPacketLayout = CStringDictionaryCreate(Allocator, 8);
-    PacketManager->CommandToPacketHandler = IndexDictionaryCreate(Allocator, 8);
+    PacketManager->PacketHandlers = ArrayCreateEmpty(Allocator, sizeof(struct _PacketHandler), 8);
+    PacketManager->ViewGeneration = 0;
     PacketManagerRegisterIntrinsics(PacketManager);
     PacketManagerRegisterScriptAPI(PacketManager);
+    PacketManagerRegisterViewAPI(PacketManager);
     return PacketManager;
 }
 
@@ -158,7 +181,7 @@ Void PacketManagerDestroy(
         ArrayDestroy(PacketLayout->Fields);
     }
     
-    DictionaryDestroy(PacketManager->CommandToPacketHandler);
+    ArrayDestroy(PacketManager->PacketHandlers);
     DictionaryDestroy(PacketManager->NameToPacketLayout);
     ArrayDestroy(PacketManager->PacketLayouts);
     AllocatorDeallocate(PacketManager->Allocator, PacketManager);
@@ -183,6 +206,7 @@ PacketLayoutRef PacketManagerRegisterLayout(
     memset(PacketLayout, 0, sizeof(struct _PacketLayout));
     PacketLayout->Manager = PacketManager;
     PacketLayout->Index = PacketLayoutIndex;
+    PacketLayout->FixedSize = 0;
     strcpy(PacketLayout->Name, Name);
     PacketLayout->Fields = ArrayCreateEmpty(PacketManager->Allocator, sizeof(struct _PacketField), 8);
     PacketLayout->NameToField = CStringDictionaryCreate(PacketManager->Allocator, 8);
@@ -220,20 +244,53 @@ PacketLayoutRef PacketManagerGetLayout(
     return PacketManagerGetLayoutByIndex(PacketManager, Index);
 }
 
+Int PacketManagerGetHandlerCount(
+    PacketManagerRef PacketManager
+) {
+    return ArrayGetElementCount(PacketManager->PacketHandlers);
+}
+
+Int PacketManagerGetHandlerCommand(
+    PacketManagerRef PacketManager,
+    Int HandlerIndex
+) {
+    PacketHandlerRef PacketHandler = (PacketHandlerRef)ArrayGetElementAtIndex(PacketManager->PacketHandlers, HandlerIndex);
+    return PacketHandler->Command;
+}
+
+Int PacketManagerGetHandlerIndex(
+    PacketManagerRef PacketManager,
+    Int Command
+) {
+    for (Int Index = 0; Index < ArrayGetElementCount(PacketManager->PacketHandlers); Index += 1) {
+        PacketHandlerRef PacketHandler = (PacketHandlerRef)ArrayGetElementAtIndex(PacketManager->PacketHandlers, Index);
+        if (PacketHandler->Command == Command) return Index;
+    }
+
+    return -1;
+}
+
 Int32 PacketManagerHandle(
     PacketManagerRef PacketManager,
     SocketRef Socket,
     SocketConnectionRef SocketConnection,
-    Int Command,
+    Int HandlerIndex,
     UInt8* Buffer,
     Int32 Length
 ) {
-    PacketHandlerRef PacketHandler = DictionaryLookup(PacketManager->CommandToPacketHandler, &Command);
-    if (!PacketHandler) return 0;
+    if (HandlerIndex < 0 || HandlerIndex >= ArrayGetElementCount(PacketManager->PacketHandlers)) return 0;
+
+    PacketHandlerRef PacketHandler = (PacketHandlerRef)ArrayGetElementAtIndex(PacketManager->PacketHandlers, HandlerIndex);
     
     PacketLayoutRef PacketLayout = PacketManagerGetLayoutByIndex(PacketManager, PacketHandler->LayoutIndex);
     if (!PacketLayout) return 0;
     
+    Int PacketSize = 0;
+    if (!PacketLayoutMeasure(PacketLayout, Buffer, 0, Length, NULL, &PacketSize)) {
+        Error("Received misaligned packet for layout '%s'", PacketLayout->Name);
+        return -1;
+    }
+
     Int StateStack = lua_gettop(PacketManager->State);
 
     lua_pushlightuserdata(PacketManager->State, Socket);
@@ -244,16 +301,21 @@ Int32 PacketManagerHandle(
 
     lua_rawgeti(PacketManager->State, LUA_REGISTRYINDEX, PacketHandler->Handler);
 
-    Int Offset = 0;
-    Bool Success = PacketLayoutParse(PacketLayout, Buffer, &Offset, Length, PacketManager->State);
-    if (!Success) {
-        lua_settop(PacketManager->State, StateStack);
-        return -1;
-    }
+    // NOTE: The root view is reused for every packet, views are invalidated by bumping the generation after the handler returns
+    PacketManager->ViewGeneration += 1;
+    lua_rawgeti(PacketManager->State, LUA_REGISTRYINDEX, PacketManager->RootViewReference);
+    PacketViewRef PacketView = (PacketViewRef)lua_touserdata(PacketManager->State, -1);
+    PacketView->Layout = PacketLayout;
+    PacketView->Buffer = Buffer;
+    PacketView->Offset = 0;
+    PacketView->Length = Length;
+    PacketView->Count = -1;
+    PacketView->Generation = PacketManager->ViewGeneration;
 
     Int ArgumentCount = 1;
     Int ReturnValueCount = 0;
     Int Result = lua_pcall(PacketManager->State, ArgumentCount, ReturnValueCount, 0);
+    PacketManager->ViewGeneration += 1;
     if (Result != LUA_OK) {
         CString Message = (CString)lua_tostring(PacketManager->State, -1);
         Error("Lua error: %s", Message);
@@ -325,6 +387,11 @@ PacketFieldRef PacketLayoutAddField(
         Fatal("Packet field with name '%s' already registered!", Name);
         return NULL;
     }
+
+    if (ArrayGetElementCount(PacketLayout->Fields) >= PACKET_LAYOUT_MAX_FIELD_COUNT) {
+        Fatal("Packet layout '%s' exceeds the maximum field count!", PacketLayout->Name);
+        return NULL;
+    }
     
     Int PacketFieldIndex = ArrayGetElementCount(PacketLayout->Fields);
     PacketFieldRef PacketField = (PacketFieldRef)ArrayAppendUninitializedElement(PacketLayout->Fields);
@@ -335,9 +402,24 @@ PacketFieldRef PacketLayoutAddField(
     PacketField->ChildIndex = ChildIndex;
     PacketField->CountIndex = CountIndex;
     strcpy(PacketField->Name, Name);
-    PacketField->StackOffset = 0;
     PacketField->ArrayIndex = -1;
 
+    lua_pushstring(PacketLayout->Manager->State, Name);
+    PacketField->NameReference = luaL_ref(PacketLayout->Manager->State, LUA_REGISTRYINDEX);
+
+    // NOTE: Fields are assigned a constant offset as long as all preceding fields have a fixed size
+    Int FieldSize = -1;
+    if (Type == PACKET_FIELD_TYPE_STATIC_ARRAY) {
+        PacketLayoutRef ChildLayout = PacketManagerGetLayoutByIndex(PacketLayout->Manager, ChildIndex);
+        if (ChildLayout->FixedSize >= 0) FieldSize = Length * ChildLayout->FixedSize;
+    }
+    else if (Type != PACKET_FIELD_TYPE_STRING && Type != PACKET_FIELD_TYPE_DYNAMIC_ARRAY && CountIndex < 0) {
+        FieldSize = Length;
+    }
+
+    PacketField->Offset = PacketLayout->FixedSize;
+    PacketLayout->FixedSize = (PacketLayout->FixedSize >= 0 && FieldSize >= 0) ? PacketLayout->FixedSize + FieldSize : -1;
+
     DictionaryInsert(PacketLayout->NameToField, Name, &PacketFieldIndex, sizeof(Int));
     return PacketField;
 }
@@ -346,7 +428,10 @@ PacketFieldRef PacketLayoutGetField(
     PacketLayoutRef PacketLayout,
     CString Name
 ) {
-    return (PacketFieldRef)DictionaryLookup(PacketLayout->NameToField, Name);
+    Int* PacketFieldIndex = (Int*)DictionaryLookup(PacketLayout->NameToField, Name);
+    if (!PacketFieldIndex) return NULL;
+
+    return (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, *PacketFieldIndex);
 }
 
 Void PacketLayoutAddInt8(
@@ -455,7 +540,7 @@ Void PacketLayoutAddStaticArray(
     Int ChildIndex = PacketManagerGetLayoutIndex(PacketLayout->Manager, ChildName);
     if (ChildIndex == UINT64_MAX) Fatal("Packet layout named '%s' not found!", ChildName);
 
-    PacketLayoutAddField(PacketLayout, Name, PACKET_FIELD_TYPE_STATIC_ARRAY, Count, ChildIndex, 0);
+    PacketLayoutAddField(PacketLayout, Name, PACKET_FIELD_TYPE_STATIC_ARRAY, Count, ChildIndex, -1);
 }
 
 Void PacketLayoutAddDynamicArray(
@@ -494,35 +579,35 @@ lua_Integer PacketFieldReadPrimitive(
 ) {
     lua_Integer Result = 0;
     if (PacketField->Type == PACKET_FIELD_TYPE_INT8) {
-        Result = *((Int8*)&Buffer[PacketField->StackOffset]);
+        Result = *((Int8*)Buffer);
     }
     
     if (PacketField->Type == PACKET_FIELD_TYPE_INT16) {
-        Result = *((Int16*)&Buffer[PacketField->StackOffset]);
+        Result = *((Int16*)Buffer);
     }
     
     if (PacketField->Type == PACKET_FIELD_TYPE_INT32) {
-        Result = *((Int32*)&Buffer[PacketField->StackOffset]);
+        Result = *((Int32*)Buffer);
     }
     
     if (PacketField->Type == PACKET_FIELD_TYPE_INT64) {
-        Result = *((Int64*)&Buffer[PacketField->StackOffset]);
+        Result = *((Int64*)Buffer);
     }
     
     if (PacketField->Type == PACKET_FIELD_TYPE_UINT8) {
-        Result = *((UInt8*)&Buffer[PacketField->StackOffset]);
+        Result = *((UInt8*)Buffer);
     }
     
     if (PacketField->Type == PACKET_FIELD_TYPE_UINT16) {
-        Result = *((UInt16*)&Buffer[PacketField->StackOffset]);
+        Result = *((UInt16*)Buffer);
     }
     
     if (PacketField->Type == PACKET_FIELD_TYPE_UINT32) {
-        Result = *((UInt32*)&Buffer[PacketField->StackOffset]);
+        Result = *((UInt32*)Buffer);
     }
     
     if (PacketField->Type == PACKET_FIELD_TYPE_UINT64) {
-        Result = *((UInt64*)&Buffer[PacketField->StackOffset]);
+        Result = *((UInt64*)Buffer);
     }
     
     return Result;
@@ -612,7 +697,7 @@ Void PacketFieldWriteZero(
     }
 
     if (PacketField->Type == PACKET_FIELD_TYPE_STATIC_ARRAY) {
-        PacketLayoutRef ChildLayout = (PacketLayoutRef)ArrayGetElementAtIndex(PacketLayout->Fields, PacketField->ChildIndex);
+        PacketLayoutRef ChildLayout = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
         Int ChildSize = PacketLayoutGetSize(ChildLayout);
         PacketBufferAppend(PacketBuffer, PacketField->Length * ChildSize);
     }
@@ -631,113 +716,285 @@ Void PacketLayoutWriteZero(
     }
 }
 
-Bool PacketLayoutParse(
+Bool PacketFieldIsPrimitive(
+    PacketFieldRef PacketField
+) {
+    return (
+        PacketField->Type == PACKET_FIELD_TYPE_INT8 ||
+        PacketField->Type == PACKET_FIELD_TYPE_INT16 ||
+        PacketField->Type == PACKET_FIELD_TYPE_INT32 ||
+        PacketField->Type == PACKET_FIELD_TYPE_INT64 ||
+        PacketField->Type == PACKET_FIELD_TYPE_UINT8 ||
+        PacketField->Type == PACKET_FIELD_TYPE_UINT16 ||
+        PacketField->Type == PACKET_FIELD_TYPE_UINT32 ||
+        PacketField->Type == PACKET_FIELD_TYPE_UINT64
+    );
+}
+
+Bool PacketLayoutMeasureArray(
+    PacketLayoutRef ChildLayout,
+    UInt8* Buffer,
+    Int Offset,
+    Int Length,
+    Int Count,
+    Int* OutSize
+) {
+    if (Count < 0) return false;
+
+    if (ChildLayout->FixedSize >= 0) {
+        *OutSize = Count * ChildLayout->FixedSize;
+        return true;
+    }
+
+    Int Size = 0;
+    for (Int Index = 0; Index < Count; Index += 1) {
+        Int ChildSize = 0;
+        if (!PacketLayoutMeasure(ChildLayout, Buffer, Offset + Size, Length, NULL, &ChildSize)) return false;
+
+        Size += ChildSize;
+    }
+
+    *OutSize = Size;
+    return true;
+}
+
+Bool PacketLayoutMeasure(
     PacketLayoutRef PacketLayout,
     UInt8* Buffer,
-    Int* OutOffset,
+    Int Offset,
     Int Length,
-    lua_State* State
+    Int* FieldOffsets,
+    Int* OutSize
 ) {
-    lua_newtable(State);
+    Int FieldCount = ArrayGetElementCount(PacketLayout->Fields);
 
-    for (Int Index = 0; Index < ArrayGetElementCount(PacketLayout->Fields); Index += 1) {
-        PacketFieldRef PacketField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, Index);
-        PacketField->StackOffset = *OutOffset;
-        
-        Int32 FieldLength = (Int32)PacketField->Length;
-        if (PacketField->StackOffset + FieldLength > Length) {
-            Error("Received misaligned packet for layout '%s'", PacketLayout->Name);
-            return false;
-        }
-        
-        lua_pushstring(State, PacketField->Name);
+    if (PacketLayout->FixedSize >= 0) {
+        if (Offset + PacketLayout->FixedSize > Length) return false;
 
-        if (
-            PacketField->Type == PACKET_FIELD_TYPE_INT8 ||
-            PacketField->Type == PACKET_FIELD_TYPE_INT16 ||
-            PacketField->Type == PACKET_FIELD_TYPE_INT32 ||
-            PacketField->Type == PACKET_FIELD_TYPE_INT64 ||
-            PacketField->Type == PACKET_FIELD_TYPE_UINT8 ||
-            PacketField->Type == PACKET_FIELD_TYPE_UINT16 ||
-            PacketField->Type == PACKET_FIELD_TYPE_UINT32 ||
-            PacketField->Type == PACKET_FIELD_TYPE_UINT64
-        ) {
-            lua_Integer Value = PacketFieldReadPrimitive(PacketField, Buffer);
-            lua_pushinteger(State, (lua_Integer)Value);
+        if (FieldOffsets) {
+            for (Int Index = 0; Index < FieldCount; Index += 1) {
+                PacketFieldRef PacketField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, Index);
+                FieldOffsets[Index] = Offset + PacketField->Offset;
+            }
         }
-        
+
+        *OutSize = PacketLayout->FixedSize;
+        return true;
+    }
+
+    Int Offsets[PACKET_LAYOUT_MAX_FIELD_COUNT] = { 0 };
+    Int Cursor = Offset;
+    for (Int Index = 0; Index < FieldCount; Index += 1) {
+        PacketFieldRef PacketField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, Index);
+        Offsets[Index] = Cursor;
+
+        Int FieldSize = PacketField->Length;
         if (PacketField->Type == PACKET_FIELD_TYPE_STRING) {
-            Char* Value = (Char*)&Buffer[PacketField->StackOffset];
-            FieldLength = (Int32)strlen(Value);
-            if (PacketField->StackOffset + FieldLength > Length) {
-                Error("Received misaligned packet for layout '%s'", PacketLayout->Name);
-                return false;
+            if (Cursor >= Length) return false;
+
+            Char* Terminator = (Char*)memchr(&Buffer[Cursor], 0, Length - Cursor);
+            if (!Terminator) return false;
+
+            FieldSize = (Int)(Terminator - (Char*)&Buffer[Cursor]) + 1;
+        }
+        else if (PacketField->Type == PACKET_FIELD_TYPE_CHARACTERS && PacketField->CountIndex >= 0) {
+            PacketFieldRef CountField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, PacketField->CountIndex);
+            FieldSize = (Int)PacketFieldReadPrimitive(CountField, &Buffer[Offsets[PacketField->CountIndex]]);
+        }
+        else if (PacketField->Type == PACKET_FIELD_TYPE_STATIC_ARRAY || PacketField->Type == PACKET_FIELD_TYPE_DYNAMIC_ARRAY) {
+            PacketLayoutRef ChildLayout = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
+            Int Count = PacketField->Length;
+            if (PacketField->Type == PACKET_FIELD_TYPE_DYNAMIC_ARRAY) {
+                PacketFieldRef CountField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, PacketField->CountIndex);
+                Count = (Int)PacketFieldReadPrimitive(CountField, &Buffer[Offsets[PacketField->CountIndex]]);
             }
 
-            lua_pushstring(State, Value);
+            if (!PacketLayoutMeasureArray(ChildLayout, Buffer, Cursor, Length, Count, &FieldSize)) return false;
         }
-        
-        if (PacketField->Type == PACKET_FIELD_TYPE_CHARACTERS) {
-            // TODO: We should do a memcpy here and append a trailing zero manually based on the length
-            Char* Value = ((Char*)&Buffer[PacketField->StackOffset]);
-            lua_pushstring(State, Value);
 
-            if (PacketField->CountIndex >= 0) {
-                PacketField->Length = strlen(Value);
+        if (FieldSize < 0 || Cursor + FieldSize > Length) return false;
 
-                PacketFieldRef CountField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, PacketField->CountIndex);
+        Cursor += FieldSize;
+    }
 
-                lua_settable(State, -3);
-                lua_pushstring(State, CountField->Name);
-                assert(
-                    PacketField->Type == PACKET_FIELD_TYPE_INT8 ||
-                    PacketField->Type == PACKET_FIELD_TYPE_INT16 ||
-                    PacketField->Type == PACKET_FIELD_TYPE_INT32 ||
-                    PacketField->Type == PACKET_FIELD_TYPE_INT64 ||
-                    PacketField->Type == PACKET_FIELD_TYPE_UINT8 ||
-                    PacketField->Type == PACKET_FIELD_TYPE_UINT16 ||
-                    PacketField->Type == PACKET_FIELD_TYPE_UINT32 ||
-                    PacketField->Type == PACKET_FIELD_TYPE_UINT64
-                );
-                lua_pushinteger(State, (lua_Integer)PacketField->Length);
-            }
+    if (FieldOffsets) memcpy(FieldOffsets, Offsets, sizeof(Int) * FieldCount);
+
+    *OutSize = Cursor - Offset;
+    return true;
+}
+
+static PacketViewRef PacketViewCheck(
+    lua_State* State,
+    Int32 Index
+) {
+    PacketViewRef PacketView = (PacketViewRef)luaL_checkudata(State, Index, PACKET_VIEW_METATABLE_NAME);
+    if (PacketView->Generation != PacketView->Layout->Manager->ViewGeneration) {
+        luaL_error(State, "Packet view of layout '%s' accessed outside of its handler!", PacketView->Layout->Name);
+        return NULL;
+    }
+
+    return PacketView;
+}
+
+static Void PacketViewPush(
+    lua_State* State,
+    PacketViewRef Parent,
+    PacketLayoutRef PacketLayout,
+    Int Offset,
+    Int Count
+) {
+    PacketViewRef PacketView = (PacketViewRef)lua_newuserdata(State, sizeof(struct _PacketView));
+    PacketView->Layout = PacketLayout;
+    PacketView->Buffer = Parent->Buffer;
+    PacketView->Offset = Offset;
+    PacketView->Length = Parent->Length;
+    PacketView->Count = Count;
+    PacketView->Generation = Parent->Generation;
+    luaL_setmetatable(State, PACKET_VIEW_METATABLE_NAME);
+}
+
+static Int32 PacketViewIndexArray(
+    lua_State* State,
+    PacketViewRef PacketView
+) {
+    if (!lua_isinteger(State, 2)) return 0;
+
+    Int ElementIndex = (Int)lua_tointeger(State, 2) - 1;
+    if (ElementIndex < 0 || ElementIndex >= PacketView->Count) return 0;
+
+    PacketLayoutRef ChildLayout = PacketView->Layout;
+    Int Offset = PacketView->Offset;
+    if (ChildLayout->FixedSize >= 0) {
+        Offset += ElementIndex * ChildLayout->FixedSize;
+    }
+    else {
+        for (Int Index = 0; Index < ElementIndex; Index += 1) {
+            Int ChildSize = 0;
+            PacketLayoutMeasure(ChildLayout, PacketView->Buffer, Offset, PacketView->Length, NULL, &ChildSize);
+            Offset += ChildSize;
         }
-        
-        if (PacketField->Type == PACKET_FIELD_TYPE_STATIC_ARRAY) {
-            PacketLayoutRef Child = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
-           
-            lua_createtable(State, (Int32)PacketField->Length, 0);
-            for (Int ChildIndex = 0; ChildIndex < PacketField->Length; ChildIndex += 1) {
-                lua_pushinteger(State, (lua_Integer)ChildIndex + 1);
-                if (!PacketLayoutParse(Child, Buffer, OutOffset, Length, State)) return false;
-
-                lua_settable(State, -3);
-            }
-            
-            FieldLength = 0;
+    }
+
+    if (ChildLayout->IsIntrinsic) {
+        PacketFieldRef PacketField = (PacketFieldRef)ArrayGetElementAtIndex(ChildLayout->Fields, 0);
+        lua_pushinteger(State, PacketFieldReadPrimitive(PacketField, &PacketView->Buffer[Offset]));
+        return 1;
+    }
+
+    PacketViewPush(State, PacketView, ChildLayout, Offset, -1);
+    return 1;
+}
+
+static Int32 PacketViewIndex(
+    lua_State* State
+) {
+    PacketViewRef PacketView = PacketViewCheck(State, 1);
+    if (PacketView->Count >= 0) return PacketViewIndexArray(State, PacketView);
+
+    CString Name = (CString)lua_tostring(State, 2);
+    if (!Name) return 0;
+
+    PacketLayoutRef PacketLayout = PacketView->Layout;
+    PacketFieldRef PacketField = PacketLayoutGetField(PacketLayout, Name);
+    if (!PacketField) return 0;
+
+    // NOTE: The packet has been validated by PacketLayoutMeasure before the handler got called, so the offsets are in bounds
+    Int Offsets[PACKET_LAYOUT_MAX_FIELD_COUNT] = { 0 };
+    if (PacketField->Offset >= 0) {
+        for (Int Index = 0; Index <= PacketField->Index; Index += 1) {
+            PacketFieldRef Field = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, Index);
+            Offsets[Index] = PacketView->Offset + Field->Offset;
         }
-        
-        if (PacketField->Type == PACKET_FIELD_TYPE_DYNAMIC_ARRAY) {
-            // TODO: Add support for automatic counting!
-            PacketLayoutRef Child = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
-            PacketFieldRef CountField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, PacketField->CountIndex);
-            Int32 Count = (Int32)PacketFieldReadPrimitive(CountField, Buffer);
-            
-            lua_createtable(State, Count, 0);
-            for (Int ChildIndex = 0; ChildIndex < Count; ChildIndex += 1) {
-                lua_pushinteger(State, (lua_Integer)ChildIndex + 1);
-                if (!PacketLayoutParse(Child, Buffer, OutOffset, Length, State)) return false;
+    }
+    else {
+        Int Size = 0;
+        PacketLayoutMeasure(PacketLayout, PacketView->Buffer, PacketView->Offset, PacketView->Length, Offsets, &Size);
+    }
 
-                lua_settable(State, -3);
-            }
-            
-            FieldLength = 0;
+    Int Offset = Offsets[PacketField->Index];
+
+    UInt8* Memory = &PacketView->Buffer[Offset];
+    if (PacketFieldIsPrimitive(PacketField)) {
+        lua_pushinteger(State, PacketFieldReadPrimitive(PacketField, Memory));
+        return 1;
+    }
+
+    if (PacketField->Type == PACKET_FIELD_TYPE_STRING) {
+        lua_pushstring(State, (CString)Memory);
+        return 1;
+    }
+
+    if (PacketField->Type == PACKET_FIELD_TYPE_CHARACTERS) {
+        Int Count = PacketField->Length;
+        if (PacketField->CountIndex >= 0) {
+            PacketFieldRef CountField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, PacketField->CountIndex);
+            Count = (Int)PacketFieldReadPrimitive(CountField, &PacketView->Buffer[Offsets[CountField->Index]]);
         }
-        
-        lua_settable(State, -3);
-        *OutOffset += FieldLength;
+
+        lua_pushlstring(State, (CString)Memory, strnlen((CString)Memory, Count));
+        return 1;
     }
-    
+
+    PacketLayoutRef ChildLayout = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
+    Int Count = PacketField->Length;
+    if (PacketField->Type == PACKET_FIELD_TYPE_DYNAMIC_ARRAY) {
+        PacketFieldRef CountField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, PacketField->CountIndex);
+        Count = (Int)PacketFieldReadPrimitive(CountField, &PacketView->Buffer[Offsets[CountField->Index]]);
+    }
+
+    PacketViewPush(State, PacketView, ChildLayout, Offset, Count);
+    return 1;
+}
+
+static Int32 PacketViewLength(
+    lua_State* State
+) {
+    PacketViewRef PacketView = PacketViewCheck(State, 1);
+    Int Count = (PacketView->Count >= 0) ? PacketView->Count : ArrayGetElementCount(PacketView->Layout->Fields);
+    lua_pushinteger(State, (lua_Integer)Count);
+    return 1;
+}
+
+Void PacketManagerRegisterViewAPI(
+    PacketManagerRef PacketManager
+) {
+    luaL_newmetatable(PacketManager->State, PACKET_VIEW_METATABLE_NAME);
+    lua_pushcfunction(PacketManager->State, PacketViewIndex);
+    lua_setfield(PacketManager->State, -2, "__index");
+    lua_pushcfunction(PacketManager->State, PacketViewLength);
+    lua_setfield(PacketManager->State, -2, "__len");
+    lua_pop(PacketManager->State, 1);
+
+    PacketViewRef PacketView = (PacketViewRef)lua_newuserdata(PacketManager->State, sizeof(struct _PacketView));
+    memset(PacketView, 0, sizeof(struct _PacketView));
+    luaL_setmetatable(PacketManager->State, PACKET_VIEW_METATABLE_NAME);
+    PacketManager->RootViewReference = luaL_ref(PacketManager->State, LUA_REGISTRYINDEX);
+}
+
+static PacketViewRef PacketViewTest(
+    lua_State* State,
+    Int32 Index
+) {
+    if (!luaL_testudata(State, Index, PACKET_VIEW_METATABLE_NAME)) return NULL;
+
+    return PacketViewCheck(State, Index);
+}
+
+// NOTE: Views have been validated on receive, so a view of the same layout is copied as raw bytes instead of being encoded field by field
+static Bool PacketViewEncode(
+    PacketViewRef PacketView,
+    PacketLayoutRef PacketLayout,
+    PacketBufferRef PacketBuffer
+) {
+    if (PacketView->Layout->Index != PacketLayout->Index) return false;
+
+    Int Size = 0;
+    Bool Success = (PacketView->Count >= 0)
+        ? PacketLayoutMeasureArray(PacketLayout, PacketView->Buffer, PacketView->Offset, PacketView->Length, PacketView->Count, &Size)
+        : PacketLayoutMeasure(PacketLayout, PacketView->Buffer, PacketView->Offset, PacketView->Length, NULL, &Size);
+    if (!Success) return false;
+
+    PacketBufferAppendCopy(PacketBuffer, &PacketView->Buffer[PacketView->Offset], Size);
     return true;
 }
 
@@ -764,6 +1021,15 @@ Bool PacketLayoutEncode(
         return true;
     }
 
+    PacketViewRef PacketView = PacketViewTest(State, -1);
+    if (PacketView && PacketView->Count < 0) {
+        Bool Success = PacketViewEncode(PacketView, PacketLayout, PacketBuffer);
+        if (!Success) Error("Invalid view of layout '%s' given for layout '%s'", PacketView->Layout->Name, PacketLayout->Name);
+
+        lua_pop(State, 1);
+        return Success;
+    }
+
     if (!lua_istable(State, -1)) {
         return false;
     }
@@ -774,15 +1040,17 @@ Bool PacketLayoutEncode(
         if (PacketField->ArrayIndex >= 0) {
             PacketFieldRef ArrayField = (PacketFieldRef)ArrayGetElementAtIndex(PacketLayout->Fields, PacketField->ArrayIndex);
             
-            lua_pushstring(State, ArrayField->Name);
+            lua_rawgeti(State, LUA_REGISTRYINDEX, ArrayField->NameReference);
             lua_gettable(State, -2);
-            if (ArrayField->Type == PACKET_FIELD_TYPE_DYNAMIC_ARRAY && lua_istable(State, -1)) {
+            PacketViewRef ArrayView = PacketViewTest(State, -1);
+            if (ArrayField->Type == PACKET_FIELD_TYPE_DYNAMIC_ARRAY && ArrayView && ArrayView->Count >= 0) {
+                PacketFieldWritePrimitive(PacketField, PacketBuffer, (lua_Integer)ArrayView->Count);
+            }
+            else if (ArrayField->Type == PACKET_FIELD_TYPE_DYNAMIC_ARRAY && lua_istable(State, -1)) {
                 PacketFieldWritePrimitive(PacketField, PacketBuffer, luaL_len(State, -1));
             }
             else if (ArrayField->Type == PACKET_FIELD_TYPE_CHARACTERS && lua_isstring(State, -1)) {
-                CString Value = (CString)lua_tostring(State, -1);
-                ArrayField->Length = strlen(Value);
-                PacketFieldWritePrimitive(PacketField, PacketBuffer, ArrayField->Length);
+                PacketFieldWritePrimitive(PacketField, PacketBuffer, (lua_Integer)lua_rawlen(State, -1));
             }
             else {
                 PacketFieldWritePrimitive(PacketField, PacketBuffer, 0);
@@ -792,7 +1060,7 @@ Bool PacketLayoutEncode(
             continue;
         }
 
-        lua_pushstring(State, PacketField->Name);
+        lua_rawgeti(State, LUA_REGISTRYINDEX, PacketField->NameReference);
         lua_gettable(State, -2);
 
         if (lua_isnil(State, -1)) {
@@ -843,23 +1111,35 @@ Bool PacketLayoutEncode(
                 return false;
             }
 
-            CString Value = (CString)lua_tostring(State, -1);
-            CString Memory = (CString)PacketBufferAppend(PacketBuffer, PacketField->Length);
-            memcpy(Memory, Value, MIN(PacketField->Length, strlen(Value)));
+            size_t ValueLength = 0;
+            CString Value = (CString)lua_tolstring(State, -1, &ValueLength);
+            Int Length = (PacketField->CountIndex >= 0) ? (Int)ValueLength : PacketField->Length;
+            CString Memory = (CString)PacketBufferAppend(PacketBuffer, Length);
+            memcpy(Memory, Value, MIN(Length, (Int)ValueLength));
             lua_pop(State, 1);
             continue;
         }
 
         if (PacketField->Type == PACKET_FIELD_TYPE_STATIC_ARRAY) {
+            PacketLayoutRef ChildLayout = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
+            Int Count = PacketField->Length;
+
+            PacketViewRef ArrayView = PacketViewTest(State, -1);
+            if (ArrayView && ArrayView->Count >= 0 && ArrayView->Count <= Count && PacketViewEncode(ArrayView, ChildLayout, PacketBuffer)) {
+                for (Int Index = ArrayView->Count; Index < Count; Index += 1) {
+                    PacketLayoutWriteZero(ChildLayout, PacketBuffer);
+                }
+
+                lua_pop(State, 1);
+                continue;
+            }
+
             if (!lua_istable(State, -1)) {
                 lua_pop(State, 1);
                 Error("Invalid type given for field '%s' in layout '%s'", PacketField->Name, PacketLayout->Name);
                 return false;
             }
 
-            PacketLayoutRef ChildLayout = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
-            Int Count = PacketField->Length;
-
             lua_pushnil(State);
 
             Int Offset = 0;
@@ -887,13 +1167,20 @@ Bool PacketLayoutEncode(
         }
 
         if (PacketField->Type == PACKET_FIELD_TYPE_DYNAMIC_ARRAY) {
+            PacketLayoutRef ChildLayout = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
+
+            PacketViewRef ArrayView = PacketViewTest(State, -1);
+            if (ArrayView && ArrayView->Count >= 0 && PacketViewEncode(ArrayView, ChildLayout, PacketBuffer)) {
+                lua_pop(State, 1);
+                continue;
+            }
+
             if (!lua_istable(State, -1)) {
                 lua_pop(State, 1);
                 Error("Invalid type given for field '%s' in layout '%s'", PacketField->Name, PacketLayout->Name);
                 return false;
             }
 
-            PacketLayoutRef ChildLayout = PacketManagerGetLayoutByIndex(PacketLayout->Manager, PacketField->ChildIndex);
             lua_Integer Count = luaL_len(State, -1);
 
             lua_pushnil(State);
@@ -1147,7 +1434,7 @@ static Int32 PacketManagerAPI_RegisterPacketHandler(
     lua_pushvalue(State, 3);
     Int32 Handler = luaL_ref(State, LUA_REGISTRYINDEX);
 
-    if (DictionaryLookup(PacketManager->CommandToPacketHandler, &Command)) {
+    if (PacketManagerGetHandlerIndex(PacketManager, Command) >= 0) {
         return luaL_error(State, "Handler for command %d already registered!", Command);
     }
     
@@ -1162,7 +1449,7 @@ static Int32 PacketManagerAPI_RegisterPacketHandler(
     PacketHandler.Handler = Handler;
     strcpy(PacketHandler.LayoutName, Name);
 
-    DictionaryInsert(PacketManager->CommandToPacketHandler, &Command, &PacketHandler, sizeof(struct _PacketHandler));
+    ArrayAppendElement(PacketManager->PacketHandlers, &PacketHandler);
 
     lua_settop(State, StateStack);
     return 0;
@@ -1191,7 +1478,8 @@ static Int32 PacketManagerAPI_Unicast(
     PacketLayoutRef PacketLayout = PacketManagerGetLayout(PacketManager, Name);
     if (!PacketLayout) return luaL_error(State, "Packet layout not found for name: '%s'", Name);
 
-    if (!lua_istable(State, 3)) return luaL_error(State, "Invalid argument for payload!");
+    // NOTE: A view of the received packet can be passed as payload to forward it without building a table
+    if (!lua_istable(State, 3) && !luaL_testudata(State, 3, PACKET_VIEW_METATABLE_NAME)) return luaL_error(State, "Invalid argument for payload!");
     lua_pushvalue(State, 3);
     
     PacketBufferRef PacketBuffer = SocketGetNextPacketBuffer(Socket);
@@ -37,11 +37,26 @@ PacketLayoutRef PacketManagerGetLayout(
     CString Name
 );
 
+Int PacketManagerGetHandlerCount(
+    PacketManagerRef PacketManager
+);
+
+Int PacketManagerGetHandlerCommand(
+    PacketManagerRef PacketManager,
+    Int HandlerIndex
+);
+
+// NOTE: Handlers are only appended so a handler index stays valid for the lifetime of the packet manager
+Int PacketManagerGetHandlerIndex(
+    PacketManagerRef PacketManager,
+    Int Command
+);
+
 Int32 PacketManagerHandle(
     PacketManagerRef PacketManager,
     SocketRef Socket,
     SocketConnectionRef SocketConnection,
-    Int Command,
+    Int HandlerIndex,
     UInt8* Buffer,
     Int32 Length
 );
@@ -17,6 +17,31 @@ Void _ServerSocketOnReceived(
     Void *Packet
 );
 
+static Void ServerSocketReserveCommandSlots(
+    ServerSocketContextRef SocketContext,
+    Int Command
+) {
+    if (Command < SocketContext->CommandSlotCount) return;
+
+    Int SlotCount = MAX(SocketContext->CommandSlotCount, 256);
+    while (SlotCount <= Command) SlotCount <<= 1;
+
+    SocketContext->CommandSlots = (ServerCommandSlotRef)AllocatorReallocate(
+        SocketContext->Server->Allocator,
+        SocketContext->CommandSlots,
+        sizeof(struct _ServerCommandSlot) * SlotCount
+    );
+    if (!SocketContext->CommandSlots) Fatal("Memory allocation failed!");
+
+    for (Int Index = SocketContext->CommandSlotCount; Index < SlotCount; Index += 1) {
+        ServerCommandSlotRef CommandSlot = &SocketContext->CommandSlots[Index];
+        memset(CommandSlot, 0, sizeof(struct _ServerCommandSlot));
+        CommandSlot->ScriptHandlerIndex = -1;
+    }
+
+    SocketContext->CommandSlotCount = SlotCount;
+}
+
 ServerRef ServerCreate(
     AllocatorRef Allocator,
     IPCNodeID NodeID,
@@ -47,6 +72,7 @@ ServerRef ServerCreate(
         LogPackets,
         Server
     );
+    Server->MetricsSocket = NULL;
     Server->OnUpdate = OnUpdate;
     Server->Userdata = ServerContext;
     return Server;
@@ -59,14 +85,81 @@ Void ServerDestroy(
         ServerSocketContextRef SocketContext = (ServerSocketContextRef)ArrayGetElementAtIndex(Server->Sockets, Index);
         SocketDestroy(SocketContext->Socket);
         MemoryPoolDestroy(SocketContext->ConnectionContextPool);
-        DictionaryDestroy(SocketContext->CommandRegistry);
+        if (SocketContext->CommandSlots) AllocatorDeallocate(Server->Allocator, SocketContext->CommandSlots);
         PacketManagerDestroy(SocketContext->PacketManager);
     }
     
+    if (Server->MetricsSocket) MetricsSocketDestroy(Server->MetricsSocket);
     ArrayDestroy(Server->Sockets);
     AllocatorDeallocate(Server->Allocator, (Void*)Server);
 }
 
+static Void ServerWriteCommandMetric(
+    ServerRef Server,
+    CString Buffer,
+    Int32 Length,
+    Int32* Offset,
+    CString Name,
+    Bool IsDuration
+) {
+    UInt64 InvocationCount = 0;
+    Timestamp HandlerDuration = 0;
+
+    MetricsAppendText(Buffer, Length, Offset, "# TYPE %s counter\n", Name);
+
+    for (Int Index = 0; Index < ArrayGetElementCount(Server->Sockets); Index += 1) {
+        ServerSocketContextRef SocketContext = (ServerSocketContextRef)ArrayGetElementAtIndex(Server->Sockets, Index);
+
+        for (Int Command = 0; ServerSocketGetCommandStatistics(Server, SocketContext->Socket, Command, &InvocationCount, &HandlerDuration); Command += 1) {
+            if (InvocationCount < 1) continue;
+
+            MetricsAppendText(
+                Buffer, Length, Offset,
+                "%s{socket=\"%u\",command=\"%d\"} %llu\n",
+                Name,
+                (UInt32)SocketContext->SocketPort,
+                (Int32)Command,
+                (unsigned long long)(IsDuration ? HandlerDuration : InvocationCount)
+            );
+        }
+    }
+
+    for (Int Command = 0; IPCSocketGetCommandStatistics(Server->IPCSocket, Command, &InvocationCount, &HandlerDuration); Command += 1) {
+        if (InvocationCount < 1) continue;
+
+        MetricsAppendText(
+            Buffer, Length, Offset,
+            "%s{socket=\"ipc\",command=\"%d\"} %llu\n",
+            Name,
+            (Int32)Command,
+            (unsigned long long)(IsDuration ? HandlerDuration : InvocationCount)
+        );
+    }
+}
+
+// NOTE: The per command counters stay plain fields in the dispatch slots and are only formatted when the endpoint is scraped
+static Int32 ServerWriteCommandMetrics(
+    MetricsSocketRef Socket,
+    CString Buffer,
+    Int32 Length,
+    Void* Userdata
+) {
+    ServerRef Server = (ServerRef)Userdata;
+    Int32 Offset = 0;
+    ServerWriteCommandMetric(Server, Buffer, Length, &Offset, "server_command_invocations", false);
+    ServerWriteCommandMetric(Server, Buffer, Length, &Offset, "server_command_handler_duration_us", true);
+    return MIN(Offset, Length);
+}
+
+Void ServerEnableMetrics(
+    ServerRef Server,
+    UInt16 Port
+) {
+    if (!Port || Server->MetricsSocket) return;
+
+    Server->MetricsSocket = MetricsSocketCreate(Server->Allocator, Port, &ServerWriteCommandMetrics, Server);
+}
+
 SocketRef ServerCreateSocket(
     ServerRef Server,
     UInt32 SocketFlags,
@@ -108,7 +201,8 @@ SocketRef ServerCreateSocket(
     SocketContext->SocketPort = SocketPort;
     SocketContext->ConnectionContextPool = MemoryPoolCreate(Server->Allocator, ConnectionContextSize, MaxConnectionCount);
     SocketContext->PacketManager = PacketManagerCreate(Server->Allocator);
-    SocketContext->CommandRegistry = IndexDictionaryCreate(Server->Allocator, 8);
+    SocketContext->CommandSlots = NULL;
+    SocketContext->CommandSlotCount = 0;
     SocketContext->OnConnect = OnConnect;
     SocketContext->OnDisconnect = OnDisconnect;
     SocketContext->PacketGetCommand = &ClientPacketGetCommand;
@@ -133,10 +227,28 @@ Void ServerSocketRegisterPacketCallback(
     SocketRef Socket,
     Int Command,
     ServerPacketCallback Callback
+) {
+    assert(Command >= 0);
+    ServerSocketContextRef SocketContext = (ServerSocketContextRef)Socket->Userdata;
+    ServerSocketReserveCommandSlots(SocketContext, Command);
+    assert(!SocketContext->CommandSlots[Command].Callback);
+    SocketContext->CommandSlots[Command].Callback = Callback;
+}
+
+Bool ServerSocketGetCommandStatistics(
+    ServerRef Server,
+    SocketRef Socket,
+    Int Command,
+    UInt64* InvocationCount,
+    Timestamp* HandlerDuration
 ) {
     ServerSocketContextRef SocketContext = (ServerSocketContextRef)Socket->Userdata;
-    assert(!DictionaryLookup(SocketContext->CommandRegistry, &Command));
-    DictionaryInsert(SocketContext->CommandRegistry, &Command, &Callback, sizeof(ServerPacketCallback));
+    if (Command < 0 || Command >= SocketContext->CommandSlotCount) return false;
+
+    ServerCommandSlotRef CommandSlot = &SocketContext->CommandSlots[Command];
+    *InvocationCount = CommandSlot->InvocationCount;
+    *HandlerDuration = CommandSlot->HandlerDuration;
+    return true;
 }
 
 Void ServerSocketLoadScript(
@@ -146,6 +258,15 @@ Void ServerSocketLoadScript(
 ) {
     ServerSocketContextRef SocketContext = (ServerSocketContextRef)Socket->Userdata;
     PacketManagerLoadScript(SocketContext->PacketManager, FilePath);
+
+    // NOTE: Script overrides are bound into the dispatch table once so unscripted commands never enter the packet manager
+    for (Int Index = 0; Index < PacketManagerGetHandlerCount(SocketContext->PacketManager); Index += 1) {
+        Int Command = PacketManagerGetHandlerCommand(SocketContext->PacketManager, Index);
+        if (Command < 0) continue;
+
+        ServerSocketReserveCommandSlots(SocketContext, Command);
+        SocketContext->CommandSlots[Command].ScriptHandlerIndex = Index;
+    }
 }
 
 Void ServerRun(
@@ -159,7 +280,9 @@ Void ServerRun(
     }
 
     while (!ApplicationIsShuttingDown()) {
+        Timestamp UpdateTimestamp = PlatformGetTickCountUs();
         if (Server->OnUpdate) Server->OnUpdate(Server, Server->Userdata);
+        MetricsHistogramRecord("server_update_duration_us", PlatformGetTickCountUs() - UpdateTimestamp);
 
         for (Int Index = 0; Index < ArrayGetElementCount(Server->Sockets); Index += 1) {
             ServerSocketContextRef SocketContext = (ServerSocketContextRef)ArrayGetElementAtIndex(Server->Sockets, Index);
@@ -174,6 +297,7 @@ Void ServerRun(
         }
 
         IPCSocketUpdate(Server->IPCSocket);
+        MetricsHistogramRecord("server_loop_duration_us", PlatformGetTickCountUs() - UpdateTimestamp);
         PlatformSleep(1);
     }
 }
@@ -237,23 +361,44 @@ Void _ServerSocketOnReceived(
         Packet
     );
 
-    UInt8 * Buffer = ((UInt8*)Packet) + HeaderLength;
-    Int32 BufferLength = PacketLength - HeaderLength;
-    Int32 Result = PacketManagerHandle(
-        SocketContext->PacketManager,
-        Socket,
-        Connection,
-        Command,
-        Buffer,
-        BufferLength
-    );
+    ServerCommandSlotRef CommandSlot = NULL;
+    if (Command >= 0 && Command < SocketContext->CommandSlotCount) {
+        CommandSlot = &SocketContext->CommandSlots[Command];
+    }
+
+    if (!CommandSlot || (!CommandSlot->Callback && CommandSlot->ScriptHandlerIndex < 0)) {
+        Warn("Received unknown packet: %d", (Int32)Command);
+
+        PacketLogBytes(
+            Socket->ProtocolIdentifier,
+            Socket->ProtocolVersion,
+            Socket->ProtocolExtension,
+            Packet
+        );
+        return;
+    }
+
+    Timestamp HandlerTimestamp = PlatformGetTickCountUs();
+    Int32 Result = 0;
+    if (CommandSlot->ScriptHandlerIndex >= 0) {
+        UInt8* Buffer = ((UInt8*)Packet) + HeaderLength;
+        Int32 BufferLength = PacketLength - HeaderLength;
+        Result = PacketManagerHandle(
+            SocketContext->PacketManager,
+            Socket,
+            Connection,
+            CommandSlot->ScriptHandlerIndex,
+            Buffer,
+            BufferLength
+        );
+    }
+
     if (Result < 0) {
         SocketDisconnect(Socket, Connection);
     }
 
     if (Result == 0) {
-        ServerPacketCallback* CommandCallback = (ServerPacketCallback*)DictionaryLookup(SocketContext->CommandRegistry, &Command);
-        if (CommandCallback) (*CommandCallback)(
+        if (CommandSlot->Callback) CommandSlot->Callback(
             SocketContext->Server,
             SocketContext->Server->Userdata,
             Socket,
@@ -261,15 +406,9 @@ Void _ServerSocketOnReceived(
             Connection->Userdata,
             Packet
         );
-        else {
-            Warn("Received unknown packet: %d", (Int32)Command);
-
-            PacketLogBytes(
-                Socket->ProtocolIdentifier,
-                Socket->ProtocolVersion,
-                Socket->ProtocolExtension,
-                Packet
-            );
-        }
+        else Warn("Received unhandled packet: %d", (Int32)Command);
     }
+
+    CommandSlot->InvocationCount += 1;
+    CommandSlot->HandlerDuration += PlatformGetTickCountUs() - HandlerTimestamp;
 }
@@ -2,6 +2,7 @@
 
 #include "Base.h"
 #include "IPCSocket.h"
+#include "MetricsSocket.h"
 #include "PacketLayout.h"
 #include "Socket.h"
 
@@ -55,6 +56,15 @@ typedef Int32(*PacketGetLengthCallback)(
     Void* Packet
 );
 
+// NOTE: Commands are dense 16 bit ids so the dispatch table is indexed directly by the command
+struct _ServerCommandSlot {
+    ServerPacketCallback Callback;
+    Int ScriptHandlerIndex;
+    UInt64 InvocationCount;
+    Timestamp HandlerDuration;
+};
+typedef struct _ServerCommandSlot* ServerCommandSlotRef;
+
 struct _ServerSocketContext {
     ServerRef Server;
     SocketRef Socket;
@@ -62,7 +72,8 @@ struct _ServerSocketContext {
     UInt16 SocketPort;
     MemoryPoolRef ConnectionContextPool;
     PacketManagerRef PacketManager;
-    DictionaryRef CommandRegistry;
+    ServerCommandSlotRef CommandSlots;
+    Int CommandSlotCount;
     ServerConnectionCallback OnConnect;
     ServerConnectionCallback OnDisconnect;
     PacketGetCommandCallback PacketGetCommand;
@@ -75,6 +86,7 @@ struct _Server {
     ArrayRef Sockets; // TODO: Replace this with client socket there is no usecase for having many of them..
     SocketRef ClientSocket;
     IPCSocketRef IPCSocket;
+    MetricsSocketRef MetricsSocket;
     ServerUpdateCallback OnUpdate;
     Void* Userdata;
 };
@@ -96,6 +108,12 @@ Void ServerDestroy(
     ServerRef Server
 );
 
+// NOTE: A port of 0 keeps the metrics endpoint disabled
+Void ServerEnableMetrics(
+    ServerRef Server,
+    UInt16 Port
+);
+
 SocketRef ServerCreateSocket(
     ServerRef Server,
     UInt32 SocketFlags,
@@ -121,6 +139,14 @@ Void ServerSocketRegisterPacketCallback(
     ServerPacketCallback Callback
 );
 
+Bool ServerSocketGetCommandStatistics(
+    ServerRef Server,
+    SocketRef Socket,
+    Int Command,
+    UInt64* InvocationCount,
+    Timestamp* HandlerDuration
+);
+
 Void ServerSocketLoadScript(
     ServerRef Server,
     SocketRef Socket,
@@ -2,9 +2,12 @@
 
 // TODO: Remove usage of malloc for write requests!
 
+#define SOCKET_MAX_WRITE_BUFFER_COUNT 64
+
 struct _SocketConnectionWriteRequest {
     uv_write_t Request;
     uv_buf_t Buffer;
+    struct _SocketConnectionWriteRequest* Next;
 };
 
 SocketConnectionRef SocketReserveConnection(
@@ -384,16 +387,50 @@ Void _OnWrite(
         }
     }
 
-    AllocatorDeallocate(Connection->Socket->Allocator, WriteRequest);
+    // NOTE: Vectored writes own the whole chain of requests they were built from
+    struct _SocketConnectionWriteRequest* Request = (struct _SocketConnectionWriteRequest*)WriteRequest;
+    while (Request) {
+        struct _SocketConnectionWriteRequest* NextRequest = Request->Next;
+        AllocatorDeallocate(Connection->Socket->Allocator, Request);
+        Request = NextRequest;
+    }
 }
 
 Void SocketProcessDeferred(
     SocketRef Socket
 ) {
-    for (Int Index = 0; Index < ArrayGetElementCount(Socket->DeferredWriteRequests); Index += 1) {
+    uv_buf_t Buffers[SOCKET_MAX_WRITE_BUFFER_COUNT];
+    Int Index = 0;
+    Int Count = ArrayGetElementCount(Socket->DeferredWriteRequests);
+    if (Count > 0) MetricsHistogramRecord("socket_deferred_write_count", Count);
+
+    while (Index < Count) {
         struct _SocketConnectionWriteRequest* WriteRequest = *(struct _SocketConnectionWriteRequest**)ArrayGetElementAtIndex(Socket->DeferredWriteRequests, Index);
         SocketConnectionRef Connection = (SocketConnectionRef)WriteRequest->Request.data;
-        uv_write(&WriteRequest->Request, (uv_stream_t*)Connection->Handle, &WriteRequest->Buffer, 1, _OnWrite);
+
+        // NOTE: Consecutive requests of the same connection are chained into a single vectored write
+        struct _SocketConnectionWriteRequest* TailRequest = WriteRequest;
+        Buffers[0] = WriteRequest->Buffer;
+        Int BufferCount = 1;
+        while (Index + BufferCount < Count && BufferCount < SOCKET_MAX_WRITE_BUFFER_COUNT) {
+            struct _SocketConnectionWriteRequest* NextRequest = *(struct _SocketConnectionWriteRequest**)ArrayGetElementAtIndex(Socket->DeferredWriteRequests, Index + BufferCount);
+            if (NextRequest->Request.data != Connection) break;
+
+            TailRequest->Next = NextRequest;
+            TailRequest = NextRequest;
+            Buffers[BufferCount] = NextRequest->Buffer;
+            BufferCount += 1;
+        }
+
+        Index += BufferCount;
+
+        if (Connection->Flags & SOCKET_CONNECTION_FLAGS_DISCONNECTED) {
+            _OnWrite(&WriteRequest->Request, 0);
+            continue;
+        }
+
+        uv_write(&WriteRequest->Request, (uv_stream_t*)Connection->Handle, Buffers, (UInt32)BufferCount, _OnWrite);
+        MetricsHistogramRecord("socket_write_queue_bytes", uv_stream_get_write_queue_size((uv_stream_t*)Connection->Handle));
     }
 
     ArrayRemoveAllElements(Socket->DeferredWriteRequests, true);
@@ -465,6 +502,9 @@ Void SocketSendRaw(
     if (Socket->LogPackets) PacketLogBytes(Socket->ProtocolIdentifier, Socket->ProtocolVersion, Socket->ProtocolExtension, Data);
     if (Socket->OnSend) Socket->OnSend(Socket, Connection, Data);
 
+    MetricsCounterAdd("socket_packets_sent", 1);
+    MetricsCounterAdd("socket_bytes_sent", Length);
+
     Int32 MemoryLength = sizeof(struct _SocketConnectionWriteRequest) + PacketLength;
     UInt8* Memory = AllocatorAllocate(Socket->Allocator, MemoryLength);
     if (!Memory) {
@@ -475,17 +515,20 @@ Void SocketSendRaw(
     WriteRequest->Request.data = Connection;
     WriteRequest->Buffer.base = (CString)(Memory + sizeof(struct _SocketConnectionWriteRequest));
     WriteRequest->Buffer.len = Length;
+    WriteRequest->Next = NULL;
     memcpy(WriteRequest->Buffer.base, Data, Length);
 
     if (Socket->Flags & SOCKET_FLAGS_ENCRYPTED) {
         KeychainEncryptPacket(&Connection->Keychain, (UInt8*)WriteRequest->Buffer.base, PacketLength);
     }
 
-    if (IsDeferred) {
+    // NOTE: An immediate write must not overtake the deferred writes queued before it
+    if (IsDeferred || ArrayGetElementCount(Socket->DeferredWriteRequests) > 0) {
         ArrayAppendElement(Socket->DeferredWriteRequests, &WriteRequest);
     }
     else {
         uv_write(&WriteRequest->Request, (uv_stream_t*)Connection->Handle, &WriteRequest->Buffer, 1, _OnWrite);
+        MetricsHistogramRecord("socket_write_queue_bytes", uv_stream_get_write_queue_size((uv_stream_t*)Connection->Handle));
     }
 }
 
@@ -37,7 +37,7 @@ Void BroadcastPartyInfo(
     Notification->Header.Source = Server->IPCSocket->NodeID;
     Notification->Header.Target.Group = Context->Config.PartySvr.GroupIndex;
     Notification->Header.Target.Type = IPC_TYPE_WORLD;
-    memcpy(&Notification->Party, Party, sizeof(struct _RTParty));
+    Notification->Length = IPCPacketBufferAppendSparse(Socket->PacketBuffer, &kRTPartySchema, Party);
     IPCSocketBroadcast(Socket, Notification);
 }
 
@@ -51,7 +51,7 @@ Void BroadcastCreateParty(
     Notification->Header.Source = Server->IPCSocket->NodeID;
     Notification->Header.Target.Group = Context->Config.PartySvr.GroupIndex;
     Notification->Header.Target.Type = IPC_TYPE_WORLD;
-    memcpy(&Notification->Party, Party, sizeof(struct _RTParty));
+    Notification->Length = IPCPacketBufferAppendSparse(Socket->PacketBuffer, &kRTPartySchema, Party);
     IPCSocketBroadcast(Socket, Notification);
 }
 
@@ -65,7 +65,7 @@ Void BroadcastDestroyParty(
     Notification->Header.Source = Server->IPCSocket->NodeID;
     Notification->Header.Target.Group = Context->Config.PartySvr.GroupIndex;
     Notification->Header.Target.Type = IPC_TYPE_WORLD;
-    memcpy(&Notification->Party, Party, sizeof(struct _RTParty));
+    Notification->Length = IPCPacketBufferAppendSparse(Socket->PacketBuffer, &kRTPartySchema, Party);
     IPCSocketBroadcast(Socket, Notification);
 }
 
@@ -132,6 +132,7 @@ Int32 main(Int32 argc, CString* argv) {
         &ServerOnUpdate,
         &ServerContext
     );
+    ServerEnableMetrics(Server, Config.NetLib.MetricsPort);
 
     ServerContext.ClientSocket = ServerCreateSocket(
         Server,
@@ -113,7 +113,7 @@ Bool RTCharacterAddEssenceAbility(
 	Character->Data.AbilityInfo.Info.AP -= AbilityCostLevel->AP;
 	Character->SyncMask.AbilityInfo = true;
 	Character->SyncMask.InventoryInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_ESSENCE_ABILITY));
 
 	return true;
 }
@@ -208,7 +208,7 @@ Bool RTCharacterUpgradeEssenceAbility(
 	Character->Data.AbilityInfo.Info.AP -= AbilityCostLevel->AP;
 	Character->SyncMask.AbilityInfo = true;
 	Character->SyncMask.InventoryInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_ESSENCE_ABILITY));
 
 	return true;
 }
@@ -235,7 +235,7 @@ Bool RTCharacterRemoveEssenceAbility(
 	}
 
 	Character->SyncMask.AbilityInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_ESSENCE_ABILITY));
 
 	return true;
 }
@@ -309,7 +309,7 @@ Bool RTCharacterAddBlendedAbility(
 	Character->Data.AbilityInfo.Info.AP -= AbilityCost->AP;
 	Character->SyncMask.AbilityInfo = true;
 	Character->SyncMask.InventoryInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BLENDED_ABILITY));
 
 	return true;
 }
@@ -346,7 +346,7 @@ Bool RTCharacterRemoveBlendedAbility(
 	}
 
 	Character->SyncMask.AbilityInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BLENDED_ABILITY));
 
 	return true;
 }
@@ -440,7 +440,7 @@ Bool RTCharacterAddKarmaAbility(
 	Character->Data.AbilityInfo.Info.AP -= AbilityCostLevel->AP;
 	Character->SyncMask.AbilityInfo = true;
 	Character->SyncMask.InventoryInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_KARMA_ABILITY));
 
 	return true;
 }
@@ -536,7 +536,7 @@ Bool RTCharacterUpgradeKarmaAbility(
 	Character->Data.AbilityInfo.Info.AP -= AbilityCostLevel->AP;
 	Character->SyncMask.AbilityInfo = true;
 	Character->SyncMask.InventoryInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_KARMA_ABILITY));
 
 	return true;
 }
@@ -563,7 +563,7 @@ Bool RTCharacterRemoveKarmaAbility(
 	}
 
 	Character->SyncMask.AbilityInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_KARMA_ABILITY));
 
 	return true;
 }
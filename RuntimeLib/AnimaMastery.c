@@ -144,7 +144,7 @@ UInt8 RTCharacterAnimaMasteryTrainSlot(
     assert(ForceEffectOrder > 0);
     CategoryData->MasterySlots[MasterySlotIndex] = ForceEffectOrder;
     Character->SyncMask.AnimaMasteryInfo = true;
-    RTCharacterInitializeAttributes(Runtime, Character);
+    RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_ANIMA_MASTERY));
 
     return CategoryData->MasterySlots[MasterySlotIndex];
 }
@@ -184,7 +184,7 @@ Bool RTCharacterAnimaMasteryResetSlot(
     if (!CategoryData) return false;
 
     memset(CategoryData->MasterySlots, 0, sizeof(CategoryData->MasterySlots));
-    RTCharacterInitializeAttributes(Runtime, Character);
+    RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_ANIMA_MASTERY));
     Character->SyncMask.AnimaMasteryInfo = true;
     return true;
 }
@@ -290,7 +290,7 @@ Bool RTCharacterAnimaMasterySetActiveStorageIndex(
     PresetData->CategoryOrder[CategoryIndex].StorageIndex = StorageIndex;
     PresetData->CategoryOrder[CategoryIndex].CategoryIndex = CategoryIndex;
     Character->SyncMask.AnimaMasteryInfo = true;
-    RTCharacterInitializeAttributes(Runtime, Character);
+    RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_ANIMA_MASTERY));
     return true;
 }
 
@@ -303,6 +303,6 @@ Bool RTCharacterAnimaMasterySetActivePresetIndex(
     
     Character->Data.PresetInfo.ActiveAnimaMasteryPresetIndex = PresetIndex;
     Character->SyncMask.PresetInfo = true;
-    RTCharacterInitializeAttributes(Runtime, Character);
+    RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_ANIMA_MASTERY));
     return true;
 }
@@ -34,7 +34,7 @@ Void RTCharacterToggleAstralVehicle(
 	Character->Data.StyleInfo.ExtendedStyle.IsVehicleActive = IsActivation;
 	Character->SyncMask.StyleInfo = true;
 
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_EQUIPMENT));
 
 	NOTIFICATION_DATA_SKILL_TO_CHARACTER* Notification = RTNotificationInit(SKILL_TO_CHARACTER);
 	Notification->SkillIndex = SkillIndex;
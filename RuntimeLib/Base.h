@@ -44,8 +44,10 @@ typedef struct _RTCharacterOverlordMasteryInfo* RTCharacterOverlordMasteryInfoRe
 typedef struct _RTCollectionSlot* RTCollectionSlotRef;
 typedef struct _RTCharacterCollectionInfo* RTCharacterCollectionInfoRef;
 typedef struct _RTCharacter* RTCharacterRef;
+typedef struct _RTCharacterAttributeCache* RTCharacterAttributeCacheRef;
 typedef struct _RTDropItem* RTDropItemRef;
 typedef struct _RTDropTable* RTDropTableRef;
+typedef struct _RTDropAliasPool* RTDropAliasPoolRef;
 typedef struct _RTDropResult* RTDropResultRef;
 typedef struct _RTForceEffectFormula* RTForceEffectFormulaRef;
 typedef struct _RTForceWingArrivalSkillSlot* RTForceWingArrivalSkillSlotRef;
@@ -81,11 +83,15 @@ typedef struct _RTNotification* RTNotificationRef;
 typedef struct _RTNotificationManager* RTNotificationManagerRef;
 typedef struct _RTNpc* RTNpcRef;
 typedef struct _RTOptionPoolManager* RTOptionPoolManagerRef;
+typedef struct _RTOptionPoolItemTypeTable* RTOptionPoolItemTypeTableRef;
 typedef struct _RTPartyMemberInfo* RTPartyMemberInfoRef;
 typedef struct _RTPartyMemberData* RTPartyMemberDataRef;
 typedef struct _RTPartyInvitation* RTPartyInvitationRef;
 typedef struct _RTParty* RTPartyRef;
 typedef struct _RTPartyManager* RTPartyManagerRef;
+typedef struct _RTPathFindingCache* RTPathFindingCacheRef;
+typedef struct _RTPathFindingContext* RTPathFindingContextRef;
+typedef struct _RTPathFindingGraph* RTPathFindingGraphRef;
 typedef struct _RTPosition* RTPositionRef;
 typedef struct _RTQuestConditionData* RTQuestConditionDataRef;
 typedef struct _RTQuestNpcData* RTQuestNpcDataRef;
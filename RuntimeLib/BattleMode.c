@@ -76,7 +76,7 @@ Bool RTCharacterStartBattleMode(
 	Character->Data.StyleInfo.ExtendedStyle.BattleModeFlags |= (1 << (SkillData->Intensity - 1));
 	Character->SyncMask.StyleInfo = true;
 
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BATTLE_MODE));
 
 	NOTIFICATION_DATA_SKILL_TO_CHARACTER* Notification = RTNotificationInit(SKILL_TO_CHARACTER);
 	Notification->SkillIndex = SkillIndex;
@@ -166,7 +166,7 @@ Bool RTCharacterCancelBattleMode(
 	Character->Data.StyleInfo.ExtendedStyle.BattleModeFlags = 0;
 	Character->SyncMask.StyleInfo = true;
 
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BATTLE_MODE));
 
 	NOTIFICATION_DATA_SKILL_TO_CHARACTER* Notification = RTNotificationInit(SKILL_TO_CHARACTER);
 	Notification->SkillIndex = RTCharacterGetBattleModeSkillIndex(Runtime, Character, BattleModeIndex);
@@ -215,7 +215,7 @@ Bool RTCharacterStartAuraMode(
 	Character->Data.StyleInfo.ExtendedStyle.IsAuraActive = true;
 	Character->SyncMask.StyleInfo = true;
 
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BATTLE_MODE));
 
 	NOTIFICATION_DATA_SKILL_TO_CHARACTER* Notification = RTNotificationInit(SKILL_TO_CHARACTER);
 	Notification->SkillIndex = SkillIndex;
@@ -248,7 +248,7 @@ Bool RTCharacterCancelAuraMode(
 	Character->Data.StyleInfo.ExtendedStyle.IsAuraActive = 0;
 	Character->SyncMask.StyleInfo = true;
 	
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BATTLE_MODE));
 
 	NOTIFICATION_DATA_SKILL_TO_CHARACTER* Notification = RTNotificationInit(SKILL_TO_CHARACTER);
 	Notification->SkillIndex = RTCharacterGetAuraModeSkillIndex(Runtime, Character, AuraModeIndex);
@@ -679,9 +679,10 @@ RTBattleResult RTCalculateSkillAttackResult(
 		Result.SkillExp = Skill->SkillExp2;
 	}
 
-	Int32 AbsDeltaX = MIN(ABS(DefenderMovement->PositionCurrent.X - AttackerMovement->PositionCurrent.X), RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1);
-	Int32 AbsDeltaY = MIN(ABS(DefenderMovement->PositionCurrent.Y - AttackerMovement->PositionCurrent.Y), RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1);
-	Float32 TileDistance = Runtime->MovementDistanceCache[AbsDeltaX + AbsDeltaY * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH];
+	Float32 TileDistance = RTMovementGetDistance(
+		DefenderMovement->PositionCurrent.X - AttackerMovement->PositionCurrent.X,
+		DefenderMovement->PositionCurrent.Y - AttackerMovement->PositionCurrent.Y
+	);
 	Result.Delay = 1000LL * Skill->FiringFrame / 30;
 	Result.Delay += TileDistance * 100 * Skill->HitFrame / 30;
 
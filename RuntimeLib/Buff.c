@@ -4,6 +4,7 @@
 #include "NotificationProtocol.h"
 #include "NotificationManager.h"
 #include "Runtime.h"
+#include "WorldManager.h"
 
 Int32 RTCharacterGetBuffSlotIndexBuffType(
     RTRuntimeRef Runtime,
@@ -156,12 +157,27 @@ Void RTCharacterRemoveBuffSlot(
     Character->SyncMask.BuffInfo = true;
 }
 
-Void RTCharacterInitializeBuffs(
+Void RTCharacterScheduleBuffUpdate(
     RTRuntimeRef Runtime,
     RTCharacterRef Character
 ) {
-    Timestamp CurrentTimestamp = GetTimestampMs();
-    Int32 BuffSlotCount = (
+    TimerWheelCancel(Runtime->TimerWheel, Character->BuffTimer);
+    Character->BuffTimer = 0;
+
+    if (Character->BuffUpdateTimestamp == UINT64_MAX) return;
+
+    Character->BuffTimer = TimerWheelSchedule(
+        Runtime->TimerWheel,
+        Character->BuffUpdateTimestamp,
+        RUNTIME_TIMER_TYPE_CHARACTER_BUFF,
+        Character->CharacterIndex
+    );
+}
+
+static Int32 RTCharacterGetBuffSlotCount(
+    RTCharacterRef Character
+) {
+    return (
         Character->Data.BuffInfo.Info.SkillBuffCount +
         Character->Data.BuffInfo.Info.PotionBuffCount +
         Character->Data.BuffInfo.Info.GmBuffCount +
@@ -170,15 +186,55 @@ Void RTCharacterInitializeBuffs(
         Character->Data.BuffInfo.Info.ForceWingBuffCount +
         Character->Data.BuffInfo.Info.FirePlaceBuffCount
     );
+}
 
+// NOTE: Durations are only stored relative to the last buff update, the elapsed time has to be applied
+//       before the buff timestamps are reset or new buffs are inserted
+static Void RTCharacterAdvanceBuffs(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character,
+    Timestamp CurrentTimestamp
+) {
+    Timestamp LastBuffUpdateTimestamp = Character->LastBuffUpdateTimestamp;
     Character->LastBuffUpdateTimestamp = CurrentTimestamp;
+    if (LastBuffUpdateTimestamp < 1 || LastBuffUpdateTimestamp >= CurrentTimestamp) return;
+
+    Timestamp Interval = CurrentTimestamp - LastBuffUpdateTimestamp;
+    Int32 BuffSlotCount = RTCharacterGetBuffSlotCount(Character);
+    for (Int Index = 0; Index < BuffSlotCount; Index += 1) {
+        RTBuffSlotRef BuffSlot = &Character->Data.BuffInfo.Slots[Index];
+        if (BuffSlot->Duration < 1) continue;
+
+        BuffSlot->Duration = (BuffSlot->Duration > Interval) ? BuffSlot->Duration - Interval : 0;
+        Character->SyncMask.BuffInfo = true;
+    }
+}
+
+Void RTCharacterRefreshBuffUpdate(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character
+) {
+    Timestamp CurrentTimestamp = GetTimestampMs();
+    Int32 BuffSlotCount = RTCharacterGetBuffSlotCount(Character);
+
+    RTCharacterAdvanceBuffs(Runtime, Character, CurrentTimestamp);
+
     Character->BuffUpdateTimestamp = UINT64_MAX;
     for (Int Index = 0; Index < BuffSlotCount; Index += 1) {
         RTBuffSlotRef BuffSlot = &Character->Data.BuffInfo.Slots[Index];
-        if (BuffSlot->Duration > 0) {
-            Character->BuffUpdateTimestamp = MIN(Character->BuffUpdateTimestamp, CurrentTimestamp + BuffSlot->Duration);
-        } 
+        Character->BuffUpdateTimestamp = MIN(Character->BuffUpdateTimestamp, CurrentTimestamp + BuffSlot->Duration);
+    }
 
+    RTCharacterScheduleBuffUpdate(Runtime, Character);
+}
+
+Void RTCharacterInitializeBuffs(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character
+) {
+    Int32 BuffSlotCount = RTCharacterGetBuffSlotCount(Character);
+    for (Int Index = 0; Index < BuffSlotCount; Index += 1) {
+        RTBuffSlotRef BuffSlot = &Character->Data.BuffInfo.Slots[Index];
         Int32 BuffType = RTCharacterGetBuffSlotIndexBuffType(Runtime, Character, Index);
         if (BuffType == RUNTIME_BUFF_SLOT_TYPE_SKILL || BuffType == RUNTIME_BUFF_SLOT_TYPE_FORCE_WING) {
             RTCharacterSkillDataRef SkillData = RTRuntimeGetCharacterSkillDataByID(Runtime, BuffSlot->SkillIndex);
@@ -210,32 +266,29 @@ Void RTCharacterUpdateBuffs(
     Bool ForceUpdate
 ) {
     Timestamp CurrentTimestamp = GetTimestampMs();
+
+    // NOTE: Buffs of dead characters are frozen and checked again after the regeneration interval
+    if (!ForceUpdate && !RTCharacterIsAlive(Runtime, Character)) {
+        TimerWheelCancel(Runtime->TimerWheel, Character->BuffTimer);
+        Character->BuffTimer = TimerWheelSchedule(
+            Runtime->TimerWheel,
+            CurrentTimestamp + RUNTIME_REGENERATION_INTERVAL,
+            RUNTIME_TIMER_TYPE_CHARACTER_BUFF,
+            Character->CharacterIndex
+        );
+        return;
+    }
+
     if (ForceUpdate || Character->BuffUpdateTimestamp <= CurrentTimestamp) {
-        Timestamp Interval = CurrentTimestamp - Character->LastBuffUpdateTimestamp;
+        RTCharacterAdvanceBuffs(Runtime, Character, CurrentTimestamp);
         Character->BuffUpdateTimestamp = UINT64_MAX;
-        Character->LastBuffUpdateTimestamp = CurrentTimestamp;
-
-        Int32 BuffSlotCount = (
-            Character->Data.BuffInfo.Info.SkillBuffCount +
-            Character->Data.BuffInfo.Info.PotionBuffCount +
-            Character->Data.BuffInfo.Info.GmBuffCount +
-            Character->Data.BuffInfo.Info.ForceCaliburBuffCount +
-            Character->Data.BuffInfo.Info.UnknownBuffCount2 +
-            Character->Data.BuffInfo.Info.ForceWingBuffCount +
-            Character->Data.BuffInfo.Info.FirePlaceBuffCount
-        );
 
+        Int32 BuffSlotCount = RTCharacterGetBuffSlotCount(Character);
         for (Int Index = 0; Index < BuffSlotCount; Index += 1) {
             RTBuffSlotRef BuffSlot = &Character->Data.BuffInfo.Slots[Index];
-            if (BuffSlot->Duration > Interval) {
-                BuffSlot->Duration -= Interval;
-                Character->BuffUpdateTimestamp = MIN(Character->BuffUpdateTimestamp, CurrentTimestamp + BuffSlot->Duration);
-            }
-            else {
-                BuffSlot->Duration = 0;
-            }
+            if (BuffSlot->Duration < 1) continue;
 
-            Character->SyncMask.BuffInfo = true;
+            Character->BuffUpdateTimestamp = MIN(Character->BuffUpdateTimestamp, CurrentTimestamp + BuffSlot->Duration);
         }
 
         Bool UpdateAttributes = false;
@@ -256,9 +309,11 @@ Void RTCharacterUpdateBuffs(
         }
 
         if (UpdateAttributes) {
-            RTCharacterInitializeAttributes(Runtime, Character);
+            RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BUFF));
         }
     }
+
+    RTCharacterScheduleBuffUpdate(Runtime, Character);
 }
 
 UInt32 RTCharacterApplyBuff(
@@ -284,16 +339,19 @@ UInt32 RTCharacterApplyBuff(
         RTCharacterRemoveBuffSlot(Runtime, Character, BuffSlotIndex);
     }
     
+    RTCharacterAdvanceBuffs(Runtime, Character, GetTimestampMs());
+
     BuffSlot = RTCharacterInsertBuffSlot(Runtime, Character, BuffType);
     BuffSlot->SkillIndex = SkillSlot->ID;
     BuffSlot->SkillLevel = SkillSlot->Level;
     BuffSlot->Duration = RTCalculateSkillDuration(SkillData, SkillSlot->Level, Character->Data.StyleInfo.Style.BattleRank);
 
     Character->SyncMask.BuffInfo = true;
-    RTCharacterInitializeAttributes(Runtime, Character);
+    RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BUFF));
 
     Timestamp ExpirationTimestamp = GetTimestampMs() + BuffSlot->Duration;
     Character->BuffUpdateTimestamp = MIN(Character->BuffUpdateTimestamp, ExpirationTimestamp);
+    RTCharacterScheduleBuffUpdate(Runtime, Character);
 
     return 1;
 }
@@ -353,7 +411,7 @@ Bool RTCharacterRemoveBuff(
         Int64 CurrentShield = Character->Attributes.Values[RUNTIME_ATTRIBUTE_DAMAGE_ABSORB];
 
         RTCharacterRemoveBuffSlot(Runtime, Character, ResultSlotIndex);
-        RTCharacterInitializeAttributes(Runtime, Character);
+        RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BUFF));
 
         if (CurrentShield != Character->Attributes.Values[RUNTIME_ATTRIBUTE_DAMAGE_ABSORB]) {
             // TODO: Send notification to cancel shield
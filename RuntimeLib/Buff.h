@@ -65,6 +65,16 @@ struct _RTCharacterBuffInfo {
 
 #pragma pack(pop)
 
+Void RTCharacterScheduleBuffUpdate(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character
+);
+
+Void RTCharacterRefreshBuffUpdate(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character
+);
+
 Void RTCharacterInitializeBuffs(
     RTRuntimeRef Runtime,
     RTCharacterRef Character
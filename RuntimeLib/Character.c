@@ -5,6 +5,7 @@
 #include "Runtime.h"
 #include "NotificationProtocol.h"
 #include "NotificationManager.h"
+#include "WorldManager.h"
 
 Void RTCharacterInitializeConstantAttributes(
 	RTRuntimeRef Runtime,
@@ -371,38 +372,142 @@ Void RTCharacterInitializeMythMastery(
 }
 
 // TODO: Split this up to resources and runtime attributes!!!
-Void RTCharacterInitializeAttributes(
+typedef Void (*RTCharacterAttributeSourceCallback)(
+	RTRuntimeRef Runtime,
+	RTCharacterRef Character
+);
+
+// NOTE: Sources reading attributes of the previous sources (stats, rage, ...) are marked as dependent
+//       and have to be evaluated again whenever the delta of a previous source has changed.
+//       Sources must only write attributes as debug builds evaluate all of them again for validation.
+static const struct {
+	RTCharacterAttributeSourceCallback Callback;
+	Bool IsDependent;
+} kCharacterAttributeSources[RUNTIME_ATTRIBUTE_SOURCE_COUNT] = {
+	{ RTCharacterInitializeConstantAttributes, false },
+	{ RTCharacterInitializeBattleStyleLevel, false },
+	{ RTCharacterInitializeBattleStyleClass, false },
+	{ RTCharacterInitializeSkillStats, true },
+	{ RTCharacterInitializeEssenceAbilities, false },
+	{ RTCharacterInitializeBlendedAbilities, false },
+	{ RTCharacterInitializeKarmaAbilities, false },
+	{ RTCharacterInitializeBlessingBeads, false },
+	{ RTCharacterInitializePremiumServices, false },
+	{ RTCharacterInitializeAchievements, false },
+	{ RTCharacterInitializeGoldMeritMastery, false },
+	{ RTCharacterInitializePlatinumMeritMastery, false },
+	{ RTCharacterInitializeDiamondMeritMastery, false },
+	{ RTCharacterInitializeOverlordMastery, false },
+	{ RTCharacterInitializeHonorMedalMastery, false },
+	{ RTCharacterInitializeForceWingMastery, false },
+	{ RTCharacterInitializeCollection, false },
+	{ RTCharacterInitializeTranscendenceMastery, false },
+	{ RTCharacterInitializeStellarMastery, false },
+	{ RTCharacterInitializeMythMastery, false },
+	{ RTCharacterInitializeAnimaMastery, false },
+	{ RTCharacterInitializeBattleStyleStats, true },
+	{ RTCharacterInitializeEquipment, true },
+	{ RTCharacterInitializeBattleMode, true },
+	{ RTCharacterInitializeBuffs, true },
+};
+
+Void RTCharacterRebuildAttributes(
 	RTRuntimeRef Runtime,
 	RTCharacterRef Character
 ) {
+	RTCharacterAttributeCacheRef Cache = &Character->AttributeCache;
+	Int64* Values = Character->Attributes.Values;
+	Int64 Snapshot[RUNTIME_ATTRIBUTE_COUNT] = { 0 };
+	Bool IsPrefixChanged = false;
+
+	memset(Values, 0, sizeof(Character->Attributes.Values));
+
+	for (Int SourceIndex = 0; SourceIndex < RUNTIME_ATTRIBUTE_SOURCE_COUNT; SourceIndex += 1) {
+		UInt64 SourceMask = RUNTIME_ATTRIBUTE_SOURCE_MASK(SourceIndex);
+		Int64* Delta = Cache->Values[SourceIndex];
+		Bool IsDirty = (Cache->DirtyMask & SourceMask) || (kCharacterAttributeSources[SourceIndex].IsDependent && IsPrefixChanged);
+
+		if (!IsDirty) {
+			if (Cache->EmptyMask & SourceMask) continue;
+
+			for (Int Index = 0; Index < RUNTIME_ATTRIBUTE_COUNT; Index += 1) {
+				Values[Index] += Delta[Index];
+			}
+
+			continue;
+		}
+
+		memcpy(Snapshot, Values, sizeof(Snapshot));
+		kCharacterAttributeSources[SourceIndex].Callback(Runtime, Character);
+
+		Bool IsEmpty = true;
+		Bool IsChanged = false;
+		for (Int Index = 0; Index < RUNTIME_ATTRIBUTE_COUNT; Index += 1) {
+			Int64 Value = Values[Index] - Snapshot[Index];
+			IsEmpty &= (Value == 0);
+			IsChanged |= (Value != Delta[Index]);
+			Delta[Index] = Value;
+		}
+
+		IsPrefixChanged |= IsChanged;
+		Cache->EmptyMask = IsEmpty ? (Cache->EmptyMask | SourceMask) : (Cache->EmptyMask & ~SourceMask);
+	}
+
+	Cache->DirtyMask = 0;
+}
+
+#if defined(DEBUG)
+Void RTCharacterValidateAttributes(
+	RTRuntimeRef Runtime,
+	RTCharacterRef Character
+) {
+	struct _RTBattleAttributes Attributes = Character->Attributes;
+
 	memset(Character->Attributes.Values, 0, sizeof(Character->Attributes.Values));
+	for (Int SourceIndex = 0; SourceIndex < RUNTIME_ATTRIBUTE_SOURCE_COUNT; SourceIndex += 1) {
+		kCharacterAttributeSources[SourceIndex].Callback(Runtime, Character);
+	}
+
+	for (Int Index = 0; Index < RUNTIME_ATTRIBUTE_COUNT; Index += 1) {
+		if (Character->Attributes.Values[Index] == Attributes.Values[Index]) continue;
+
+		Error(
+			"Character(%d) attribute(%d) cache mismatch: %lld != %lld",
+			(Int32)Character->CharacterIndex,
+			(Int32)Index,
+			(long long)Attributes.Values[Index],
+			(long long)Character->Attributes.Values[Index]
+		);
+	}
+
+	Character->Attributes = Attributes;
+}
+#endif
+
+Void RTCharacterInitializeAttributes(
+	RTRuntimeRef Runtime,
+	RTCharacterRef Character
+) {
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK_ALL);
+}
+
+Void RTCharacterUpdateAttributes(
+	RTRuntimeRef Runtime,
+	RTCharacterRef Character,
+	UInt64 SourceMask
+) {
+	Character->AttributeCache.DirtyMask |= SourceMask;
+	RTCharacterRebuildAttributes(Runtime, Character);
+
+#if defined(DEBUG)
+	RTCharacterValidateAttributes(Runtime, Character);
+#endif
+
+	if (SourceMask & RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BUFF)) {
+		RTCharacterRefreshBuffUpdate(Runtime, Character);
+	}
 
 	Character->Attributes.Seed = (Int32)PlatformGetTickCount();
-	RTCharacterInitializeConstantAttributes(Runtime, Character);
-    RTCharacterInitializeBattleStyleLevel(Runtime, Character);
-	RTCharacterInitializeBattleStyleClass(Runtime, Character);
-    RTCharacterInitializeSkillStats(Runtime, Character);
-    RTCharacterInitializeEssenceAbilities(Runtime, Character);
-    RTCharacterInitializeBlendedAbilities(Runtime, Character);
-    RTCharacterInitializeKarmaAbilities(Runtime, Character);
-    RTCharacterInitializeBlessingBeads(Runtime, Character);
-    RTCharacterInitializePremiumServices(Runtime, Character);
-    RTCharacterInitializeAchievements(Runtime, Character);
-    RTCharacterInitializeGoldMeritMastery(Runtime, Character);
-    RTCharacterInitializePlatinumMeritMastery(Runtime, Character);
-	RTCharacterInitializeDiamondMeritMastery(Runtime, Character);
-    RTCharacterInitializeOverlordMastery(Runtime, Character);
-    RTCharacterInitializeHonorMedalMastery(Runtime, Character);
-    RTCharacterInitializeForceWingMastery(Runtime, Character);
-    RTCharacterInitializeCollection(Runtime, Character);
-    RTCharacterInitializeTranscendenceMastery(Runtime, Character);
-    RTCharacterInitializeStellarMastery(Runtime, Character);
-    RTCharacterInitializeMythMastery(Runtime, Character);
-	RTCharacterInitializeAnimaMastery(Runtime, Character);
-	RTCharacterInitializeBattleStyleStats(Runtime, Character);
-	RTCharacterInitializeEquipment(Runtime, Character);
-	RTCharacterInitializeBattleMode(Runtime, Character);
-	RTCharacterInitializeBuffs(Runtime, Character);
 
 	RTCharacterSetHP(Runtime, Character, MIN(
 		Character->Attributes.Values[RUNTIME_ATTRIBUTE_HP_MAX],
@@ -443,10 +548,8 @@ Void RTCharacterUpdate(
 	RTRuntimeRef Runtime,
 	RTCharacterRef Character
 ) {
-	if (!RTCharacterIsAlive(Runtime, Character)) return;
-
 	Timestamp CurrentTimestamp = GetTimestampMs();
-	if (Character->RegenUpdateTimestamp <= CurrentTimestamp) {
+	if (RTCharacterIsAlive(Runtime, Character) && Character->RegenUpdateTimestamp <= CurrentTimestamp) {
 		Character->RegenUpdateTimestamp = CurrentTimestamp + RUNTIME_REGENERATION_INTERVAL;
 
 		Int32 SpRegen = (Int32)Character->Attributes.Values[RUNTIME_ATTRIBUTE_SP_REGEN];
@@ -484,7 +587,37 @@ Void RTCharacterUpdate(
 		RTCharacterUpdateBattleMode(Runtime, Character);
 	}
 
-	RTCharacterUpdateBuffs(Runtime, Character, false);
+	RTCharacterScheduleSync(Runtime, Character);
+
+	// NOTE: Dead characters are checked again after the regeneration interval
+	Timestamp NextUpdateTimestamp = CurrentTimestamp + RUNTIME_REGENERATION_INTERVAL;
+	if (Character->RegenUpdateTimestamp > CurrentTimestamp) {
+		NextUpdateTimestamp = Character->RegenUpdateTimestamp;
+	}
+
+	TimerWheelCancel(Runtime->TimerWheel, Character->UpdateTimer);
+	Character->UpdateTimer = TimerWheelSchedule(
+		Runtime->TimerWheel,
+		NextUpdateTimestamp,
+		RUNTIME_TIMER_TYPE_CHARACTER_UPDATE,
+		Character->CharacterIndex
+	);
+}
+
+Void RTCharacterScheduleSync(
+	RTRuntimeRef Runtime,
+	RTCharacterRef Character
+) {
+	if (!Character->SyncMask.RawValue || Character->IsSyncQueued) return;
+
+	// NOTE: The deadline keeps the minimum interval between two syncs of the same character
+	Character->IsSyncQueued = true;
+	Character->SyncTimer = TimerWheelSchedule(
+		Runtime->TimerWheel,
+		Character->SyncTimestamp + Runtime->Config.CharacterSyncInterval,
+		RUNTIME_TIMER_TYPE_CHARACTER_SYNC,
+		Character->CharacterIndex
+	);
 }
 
 Bool RTCharacterIsAlive(
@@ -1193,7 +1326,7 @@ Bool RTCharacterAddStats(
 
 	Character->SyncMask.Info = true;
 
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_CONSTANT));
 
 	return true;
 }
@@ -1215,7 +1348,7 @@ Bool RTCharacterRemoveStat(
 
 	Character->SyncMask.Info = true;
 
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_CONSTANT));
 
 	return true;
 }
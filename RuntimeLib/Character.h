@@ -74,6 +74,47 @@ enum {
     RUNTIME_CHARACTER_STAT_COUNT
 };
 
+enum {
+    RUNTIME_ATTRIBUTE_SOURCE_CONSTANT,
+    RUNTIME_ATTRIBUTE_SOURCE_BATTLE_STYLE_LEVEL,
+    RUNTIME_ATTRIBUTE_SOURCE_BATTLE_STYLE_CLASS,
+    RUNTIME_ATTRIBUTE_SOURCE_SKILL,
+    RUNTIME_ATTRIBUTE_SOURCE_ESSENCE_ABILITY,
+    RUNTIME_ATTRIBUTE_SOURCE_BLENDED_ABILITY,
+    RUNTIME_ATTRIBUTE_SOURCE_KARMA_ABILITY,
+    RUNTIME_ATTRIBUTE_SOURCE_BLESSING_BEAD,
+    RUNTIME_ATTRIBUTE_SOURCE_PREMIUM_SERVICE,
+    RUNTIME_ATTRIBUTE_SOURCE_ACHIEVEMENT,
+    RUNTIME_ATTRIBUTE_SOURCE_GOLD_MERIT_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_PLATINUM_MERIT_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_DIAMOND_MERIT_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_OVERLORD_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_HONOR_MEDAL_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_FORCE_WING_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_COLLECTION,
+    RUNTIME_ATTRIBUTE_SOURCE_TRANSCENDENCE_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_STELLAR_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_MYTH_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_ANIMA_MASTERY,
+    RUNTIME_ATTRIBUTE_SOURCE_BATTLE_STYLE_STATS,
+    RUNTIME_ATTRIBUTE_SOURCE_EQUIPMENT,
+    RUNTIME_ATTRIBUTE_SOURCE_BATTLE_MODE,
+    RUNTIME_ATTRIBUTE_SOURCE_BUFF,
+
+    RUNTIME_ATTRIBUTE_SOURCE_COUNT
+};
+
+#define RUNTIME_ATTRIBUTE_SOURCE_MASK(__SOURCE__) (1ULL << (__SOURCE__))
+#define RUNTIME_ATTRIBUTE_SOURCE_MASK_ALL ((1ULL << RUNTIME_ATTRIBUTE_SOURCE_COUNT) - 1)
+
+// NOTE: Each source keeps the delta it adds on top of the sources before it,
+//       clean sources are summed up and only the dirty ones are evaluated again.
+struct _RTCharacterAttributeCache {
+    UInt64 DirtyMask;
+    UInt64 EmptyMask;
+    Int64 Values[RUNTIME_ATTRIBUTE_SOURCE_COUNT][RUNTIME_ATTRIBUTE_COUNT];
+};
+
 union _RTCharacterStyle {
     struct {
         UInt32 BattleStyle : 3;
@@ -213,12 +254,18 @@ struct _RTCharacter {
     Timestamp SyncTimestamp;
 
     struct _RTMovement Movement;
+    Int32 WorldChunkSlotIndex;
     struct _RTBattleAttributes Attributes;
+    struct _RTCharacterAttributeCache AttributeCache;
     Int32 AbilityExpRate;
     Int32 SkillComboLevel;
     Timestamp BuffUpdateTimestamp;
     Timestamp LastBuffUpdateTimestamp;
     Timestamp RegenUpdateTimestamp;
+    TimerID BuffTimer;
+    TimerID UpdateTimer;
+    TimerID SyncTimer;
+    Bool IsSyncQueued;
     Timestamp GiftBoxUpdateTimestamps[RUNTIME_CHARACTER_MAX_GIFT_BOX_SLOT_COUNT];
     Int32 MobPatternWarpX;
     Int32 MobPatternWarpY;
@@ -231,11 +278,22 @@ Void RTCharacterInitializeAttributes(
     RTCharacterRef Character
 );
 
+Void RTCharacterUpdateAttributes(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character,
+    UInt64 SourceMask
+);
+
 Void RTCharacterUpdate(
     RTRuntimeRef Runtime,
     RTCharacterRef Character
 );
 
+Void RTCharacterScheduleSync(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character
+);
+
 Bool RTCharacterIsAlive(
     RTRuntimeRef Runtime,
     RTCharacterRef Character
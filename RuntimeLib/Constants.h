@@ -138,6 +138,12 @@
 #define RUNTIME_MOVEMENT_SPEED_SCALE							100
 #define RUNTIME_MOVEMENT_MAX_DISTANCE_IN_RANGE					8
 #define RUNTIME_MOVEMENT_MAX_PATH_FIND_NODE_COUNT				1024
+#define RUNTIME_MOVEMENT_MAX_PATH_LENGTH						4096
+
+#define RUNTIME_PATH_FINDING_CACHE_SIZE							64
+#define RUNTIME_PATH_FINDING_GRAPH_MIN_DISTANCE					(RUNTIME_WORLD_CHUNK_SIZE * 2)
+#define RUNTIME_PATH_FINDING_MAX_ENTRANCE_LENGTH				6
+#define RUNTIME_PATH_FINDING_MAX_GRAPH_COUNT					4
 
 #define RUNTIME_NATION_COUNT						            3
 
@@ -171,6 +177,7 @@
 
 #define RUNTIME_BATTLE_MODE_SP_CONSUMPTION						5000
 #define RUNTIME_REGENERATION_INTERVAL							2000
+#define RUNTIME_TIMER_WHEEL_RESOLUTION							10
 
 #define RUNTIME_MAX_SETTINGS_DATA_LENGTH						1024
 
@@ -4,30 +4,325 @@
 #include "OptionPool.h"
 #include "Runtime.h"
 #include "World.h"
+#include "WorldManager.h"
 
-Bool RTDropPoolRollItem( 
+#define RUNTIME_DROP_ALIAS_THRESHOLD_SCALE ((UInt32)1 << 31)
+
+static Bool RTDropItemIsInMobLevel(
+    RTDropItemRef DropItem,
+    Int32 MobLevel
+) {
+    if (MobLevel > 0 && DropItem->MinMobLevel > MobLevel) return false;
+    if (MobLevel > 0 && DropItem->MaxMobLevel < MobLevel) return false;
+    return true;
+}
+
+static Void RTDropAliasPoolBuildBucket(
+    RTDropAliasPoolRef AliasPool,
+    RTDropAliasBucketRef Bucket,
+    Int32 MobLevel,
+    UInt64* ScaledDropRates,
+    Int32* SmallIndices,
+    Int32* LargeIndices
+) {
+    Bucket->TotalDropRate = 0;
+    Bucket->EntryOffset = AliasPool->EntryCount;
+    Bucket->EntryCount = 0;
+
+    for (Int DropIndex = 0; DropIndex < ArrayGetElementCount(AliasPool->DropPool); DropIndex += 1) {
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(AliasPool->DropPool, DropIndex);
+        if (DropItem->DropRate <= 0 || !RTDropItemIsInMobLevel(DropItem, MobLevel)) continue;
+
+        RTDropAliasEntryRef Entry = &AliasPool->Entries[Bucket->EntryOffset + Bucket->EntryCount];
+        Entry->DropIndex = (Int32)DropIndex;
+        Entry->AliasIndex = Bucket->EntryCount;
+        Entry->Threshold = RUNTIME_DROP_ALIAS_THRESHOLD_SCALE;
+        Bucket->TotalDropRate += DropItem->DropRate;
+        Bucket->EntryCount += 1;
+    }
+
+    AliasPool->EntryCount += Bucket->EntryCount;
+    if (Bucket->EntryCount < 1) return;
+
+    RTDropAliasEntryRef Entries = &AliasPool->Entries[Bucket->EntryOffset];
+    UInt64 TotalDropRate = (UInt64)Bucket->TotalDropRate;
+    Int32 SmallCount = 0;
+    Int32 LargeCount = 0;
+    for (Int32 Index = 0; Index < Bucket->EntryCount; Index += 1) {
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(AliasPool->DropPool, Entries[Index].DropIndex);
+        ScaledDropRates[Index] = (UInt64)DropItem->DropRate * (UInt64)Bucket->EntryCount;
+
+        if (ScaledDropRates[Index] < TotalDropRate) {
+            SmallIndices[SmallCount++] = Index;
+        }
+        else {
+            LargeIndices[LargeCount++] = Index;
+        }
+    }
+
+    while (SmallCount > 0 && LargeCount > 0) {
+        Int32 SmallIndex = SmallIndices[--SmallCount];
+        Int32 LargeIndex = LargeIndices[LargeCount - 1];
+
+        Entries[SmallIndex].AliasIndex = LargeIndex;
+        Entries[SmallIndex].Threshold = (UInt32)((Float64)ScaledDropRates[SmallIndex] / (Float64)TotalDropRate * RUNTIME_DROP_ALIAS_THRESHOLD_SCALE);
+
+        ScaledDropRates[LargeIndex] -= TotalDropRate - ScaledDropRates[SmallIndex];
+        if (ScaledDropRates[LargeIndex] < TotalDropRate) {
+            LargeCount -= 1;
+            SmallIndices[SmallCount++] = LargeIndex;
+        }
+    }
+}
+
+#if defined(DEBUG)
+static Void RTDropAliasPoolValidateBucket(
+    RTDropAliasPoolRef AliasPool,
+    RTDropAliasBucketRef Bucket,
+    Int32 MobLevel
+) {
+    RTDropAliasEntryRef Entries = &AliasPool->Entries[Bucket->EntryOffset];
+    Int64 TotalDropRate = 0;
+
+    for (Int DropIndex = 0; DropIndex < ArrayGetElementCount(AliasPool->DropPool); DropIndex += 1) {
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(AliasPool->DropPool, DropIndex);
+        if (DropItem->DropRate <= 0 || !RTDropItemIsInMobLevel(DropItem, MobLevel)) continue;
+
+        TotalDropRate += DropItem->DropRate;
+    }
+
+    if (TotalDropRate != Bucket->TotalDropRate) {
+        Error("Drop alias bucket for mob level %d has total rate %lld instead of %lld", MobLevel, (long long)Bucket->TotalDropRate, (long long)TotalDropRate);
+        return;
+    }
+
+    for (Int32 Index = 0; Index < Bucket->EntryCount; Index += 1) {
+        Float64 Probability = 0.0;
+        for (Int32 Column = 0; Column < Bucket->EntryCount; Column += 1) {
+            Float64 Threshold = (Float64)Entries[Column].Threshold / RUNTIME_DROP_ALIAS_THRESHOLD_SCALE;
+            if (Column == Index) Probability += Threshold;
+            if (Entries[Column].AliasIndex == Index && Column != Index) Probability += 1.0 - Threshold;
+        }
+
+        Probability /= Bucket->EntryCount;
+
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(AliasPool->DropPool, Entries[Index].DropIndex);
+        Float64 ExpectedProbability = (Float64)DropItem->DropRate / (Float64)TotalDropRate;
+        if (ABS(Probability - ExpectedProbability) > 1e-6) {
+            Error("Drop alias entry %d for mob level %d has probability %f instead of %f", Entries[Index].DropIndex, MobLevel, Probability, ExpectedProbability);
+        }
+    }
+}
+#endif
+
+RTDropAliasPoolRef RTDropAliasPoolCreate(
+    AllocatorRef Allocator,
+    ArrayRef DropPool
+) {
+    Int32 DropCount = (Int32)ArrayGetElementCount(DropPool);
+    Int32 MaxMobLevel = 0;
+    for (Int Index = 0; Index < DropCount; Index += 1) {
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(DropPool, Index);
+        MaxMobLevel = MAX(MaxMobLevel, MAX(DropItem->MinMobLevel, DropItem->MaxMobLevel));
+    }
+
+    // NOTE: Bucket 0 is used for unfiltered rolls, every level after it starts a new bucket when an item range begins or ends
+    Int32 LevelCount = MaxMobLevel + 2;
+    Int32* LevelToBucket = (Int32*)AllocatorAllocate(Allocator, sizeof(Int32) * LevelCount);
+    if (!LevelToBucket) Fatal("Memory allocation failed!");
+    memset(LevelToBucket, 0, sizeof(Int32) * LevelCount);
+
+    for (Int Index = 0; Index < DropCount; Index += 1) {
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(DropPool, Index);
+        if (DropItem->MinMobLevel >= 1) LevelToBucket[DropItem->MinMobLevel] = 1;
+        if (DropItem->MaxMobLevel >= 0 && DropItem->MaxMobLevel + 1 < LevelCount) LevelToBucket[DropItem->MaxMobLevel + 1] = 1;
+    }
+
+    Int32 BucketCount = 1;
+    for (Int32 Level = 1; Level < LevelCount; Level += 1) {
+        if (Level == 1 || LevelToBucket[Level]) BucketCount += 1;
+        LevelToBucket[Level] = BucketCount - 1;
+    }
+
+    RTDropAliasPoolRef AliasPool = (RTDropAliasPoolRef)AllocatorAllocate(Allocator, sizeof(struct _RTDropAliasPool));
+    if (!AliasPool) Fatal("Memory allocation failed!");
+
+    AliasPool->DropPool = DropPool;
+    AliasPool->MaxMobLevel = MaxMobLevel;
+    AliasPool->BucketCount = BucketCount;
+    AliasPool->EntryCount = 0;
+    AliasPool->LevelToBucket = LevelToBucket;
+    AliasPool->Buckets = (RTDropAliasBucketRef)AllocatorAllocate(Allocator, sizeof(struct _RTDropAliasBucket) * BucketCount);
+    AliasPool->Entries = (RTDropAliasEntryRef)AllocatorAllocate(Allocator, sizeof(struct _RTDropAliasEntry) * MAX(1, BucketCount * DropCount));
+    if (!AliasPool->Buckets || !AliasPool->Entries) Fatal("Memory allocation failed!");
+
+    UInt64* ScaledDropRates = (UInt64*)AllocatorAllocate(Allocator, sizeof(UInt64) * MAX(1, DropCount));
+    Int32* SmallIndices = (Int32*)AllocatorAllocate(Allocator, sizeof(Int32) * MAX(1, DropCount));
+    Int32* LargeIndices = (Int32*)AllocatorAllocate(Allocator, sizeof(Int32) * MAX(1, DropCount));
+    if (!ScaledDropRates || !SmallIndices || !LargeIndices) Fatal("Memory allocation failed!");
+
+    RTDropAliasPoolBuildBucket(AliasPool, &AliasPool->Buckets[0], 0, ScaledDropRates, SmallIndices, LargeIndices);
+    for (Int32 Level = 1; Level < LevelCount; Level += 1) {
+        if (LevelToBucket[Level] == LevelToBucket[Level - 1]) continue;
+
+        RTDropAliasPoolBuildBucket(AliasPool, &AliasPool->Buckets[LevelToBucket[Level]], Level, ScaledDropRates, SmallIndices, LargeIndices);
+    }
+
+#if defined(DEBUG)
+    for (Int32 Level = 0; Level < LevelCount; Level += 1) {
+        if (Level > 1 && LevelToBucket[Level] == LevelToBucket[Level - 1]) continue;
+
+        RTDropAliasPoolValidateBucket(AliasPool, &AliasPool->Buckets[LevelToBucket[Level]], Level);
+    }
+#endif
+
+    AllocatorDeallocate(Allocator, LargeIndices);
+    AllocatorDeallocate(Allocator, SmallIndices);
+    AllocatorDeallocate(Allocator, ScaledDropRates);
+
+    return AliasPool;
+}
+
+Void RTDropAliasPoolDestroy(
+    AllocatorRef Allocator,
+    RTDropAliasPoolRef AliasPool
+) {
+    AllocatorDeallocate(Allocator, AliasPool->Entries);
+    AllocatorDeallocate(Allocator, AliasPool->Buckets);
+    AllocatorDeallocate(Allocator, AliasPool->LevelToBucket);
+    AllocatorDeallocate(Allocator, AliasPool);
+}
+
+static Void RTDropPoolResolveOptionPools(
     RTRuntimeRef Runtime,
+    ArrayRef DropPool
+) {
+    for (Int Index = 0; Index < ArrayGetElementCount(DropPool); Index += 1) {
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(DropPool, Index);
+        DropItem->OptionPoolTable = NULL;
+        if (DropItem->OptionPoolIndex < 1) continue;
+
+        RTItemDataRef ItemData = RTRuntimeGetItemDataByIndex(Runtime, DropItem->ItemID.ID);
+        if (!ItemData) continue;
+
+        DropItem->OptionPoolTable = RTOptionPoolManagerGetItemTypeTable(Runtime->OptionPoolManager, DropItem->OptionPoolIndex, ItemData->ItemType);
+    }
+}
+
+Void RTDropTableDestroyAliasPools(
+    RTRuntimeRef Runtime,
+    RTDropTableRef DropTable
+) {
+    if (DropTable->WorldDropAliasPool) {
+        RTDropAliasPoolDestroy(Runtime->Allocator, DropTable->WorldDropAliasPool);
+        DropTable->WorldDropAliasPool = NULL;
+    }
+
+    if (DropTable->MobDropAliasPool) {
+        DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(DropTable->MobDropAliasPool);
+        while (Iterator.Key) {
+            RTDropAliasPoolDestroy(Runtime->Allocator, *(RTDropAliasPoolRef*)Iterator.Value);
+            Iterator = DictionaryKeyIteratorNext(Iterator);
+        }
+
+        DictionaryDestroy(DropTable->MobDropAliasPool);
+        DropTable->MobDropAliasPool = NULL;
+    }
+}
+
+Void RTDropTableCompile(
+    RTRuntimeRef Runtime,
+    RTDropTableRef DropTable
+) {
+    RTDropTableDestroyAliasPools(Runtime, DropTable);
+
+    if (DropTable->WorldDropPool) {
+        RTDropPoolResolveOptionPools(Runtime, DropTable->WorldDropPool);
+        DropTable->WorldDropAliasPool = RTDropAliasPoolCreate(Runtime->Allocator, DropTable->WorldDropPool);
+    }
+
+    if (DropTable->MobDropPool) {
+        DropTable->MobDropAliasPool = IndexDictionaryCreate(Runtime->Allocator, 8);
+
+        DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(DropTable->MobDropPool);
+        while (Iterator.Key) {
+            RTDropPoolResolveOptionPools(Runtime, (ArrayRef)Iterator.Value);
+            RTDropAliasPoolRef AliasPool = RTDropAliasPoolCreate(Runtime->Allocator, (ArrayRef)Iterator.Value);
+            DictionaryInsert(DropTable->MobDropAliasPool, Iterator.Key, &AliasPool, sizeof(RTDropAliasPoolRef));
+            Iterator = DictionaryKeyIteratorNext(Iterator);
+        }
+    }
+}
+
+Void RTRuntimeCompileDropTables(
+    RTRuntimeRef Runtime
+) {
+    RTDropTableCompile(Runtime, &Runtime->DropTable);
+
+    for (Int WorldIndex = 0; WorldIndex < Runtime->WorldManager->MaxWorldDataCount; WorldIndex += 1) {
+        if (!RTWorldDataExists(Runtime->WorldManager, WorldIndex)) continue;
+
+        RTWorldDataRef WorldData = RTWorldDataGet(Runtime->WorldManager, WorldIndex);
+        RTDropTableCompile(Runtime, &WorldData->DropTable);
+    }
+
+    DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(Runtime->DungeonData);
+    while (Iterator.Key) {
+        RTDungeonDataRef DungeonData = (RTDungeonDataRef)Iterator.Value;
+        RTDropTableCompile(Runtime, &DungeonData->DropTable);
+        Iterator = DictionaryKeyIteratorNext(Iterator);
+    }
+}
+
+Bool RTDropAliasPoolRollItem(
+    RTRuntimeRef Runtime,
+    Int32* Seed,
     Int32 DropRateValue,
-    Int32* DropRateOffset,
-    ArrayRef DropPool,
+    Int64* DropRateOffset,
+    RTDropAliasPoolRef AliasPool,
     Int32 MobLevel,
     RTDropResultRef Result
 ) {
-    for (Int DropIndex = 0; DropIndex < ArrayGetElementCount(DropPool); DropIndex += 1) {
-        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(DropPool, DropIndex);
-        if (MobLevel > 0 && DropItem->MinMobLevel > MobLevel) continue;
-        if (MobLevel > 0 && DropItem->MaxMobLevel < MobLevel) continue;
-        if (DropRateValue <= *DropRateOffset + DropItem->DropRate) {
-            Result->ItemID = DropItem->ItemID;
-            Result->ItemOptions = DropItem->ItemOptions;
-            Result->ItemDuration.DurationIndex = DropItem->DurationIndex;
-            RTOptionPoolManagerCalculateOptions(Runtime, Runtime->OptionPoolManager, DropItem->OptionPoolIndex, Result);
-            return true;
-        }
+    if (!AliasPool) return false;
+
+    Int32 BucketIndex = (MobLevel > 0) ? AliasPool->LevelToBucket[MIN(MobLevel, AliasPool->MaxMobLevel + 1)] : 0;
+    RTDropAliasBucketRef Bucket = &AliasPool->Buckets[BucketIndex];
+    if (Bucket->EntryCount < 1) return false;
 
-        *DropRateOffset += DropItem->DropRate;
+    if (DropRateValue > *DropRateOffset + Bucket->TotalDropRate) {
+        *DropRateOffset += Bucket->TotalDropRate;
+        return false;
     }
 
+    RTDropAliasEntryRef Entries = &AliasPool->Entries[Bucket->EntryOffset];
+    // NOTE: The column is taken from the high bits of a single roll and the remainder is compared to its threshold,
+    //       the low bits and consecutive rolls of the generator are too correlated to be drawn separately
+    UInt64 AliasValue = (UInt64)Random(Seed) * (UInt64)Bucket->EntryCount;
+    RTDropAliasEntryRef Entry = &Entries[AliasValue / RUNTIME_DROP_ALIAS_THRESHOLD_SCALE];
+    if ((UInt32)(AliasValue % RUNTIME_DROP_ALIAS_THRESHOLD_SCALE) >= Entry->Threshold) Entry = &Entries[Entry->AliasIndex];
+
+    RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(AliasPool->DropPool, Entry->DropIndex);
+    Result->ItemID = DropItem->ItemID;
+    Result->ItemOptions = DropItem->ItemOptions;
+    Result->ItemDuration.DurationIndex = DropItem->DurationIndex;
+    RTOptionPoolManagerCalculateOptions(DropItem->OptionPoolTable, Seed, Result);
+    return true;
+}
+
+Bool RTDropTableRollItem(
+    RTRuntimeRef Runtime,
+    RTDropTableRef DropTable,
+    Int32* Seed,
+    Int32 DropRateValue,
+    Int64* DropRateOffset,
+    Int DropPoolIndex,
+    Int32 MobLevel,
+    RTDropResultRef Result
+) {
+    RTDropAliasPoolRef* AliasPool = (DropTable->MobDropAliasPool) ? (RTDropAliasPoolRef*)DictionaryLookup(DropTable->MobDropAliasPool, &DropPoolIndex) : NULL;
+    if (AliasPool && RTDropAliasPoolRollItem(Runtime, Seed, DropRateValue, DropRateOffset, *AliasPool, 0, Result)) return true;
+    if (RTDropAliasPoolRollItem(Runtime, Seed, DropRateValue, DropRateOffset, DropTable->WorldDropAliasPool, MobLevel, Result)) return true;
+
     return false;
 }
 
@@ -38,42 +333,20 @@ Bool RTCalculateDrop(
     RTCharacterRef Character,
     RTDropResultRef Result
 ) {
-    Int32 Seed = (Int32)PlatformGetTickCount();
     Int32 DropRateValue = RandomRange(&World->Seed, 0, INT32_MAX);
-    Int32 DropRateOffset = 0;
+    Int64 DropRateOffset = 0;
     Int32 Level = (Int32)Mob->Attributes.Values[RUNTIME_ATTRIBUTE_LEVEL];
+    Int DropPoolIndex = Mob->SpeciesData->MobSpeciesIndex;
 
     if (World->DungeonIndex > 0) {
         RTDungeonDataRef DungeonData = RTRuntimeGetDungeonDataByID(Runtime, World->DungeonIndex);
         assert(DungeonData);
 
-        Int DropPoolIndex = Mob->SpeciesData->MobSpeciesIndex;
-        ArrayRef DropPool = (ArrayRef)DictionaryLookup(DungeonData->DropTable.MobDropPool, &DropPoolIndex);
-        if (DropPool) {
-            if (RTDropPoolRollItem(Runtime, DropRateValue, &DropRateOffset, DropPool, 0, Result)) return true;
-        }
-
-        DropPool = DungeonData->DropTable.WorldDropPool;
-        if (RTDropPoolRollItem(Runtime, DropRateValue, &DropRateOffset, DropPool, Level, Result)) return true;
-    }
-
-    Int DropPoolIndex = Mob->SpeciesData->MobSpeciesIndex;
-    ArrayRef DropPool = (ArrayRef)DictionaryLookup(World->WorldData->DropTable.MobDropPool, &DropPoolIndex);
-    if (DropPool) {
-        if (RTDropPoolRollItem(Runtime, DropRateValue, &DropRateOffset, DropPool, 0, Result)) return true;
-    }
-
-    DropPool = World->WorldData->DropTable.WorldDropPool;
-    if (RTDropPoolRollItem(Runtime, DropRateValue, &DropRateOffset, DropPool, Level, Result)) return true;
-    
-    DropPoolIndex = Mob->SpeciesData->MobSpeciesIndex;
-    DropPool = (ArrayRef)DictionaryLookup(Runtime->DropTable.MobDropPool, &DropPoolIndex);
-    if (DropPool) {
-        if (RTDropPoolRollItem(Runtime, DropRateValue, &DropRateOffset, DropPool, 0, Result)) return true;
+        if (RTDropTableRollItem(Runtime, &DungeonData->DropTable, &World->Seed, DropRateValue, &DropRateOffset, DropPoolIndex, Level, Result)) return true;
     }
 
-    DropPool = Runtime->DropTable.WorldDropPool;
-    if (RTDropPoolRollItem(Runtime, DropRateValue, &DropRateOffset, DropPool, Level, Result)) return true;
+    if (RTDropTableRollItem(Runtime, &World->WorldData->DropTable, &World->Seed, DropRateValue, &DropRateOffset, DropPoolIndex, Level, Result)) return true;
+    if (RTDropTableRollItem(Runtime, &Runtime->DropTable, &World->Seed, DropRateValue, &DropRateOffset, DropPoolIndex, Level, Result)) return true;
 
     return false;
 }
@@ -15,12 +15,39 @@ struct _RTDropItem {
     Int32 DurationIndex;
     Int32 MinMobLevel;
     Int32 MaxMobLevel;
+    RTOptionPoolItemTypeTableRef OptionPoolTable;
+};
+
+struct _RTDropAliasEntry {
+    Int32 DropIndex;
+    Int32 AliasIndex;
+    UInt32 Threshold;
+};
+typedef struct _RTDropAliasEntry* RTDropAliasEntryRef;
+
+struct _RTDropAliasBucket {
+    Int64 TotalDropRate;
+    Int32 EntryOffset;
+    Int32 EntryCount;
+};
+typedef struct _RTDropAliasBucket* RTDropAliasBucketRef;
+
+struct _RTDropAliasPool {
+    ArrayRef DropPool;
+    Int32 MaxMobLevel;
+    Int32 BucketCount;
+    Int32 EntryCount;
+    Int32* LevelToBucket;
+    RTDropAliasBucketRef Buckets;
+    RTDropAliasEntryRef Entries;
 };
 
 struct _RTDropTable {
     ArrayRef WorldDropPool;
     DictionaryRef MobDropPool;
     DictionaryRef QuestDropPool;
+    RTDropAliasPoolRef WorldDropAliasPool;
+    DictionaryRef MobDropAliasPool;
 };
 
 struct _RTDropResult {
@@ -31,6 +58,33 @@ struct _RTDropResult {
 };
 typedef struct _RTDropResult RTDropResult;
 
+Void RTDropTableDestroyAliasPools(
+    RTRuntimeRef Runtime,
+    RTDropTableRef DropTable
+);
+
+Void RTDropTableCompile(
+    RTRuntimeRef Runtime,
+    RTDropTableRef DropTable
+);
+
+Void RTRuntimeCompileDropTables(
+    RTRuntimeRef Runtime
+);
+
+// NOTE: Rolls the species pool and then the level filtered world pool of the table,
+//       the offset is advanced by the rates of both pools when nothing has been dropped
+Bool RTDropTableRollItem(
+    RTRuntimeRef Runtime,
+    RTDropTableRef DropTable,
+    Int32* Seed,
+    Int32 DropRateValue,
+    Int64* DropRateOffset,
+    Int DropPoolIndex,
+    Int32 MobLevel,
+    RTDropResultRef Result
+);
+
 Bool RTCalculateDrop(
     RTRuntimeRef Runtime,
     RTWorldContextRef World,
@@ -165,7 +165,7 @@ Bool RTCharacterForceWingSetActivePreset(
 	if (PresetPageIndex < 0 || PresetPageIndex >= RUNTIME_CHARACTER_MAX_FORCE_WING_PRESET_PAGE_COUNT) return false;
 	if (!Character->Data.ForceWingInfo.Info.PresetEnabled[PresetPageIndex]) return false;
 
-    RTCharacterInitializeAttributes(Runtime, Character);
+    RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_FORCE_WING_MASTERY));
 
 	Character->Data.ForceWingInfo.Info.ActivePresetIndex = PresetPageIndex;
 	Character->SyncMask.ForceWingInfo = true;
@@ -3,39 +3,114 @@
 #include "Inventory.h"
 #include "Runtime.h"
 
+#define RUNTIME_INVENTORY_SLOT_MASK_COUNT (RUNTIME_INVENTORY_TOTAL_SIZE / 64)
+
 static struct _RTCharacterInventoryInfo kInventorySnapshot = { 0 };
 
 // TODO: Move rollback logic to here...
 
-Int32 RTInventoryGetNextFreeSlotIndex(
+static inline Bool RTInventoryIsSlotIndexValid(
+	Int32 SlotIndex
+) {
+	return 0 <= SlotIndex && SlotIndex < RUNTIME_INVENTORY_TOTAL_SIZE;
+}
+
+static inline Void RTInventoryLinkSlot(
+	RTCharacterInventoryInfoRef Inventory,
+	Int32 SlotIndex,
+	Int32 StorageIndex
+) {
+	Inventory->SlotMap[SlotIndex] = (UInt16)(StorageIndex + 1);
+	Inventory->SlotMask[SlotIndex / 64] |= (UInt64)1 << (SlotIndex % 64);
+}
+
+static inline Void RTInventoryUnlinkSlot(
+	RTCharacterInventoryInfoRef Inventory,
+	Int32 SlotIndex
+) {
+	Inventory->SlotMap[SlotIndex] = 0;
+	Inventory->SlotMask[SlotIndex / 64] &= ~((UInt64)1 << (SlotIndex % 64));
+}
+
+static Int32 RTInventoryFindFreeSlotIndex(
+	RTCharacterInventoryInfoRef Inventory,
+	Int32 Offset
+) {
+	Int32 MaskIndex = Offset / 64;
+	UInt64 FreeMask = ~Inventory->SlotMask[MaskIndex] & (~(UInt64)0 << (Offset % 64));
+	while (!FreeMask) {
+		MaskIndex += 1;
+		if (MaskIndex >= RUNTIME_INVENTORY_SLOT_MASK_COUNT) return -1;
+
+		FreeMask = ~Inventory->SlotMask[MaskIndex];
+	}
+
+	return MaskIndex * 64 + CountTrailingZeros64(FreeMask);
+}
+
+static Void RTInventoryAppendSlot(
+	RTCharacterInventoryInfoRef Inventory,
+	RTItemSlotRef Slot
+) {
+	Int32 StorageIndex = Inventory->Info.SlotCount;
+	if (StorageIndex > 0 && Inventory->Slots[StorageIndex - 1].SlotIndex > Slot->SlotIndex) {
+		Inventory->IsUnsorted = true;
+	}
+
+	memcpy(&Inventory->Slots[StorageIndex], Slot, sizeof(struct _RTItemSlot));
+	RTInventoryLinkSlot(Inventory, Slot->SlotIndex, StorageIndex);
+	Inventory->Info.SlotCount += 1;
+}
+
+Void RTInventoryInitialize(
 	RTRuntimeRef Runtime,
 	RTCharacterInventoryInfoRef Inventory
 ) {
-	for (Int Index = 0; Index < Inventory->Info.SlotCount - 1; Index += 1) {
-		RTItemSlotRef InventorySlot = &Inventory->Slots[Index];
-		RTItemSlotRef NextInventorySlot = &Inventory->Slots[Index + 1];
-		Int32 SlotOffset = NextInventorySlot->SlotIndex - InventorySlot->SlotIndex;
-		if (SlotOffset > 1) {
-			return InventorySlot->SlotIndex + 1;
+	memset(Inventory->SlotMap, 0, sizeof(Inventory->SlotMap));
+	memset(Inventory->SlotMask, 0, sizeof(Inventory->SlotMask));
+	Inventory->IsUnsorted = false;
+
+	for (Int Index = 0; Index < Inventory->Info.SlotCount; Index += 1) {
+		RTItemSlotRef Slot = &Inventory->Slots[Index];
+		assert(RTInventoryIsSlotIndexValid(Slot->SlotIndex));
+
+		if (Index > 0 && Inventory->Slots[Index - 1].SlotIndex > Slot->SlotIndex) {
+			Inventory->IsUnsorted = true;
 		}
+
+		RTInventoryLinkSlot(Inventory, Slot->SlotIndex, (Int32)Index);
 	}
+}
 
-	return Inventory->Info.SlotCount;
+Int32 RTInventoryGetNextFreeSlotIndex(
+	RTRuntimeRef Runtime,
+	RTCharacterInventoryInfoRef Inventory
+) {
+	return RTInventoryFindFreeSlotIndex(Inventory, 0);
 }
 
 Void RTInventorySort(
 	RTRuntimeRef Runtime,
 	RTCharacterInventoryInfoRef Inventory
 ) {
-	for (Int Offset = 1; Offset < Inventory->Info.SlotCount; Offset += 1) {
-		Int Index = Offset;
-		while (Index > 0 && Inventory->Slots[Index].SlotIndex <= Inventory->Slots[Index - 1].SlotIndex) {
-			struct _RTItemSlot TempSlot = Inventory->Slots[Index];
-			Inventory->Slots[Index] = Inventory->Slots[Index - 1];
-			Inventory->Slots[Index - 1] = TempSlot;
-			Index -= 1;
+	if (!Inventory->IsUnsorted) return;
+
+	Int32 StorageIndex = 0;
+	for (Int32 MaskIndex = 0; MaskIndex < RUNTIME_INVENTORY_SLOT_MASK_COUNT; MaskIndex += 1) {
+		UInt64 SlotMask = Inventory->SlotMask[MaskIndex];
+		while (SlotMask) {
+			Int32 SlotIndex = MaskIndex * 64 + CountTrailingZeros64(SlotMask);
+			SlotMask &= SlotMask - 1;
+
+			kInventorySnapshot.Slots[StorageIndex] = Inventory->Slots[Inventory->SlotMap[SlotIndex] - 1];
+			Inventory->SlotMap[SlotIndex] = (UInt16)(StorageIndex + 1);
+			StorageIndex += 1;
 		}
 	}
+
+	assert(StorageIndex == Inventory->Info.SlotCount);
+	memcpy(Inventory->Slots, kInventorySnapshot.Slots, sizeof(struct _RTItemSlot) * StorageIndex);
+	Inventory->IsUnsorted = false;
 }
 
 Bool RTInventoryInsertSlot(
@@ -46,44 +121,28 @@ Bool RTInventoryInsertSlot(
 	if (Inventory->Info.SlotCount >= RUNTIME_INVENTORY_TOTAL_SIZE) 
 		return false;
 
-	Int32 InsertionIndex = -1;
-	for (Int Offset = 0; Offset < Inventory->Info.SlotCount; Offset += 1) {
-		if (Inventory->Slots[Offset].SlotIndex < Slot->SlotIndex) continue;
-
-		InsertionIndex = Offset;
-
-		if (Inventory->Slots[Offset].SlotIndex > Slot->SlotIndex) {
-			break;
-		}
-
-		Int32 SlotIndex = Slot->SlotIndex + 1;
-		for (Int Index = Offset; Index < Inventory->Info.SlotCount - 1; Index += 1) {
-			Inventory->Slots[Index].SlotIndex = SlotIndex;
-
-			SlotIndex += 1;
-			if (Inventory->Slots[Index + 1].SlotIndex >= SlotIndex) {
-				break;
-			}
-		}
-	}
+	if (!RTInventoryIsSlotIndexValid(Slot->SlotIndex))
+		return false;
 
-	if (InsertionIndex < 0) {
+	if (RTInventoryIsSlotEmpty(Runtime, Inventory, Slot->SlotIndex)) {
 		Bool Success = RTInventorySetSlot(Runtime, Inventory, Slot);
 		assert(Success);
 		return true;
 	}
 
-	Int32 TailLength = Inventory->Info.SlotCount - InsertionIndex;
-	if (TailLength > 0) {
-		memmove(
-			&Inventory->Slots[InsertionIndex + 1], 
-			&Inventory->Slots[InsertionIndex], 
-			TailLength * sizeof(struct _RTItemSlot)
-		);
+	// NOTE: Occupied slots are shifted up to the next free slot index to make room for the inserted slot
+	Int32 FreeSlotIndex = RTInventoryFindFreeSlotIndex(Inventory, Slot->SlotIndex);
+	if (FreeSlotIndex < 0) return false;
+
+	for (Int32 SlotIndex = FreeSlotIndex; SlotIndex > Slot->SlotIndex; SlotIndex -= 1) {
+		Int32 StorageIndex = Inventory->SlotMap[SlotIndex - 1] - 1;
+		Inventory->Slots[StorageIndex].SlotIndex = SlotIndex;
+		RTInventoryLinkSlot(Inventory, SlotIndex, StorageIndex);
 	}
 
-	memcpy(&Inventory->Slots[InsertionIndex], Slot, sizeof(struct _RTItemSlot));
-	Inventory->Info.SlotCount += 1;
+	RTInventoryUnlinkSlot(Inventory, Slot->SlotIndex);
+	RTInventoryAppendSlot(Inventory, Slot);
+	Inventory->IsUnsorted = true;
 	return true;
 }
 
@@ -100,14 +159,9 @@ Int32 RTInventoryGetSlotIndex(
 	RTCharacterInventoryInfoRef Inventory,
 	Int32 SlotIndex
 ) {
-	for (Int Index = 0; Index < Inventory->Info.SlotCount; Index += 1) {
-		RTItemSlotRef Slot = &Inventory->Slots[Index];
-		if (Slot->SlotIndex == SlotIndex) {
-			return Index;
-		}
-	}
+	if (!RTInventoryIsSlotIndexValid(SlotIndex)) return -1;
 
-	return -1;
+	return (Int32)Inventory->SlotMap[SlotIndex] - 1;
 }
 
 RTItemSlotRef RTInventoryGetSlot(
@@ -115,7 +169,7 @@ RTItemSlotRef RTInventoryGetSlot(
 	RTCharacterInventoryInfoRef Inventory,
 	Int32 SlotIndex
 ) {
-	Int Index = RTInventoryGetSlotIndex(Runtime, Inventory, SlotIndex);
+	Int32 Index = RTInventoryGetSlotIndex(Runtime, Inventory, SlotIndex);
 	if (Index < 0) return NULL;
 	return &Inventory->Slots[Index];
 }
@@ -125,9 +179,8 @@ Bool RTInventorySetSlot(
 	RTCharacterInventoryInfoRef Inventory,
 	RTItemSlotRef Slot
 ) {
-	Info("InventorySetSlot(%llu, %llu, %d, %d)", Slot->Item.Serial, Slot->ItemOptions, Slot->ItemDuration.Serial, Slot->SlotIndex);
-    assert(Inventory);
-	assert(0 <= Slot->SlotIndex && Slot->SlotIndex < RUNTIME_INVENTORY_TOTAL_SIZE);
+	assert(Inventory);
+	assert(RTInventoryIsSlotIndexValid(Slot->SlotIndex));
 
 	RTItemDataRef ItemData = RTRuntimeGetItemDataByIndex(Runtime, Slot->Item.ID);
 	assert(ItemData);
@@ -168,38 +221,33 @@ Bool RTInventorySetSlot(
 		return false;
 	}
 
-	InventorySlot = &Inventory->Slots[Inventory->Info.SlotCount];
-	memcpy(InventorySlot, Slot, sizeof(struct _RTItemSlot));
-	Inventory->Info.SlotCount += 1;
+	RTInventoryAppendSlot(Inventory, Slot);
 	return true;
 }
 
-// TODO: RTInventoryClearSlot is moving the memory and causes pointer corruptions on stack while referencing slots..
-//		 instead of moving the memory all inventory slots could just stay in their static locations to reduce complexity.
+// NOTE: The last slot is moved into the storage of the cleared slot, references to it are invalidated
 Bool RTInventoryClearSlot(
 	RTRuntimeRef Runtime,
 	RTCharacterInventoryInfoRef Inventory,
 	Int32 SlotIndex
 ) {
-	Info("InventoryClearSlot(%d)", SlotIndex);
-	assert(0 <= SlotIndex && SlotIndex < RUNTIME_INVENTORY_TOTAL_SIZE);
+	assert(RTInventoryIsSlotIndexValid(SlotIndex));
 
-	Int32 InventoryIndex = RTInventoryGetSlotIndex(
+	Int32 StorageIndex = RTInventoryGetSlotIndex(
 		Runtime,
 		Inventory,
 		SlotIndex
 	);
-	if (InventoryIndex < 0) return false;
-
-	Int32 TailLength = Inventory->Info.SlotCount - InventoryIndex - 1;
-	if (TailLength > 0) {
-		memmove(
-			&Inventory->Slots[InventoryIndex],
-			&Inventory->Slots[InventoryIndex + 1],
-			TailLength * sizeof(struct _RTItemSlot)
-		);
+	if (StorageIndex < 0) return false;
+
+	Int32 LastStorageIndex = Inventory->Info.SlotCount - 1;
+	if (StorageIndex < LastStorageIndex) {
+		memcpy(&Inventory->Slots[StorageIndex], &Inventory->Slots[LastStorageIndex], sizeof(struct _RTItemSlot));
+		RTInventoryLinkSlot(Inventory, Inventory->Slots[StorageIndex].SlotIndex, StorageIndex);
+		Inventory->IsUnsorted = true;
 	}
 
+	RTInventoryUnlinkSlot(Inventory, SlotIndex);
 	Inventory->Info.SlotCount -= 1;
 	return true;
 }
@@ -210,7 +258,6 @@ Bool RTInventoryRemoveSlot(
 	Int32 SlotIndex,
 	RTItemSlotRef Result
 ) {
-	Info("InventoryRemoveSlot(%d)", SlotIndex);
 	RTItemSlotRef Slot = RTInventoryGetSlot(Runtime, Inventory, SlotIndex);
 	if (!Slot) 
 		return false;
@@ -227,7 +274,6 @@ Bool RTInventoryMoveSlot(
 	Int32 SourceSlotIndex,
 	Int32 TargetSlotIndex
 ) {
-	Info("InventoryMoveSlot(%d, %d)", SourceSlotIndex, TargetSlotIndex);
 	RTItemSlotRef SourceSlot = RTInventoryGetSlot(Runtime, SourceInventory, SourceSlotIndex);
 	if (!SourceSlot) return false;
 
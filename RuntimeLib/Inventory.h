@@ -16,21 +16,31 @@ struct _RTInventoryInfo {
 struct _RTCharacterInventoryInfo {
 	struct _RTInventoryInfo Info;
 	struct _RTItemSlot Slots[RUNTIME_INVENTORY_PAGE_SIZE * RUNTIME_INVENTORY_PAGE_COUNT];
+	// NOTE: The slot lookup is not part of the wire format, it maps a slot index to its storage index + 1
+	UInt16 SlotMap[RUNTIME_INVENTORY_TOTAL_SIZE];
+	UInt64 SlotMask[RUNTIME_INVENTORY_TOTAL_SIZE / 64];
+	Bool IsUnsorted;
 };
 
 #pragma pack(pop)
 
+// NOTE: This function has to be called after the slots have been written without using the inventory functions
+Void RTInventoryInitialize(
+	RTRuntimeRef Runtime,
+	RTCharacterInventoryInfoRef Inventory
+);
+
 Int32 RTInventoryGetNextFreeSlotIndex(
 	RTRuntimeRef Runtime,
 	RTCharacterInventoryInfoRef Inventory
 );
 
+// NOTE: The slots are only sorted by slot index after calling this function, it has to be called before the slots are serialized
 Void RTInventorySort(
 	RTRuntimeRef Runtime,
 	RTCharacterInventoryInfoRef Inventory
 );
 
-// NOTE: This function assumes that the inventory is already sorted by slot index!
 Bool RTInventoryInsertSlot(
 	RTRuntimeRef Runtime,
 	RTCharacterInventoryInfoRef Inventory,
@@ -347,14 +347,12 @@ Void RTMobApplyDamage(
 
 	RTMobCancelMovement(Runtime, WorldContext, Mob);
 
-	if (Mob->Script && TotalDamage > 0) RTScriptCall(
+	if (Mob->Script && TotalDamage > 0) RTScriptCallMobDamageEvent(
 		Mob->Script,
-		MOB_EVENT_DAMAGE,
-		LUA_TLIGHTUSERDATA, Runtime,
-		LUA_TLIGHTUSERDATA, WorldContext,
-		LUA_TLIGHTUSERDATA, Mob,
-		LUA_TNUMBER, TotalDamage,
-		NULL
+		Runtime,
+		WorldContext,
+		Mob,
+		TotalDamage
 	);
 
 	if (Mob->IsTimerMob) {
@@ -586,8 +584,8 @@ Void RTMobUpdate(
 		RTWorldChunkRef WorldChunk = Movement->WorldChunk;
 		RTWorldChunkRef NewChunk = RTWorldContextGetChunk(Movement->WorldContext, Movement->PositionCurrent.X, Movement->PositionCurrent.Y);
 		if (WorldChunk != NewChunk) {
-			RTWorldChunkRemove(Movement->WorldChunk, Mob->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
-			RTWorldChunkInsert(NewChunk, Mob->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
+			RTWorldChunkRemove(Movement->WorldChunk, Mob->ID, &Mob->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
+			RTWorldChunkInsert(NewChunk, Mob->ID, &Mob->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
 
 			Movement->WorldChunk = NewChunk;
 		}
@@ -639,7 +637,7 @@ Void RTMobUpdate(
 		}
 	}
 
-	RTMobOnEvent(Runtime, WorldContext, Mob, MOB_EVENT_UPDATE);
+	RTMobOnEvent(Runtime, WorldContext, Mob, RUNTIME_SCRIPT_EVENT_MOB_UPDATE);
 
 	if (!RTMobIsAlive(Mob) && Mob->IsSpawned) {
 		Mob->NextTimestamp = Timestamp + Mob->Spawn.SpawnInterval;
@@ -929,18 +927,11 @@ Void RTMobOnEvent(
 	RTRuntimeRef Runtime,
 	RTWorldContextRef World,
 	RTMobRef Mob,
-	CString Event
+	Int32 Event
 ) {
 	if (!Mob->Script) return;
 
-	RTScriptCall(
-        Mob->Script, 
-        Event, 
-        LUA_TLIGHTUSERDATA, Runtime, 
-        LUA_TLIGHTUSERDATA, World, 
-        LUA_TLIGHTUSERDATA, Mob,
-        NULL
-    );
+	RTScriptCallMobEvent(Mob->Script, Event, Runtime, World, Mob);
 }
 
 Void RTMobStartSpecialAction(
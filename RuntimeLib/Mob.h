@@ -10,11 +10,6 @@
 
 EXTERN_C_BEGIN
 
-#define MOB_EVENT_SPAWN		"on_spawn"
-#define MOB_EVENT_DESPAWN	"on_despawn"
-#define MOB_EVENT_UPDATE	"on_update"
-#define MOB_EVENT_DAMAGE	"on_damage"
-
 enum {
 	RUNTIME_MOB_AGGRESSIVE_TYPE_PASSIVE,
 	RUNTIME_MOB_AGGRESSIVE_TYPE_AGGRESSIVE,
@@ -253,6 +248,7 @@ struct _RTMob {
 	struct _RTMobAggroData Aggro;
 	struct _RTMobBuffData Buffs;
 	struct _RTMovement Movement;
+	Int32 WorldChunkSlotIndex;
 	struct _RTBattleAttributes Attributes;
 	struct _RTMobPatrol Patrol;
 	
@@ -304,7 +300,7 @@ Void RTMobOnEvent(
 	RTRuntimeRef Runtime,
 	RTWorldContextRef World,
 	RTMobRef Mob,
-	CString Event
+	Int32 Event
 );
 
 Void RTMobStartSpecialAction(
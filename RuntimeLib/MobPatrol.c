@@ -82,7 +82,7 @@ Bool RTMobPatrolUpdate(
 		}
 
 		if (WaypointData->Type == RUNTIME_MOB_PATROL_TYPE_WARP) {
-			RTWorldChunkRemove(Mob->Movement.WorldChunk, Mob->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
+			RTWorldChunkRemove(Mob->Movement.WorldChunk, Mob->ID, &Mob->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
 			RTWorldTileDecreaseMobCount(Runtime, WorldContext, Mob->Movement.PositionTile.X, Mob->Movement.PositionTile.Y);
 			RTMovementInitialize(
 				Runtime,
@@ -96,7 +96,7 @@ Bool RTMobPatrolUpdate(
 			RTWorldTileIncreaseMobCount(Runtime, WorldContext, Mob->Movement.PositionTile.X, Mob->Movement.PositionTile.Y);
 			Mob->Movement.WorldContext = WorldContext;
 			Mob->Movement.WorldChunk = RTWorldContextGetChunk(WorldContext, Mob->Movement.PositionCurrent.X, Mob->Movement.PositionCurrent.Y);
-			RTWorldChunkInsert(Mob->Movement.WorldChunk, Mob->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
+			RTWorldChunkInsert(Mob->Movement.WorldChunk, Mob->ID, &Mob->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
 		}
 
 		Mob->Patrol.WaypointDelay = WaypointData->Delay;
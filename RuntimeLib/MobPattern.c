@@ -140,7 +140,7 @@ Void RTMobPatternStartAction(
 		}
 		else if (TargetID.EntityType == RUNTIME_ENTITY_TYPE_MOB) {
 			RTMobRef Target = (RTMobRef)TargetContext;
-			RTWorldChunkRemove(Target->Movement.WorldChunk, TargetID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
+			RTWorldChunkRemove(Target->Movement.WorldChunk, TargetID, &Target->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
 			RTWorldTileDecreaseMobCount(Runtime, WorldContext, Target->Movement.PositionTile.X, Target->Movement.PositionTile.Y);
 			RTMovementInitialize(
 				Runtime,
@@ -154,7 +154,7 @@ Void RTMobPatternStartAction(
 			RTWorldTileIncreaseMobCount(Runtime, WorldContext, Target->Movement.PositionTile.X, Target->Movement.PositionTile.Y);
 			Target->Movement.WorldContext = WorldContext;
 			Target->Movement.WorldChunk = RTWorldContextGetChunk(WorldContext, Target->Movement.PositionCurrent.X, Target->Movement.PositionCurrent.Y);
-			RTWorldChunkInsert(Target->Movement.WorldChunk, TargetID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
+			RTWorldChunkInsert(Target->Movement.WorldChunk, TargetID, &Target->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
 		}
 		else {
 			UNREACHABLE("Unexpected target type given for action WARP_TARGET!");
@@ -162,7 +162,7 @@ Void RTMobPatternStartAction(
 	}
 
 	if (ActionState->ActionData->Type == RUNTIME_MOB_ACTION_TYPE_WARP_SELF) {
-		RTWorldChunkRemove(Mob->Movement.WorldChunk, Mob->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
+		RTWorldChunkRemove(Mob->Movement.WorldChunk, Mob->ID, &Mob->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_WARP);
 		RTWorldTileDecreaseMobCount(Runtime, WorldContext, Mob->Movement.PositionTile.X, Mob->Movement.PositionTile.Y);
 		RTMovementInitialize(
 			Runtime,
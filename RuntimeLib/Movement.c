@@ -1,6 +1,55 @@
 #include "Movement.h"
 #include "Runtime.h"
 
+#define RUNTIME_MOVEMENT_DISTANCE_FRACTION_BITS 8
+
+// NOTE: The distance table is shared by all runtimes and stores the euclidean distances as 8.8 fixed point values
+static UInt16 kMovementDistanceTable[RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH] = { 0 };
+static Bool kMovementDistanceTableInitialized = false;
+
+Void RTMovementInitializeDistanceTable() {
+	if (kMovementDistanceTableInitialized) return;
+
+	for (Int Y = 0; Y < RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH; Y += 1) {
+		for (Int X = 0; X < RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH; X += 1) {
+			Float64 Distance = sqrt((Float64)X * (Float64)X + (Float64)Y * (Float64)Y);
+			kMovementDistanceTable[X + Y * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH] = (UInt16)(Distance * (1 << RUNTIME_MOVEMENT_DISTANCE_FRACTION_BITS) + 0.5);
+		}
+	}
+
+	kMovementDistanceTableInitialized = true;
+}
+
+Float32 RTMovementGetDistance(
+	Int32 DeltaX,
+	Int32 DeltaY
+) {
+	assert(kMovementDistanceTableInitialized);
+
+	Int32 AbsDeltaX = MIN(ABS(DeltaX), RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1);
+	Int32 AbsDeltaY = MIN(ABS(DeltaY), RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1);
+	UInt16 Distance = kMovementDistanceTable[AbsDeltaX + AbsDeltaY * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH];
+	return (Float32)Distance / (1 << RUNTIME_MOVEMENT_DISTANCE_FRACTION_BITS);
+}
+
+// NOTE: The accumulated distances of the waypoints are computed once per path and evaluated on demand
+static Void RTMovementCompileWaypoints(
+	RTMovementRef Movement
+) {
+	assert(Movement->WaypointCount >= 2);
+
+	Movement->WaypointIndex = 0;
+	Movement->WaypointDistances[0] = 0;
+	for (Int Index = 1; Index < Movement->WaypointCount; Index += 1) {
+		RTPositionRef WaypointA = &Movement->Waypoints[Index - 1];
+		RTPositionRef WaypointB = &Movement->Waypoints[Index];
+		Float32 Distance = RTMovementGetDistance(WaypointB->X - WaypointA->X, WaypointB->Y - WaypointA->Y);
+		Movement->WaypointDistances[Index] = Movement->WaypointDistances[Index - 1] + Distance;
+	}
+
+	Movement->EvaluationTickCount = 0;
+}
+
 Void RTMovementInitialize(
 	RTRuntimeRef Runtime,
 	RTMovementRef Movement,
@@ -33,26 +82,8 @@ Void RTMovementStartDeadReckoning(
     RTRuntimeRef Runtime,
     RTMovementRef Movement
 ) {
-	RTPositionRef WaypointA = &Movement->Waypoints[0];
-	RTPositionRef WaypointB = &Movement->Waypoints[1];
-	Int32 DeltaX = WaypointB->X - WaypointA->X;
-	Int32 DeltaY = WaypointB->Y - WaypointA->Y;
-	Int32 AbsDeltaX = (DeltaX >= 0) ? DeltaX : -DeltaX;
-	Int32 AbsDeltaY = (DeltaY >= 0) ? DeltaY : -DeltaY;
-
-	if (AbsDeltaX >= RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH) {
-		AbsDeltaX = RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1;
-	}
-
-	if (AbsDeltaY >= RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH) {
-		AbsDeltaY = RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1;
-	}
-
-	Movement->WaypointIndex = 0;
-	Movement->Distance = Runtime->MovementDistanceCache[AbsDeltaX + AbsDeltaY * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH];
+	RTMovementCompileWaypoints(Movement);
 	Movement->Base = 0;
-	Movement->Sin = (Float32)DeltaY / Movement->Distance;
-	Movement->Cos = (Float32)DeltaX / Movement->Distance;
 	Movement->IsMoving = true;
 	Movement->IsDeadReckoning = true;
 	Movement->TickCount = (UInt32)PlatformGetTickCount();
@@ -77,26 +108,8 @@ Void RTMovementRestartDeadReckoning(
 ) {
 	assert(Movement->IsMoving);
 
-	RTPositionRef WaypointA = &Movement->Waypoints[0];
-	RTPositionRef WaypointB = &Movement->Waypoints[1];
-	Int32 DeltaX = WaypointB->X - WaypointA->X;
-	Int32 DeltaY = WaypointB->Y - WaypointA->Y;
-	Int32 AbsDeltaX = (DeltaX >= 0) ? DeltaX : -DeltaX;
-	Int32 AbsDeltaY = (DeltaY >= 0) ? DeltaY : -DeltaY;
-
-	if (AbsDeltaX >= RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH) {
-		AbsDeltaX = RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1;
-	}
-
-	if (AbsDeltaY >= RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH) {
-		AbsDeltaY = RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1;
-	}
-
-	Movement->WaypointIndex = 0;
-	Movement->Distance = Runtime->MovementDistanceCache[AbsDeltaX + AbsDeltaY * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH];
-	Movement->Base += Movement->Distance;
-	Movement->Sin = (Float32)DeltaY / Movement->Distance;
-	Movement->Cos = (Float32)DeltaX / Movement->Distance;
+	RTMovementCompileWaypoints(Movement);
+	Movement->Base += Movement->WaypointDistances[1];
 	Movement->IsDeadReckoning = true;
 
 	if (Movement->Entity.EntityType == RUNTIME_ENTITY_TYPE_CHARACTER) {
@@ -142,90 +155,60 @@ Void RTMovementUpdateDeadReckoning(
 ) {
 	if (!Movement->IsDeadReckoning) return;
 
-	UInt32 ElapsedTime = (UInt32)PlatformGetTickCount() - Movement->TickCount;
-	Float32 Distance = Movement->Speed * (Float32)ElapsedTime / 1000;
-	Float32 Overflow = Distance - Movement->Base;
-	if (Overflow < 0) return;
+	// NOTE: The position is a closed form of the elapsed time so it only has to be evaluated once per tick count
+	UInt32 TickCount = (UInt32)PlatformGetTickCount();
+	if (Movement->EvaluationTickCount == TickCount) return;
+	Movement->EvaluationTickCount = TickCount;
 
-	RTPositionRef WaypointA = &Movement->Waypoints[Movement->WaypointIndex];
-	RTPositionRef WaypointB = &Movement->Waypoints[Movement->WaypointIndex + 1];
-
-	while (Overflow >= Movement->Distance) {
-		Movement->Base += Movement->Distance;
-
-		WaypointA = WaypointB;
+	UInt32 ElapsedTime = TickCount - Movement->TickCount;
+	Float32 Overflow = Movement->Speed * (Float32)ElapsedTime / 1000 - Movement->Base;
+	if (Overflow < 0) return;
 
-		if (Movement->WaypointIndex + 2 >= Movement->WaypointCount) {
-			Movement->IsDeadReckoning = false;
-			Movement->PositionCurrent.X = WaypointA->X;
-			Movement->PositionCurrent.Y = WaypointA->Y;
-			return;
-		}
+	Int32 LastWaypointIndex = Movement->WaypointCount - 1;
+	if (Overflow >= Movement->WaypointDistances[LastWaypointIndex]) {
+		Movement->IsDeadReckoning = false;
+		Movement->WaypointIndex = MAX(0, LastWaypointIndex - 1);
+		Movement->PositionCurrent.X = Movement->Waypoints[LastWaypointIndex].X;
+		Movement->PositionCurrent.Y = Movement->Waypoints[LastWaypointIndex].Y;
+		return;
+	}
 
+	while (Overflow >= Movement->WaypointDistances[Movement->WaypointIndex + 1]) {
 		Movement->WaypointIndex += 1;
-		WaypointB = &Movement->Waypoints[Movement->WaypointIndex + 1];
-
-		Int32 DeltaX = WaypointB->X - WaypointA->X;
-		Int32 DeltaY = WaypointB->Y - WaypointA->Y;
-		Int32 AbsDeltaX = (DeltaX >= 0) ? DeltaX : -DeltaX;
-		Int32 AbsDeltaY = (DeltaY >= 0) ? DeltaY : -DeltaY;
-
-		if (AbsDeltaX >= RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH) {
-			AbsDeltaX = RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1;
-		}
-
-		if (AbsDeltaY >= RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH) {
-			AbsDeltaY = RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH - 1;
-		}
-
-		Overflow -= Movement->Distance;
-		Movement->Distance = Runtime->MovementDistanceCache[AbsDeltaX + AbsDeltaY * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH];
-		Movement->Sin = (Float32)DeltaY / Movement->Distance;
-		Movement->Cos = (Float32)DeltaX / Movement->Distance;
 	}
 
+	RTPositionRef WaypointA = &Movement->Waypoints[Movement->WaypointIndex];
+	RTPositionRef WaypointB = &Movement->Waypoints[Movement->WaypointIndex + 1];
+	Float32 SegmentBase = Movement->WaypointDistances[Movement->WaypointIndex];
+	Float32 SegmentDistance = Movement->WaypointDistances[Movement->WaypointIndex + 1] - SegmentBase;
+	Float32 SegmentOverflow = Overflow - SegmentBase;
+
 	Int32 DeltaX = WaypointB->X - WaypointA->X;
 	Int32 DeltaY = WaypointB->Y - WaypointA->Y;
 	Int32 AbsDeltaX = (DeltaX >= 0) ? DeltaX : -DeltaX;
 	Int32 AbsDeltaY = (DeltaY >= 0) ? DeltaY : -DeltaY;
-	Int32 NewPositionX;
-	Int32 NewPositionY;
+	Int32 OffsetX;
+	Int32 OffsetY;
 
 	if (AbsDeltaX > AbsDeltaY) {
-		Int32 PositionX = (Int32)(Overflow * Movement->Cos);
-		Int32 OffsetX = (PositionX < 0) ? -PositionX : PositionX;
-		Int32 OffsetY = (AbsDeltaY * OffsetX + (AbsDeltaX >> 1)) / AbsDeltaX;
-
-		if (DeltaX < 0) {
-			OffsetX = -OffsetX;
-		}
-
-		if (DeltaY < 0) {
-			OffsetY = -OffsetY;
-		}
-
-		NewPositionX = WaypointA->X + OffsetX;
-		NewPositionY = WaypointA->Y + OffsetY;
+		OffsetX = (Int32)(SegmentOverflow * AbsDeltaX / SegmentDistance);
+		OffsetY = (AbsDeltaY * OffsetX + (AbsDeltaX >> 1)) / AbsDeltaX;
 	}
 	else {
-		Int32 PositionY = (Int32)(Overflow * Movement->Sin);
-		Int32 OffsetY = (PositionY < 0) ? -PositionY : PositionY;
-		Int32 OffsetX = (AbsDeltaX * OffsetY + (AbsDeltaY >> 1)) / AbsDeltaY;
-
-		if (DeltaX < 0) {
-			OffsetX = -OffsetX;
-		}
+		OffsetY = (Int32)(SegmentOverflow * AbsDeltaY / SegmentDistance);
+		OffsetX = (AbsDeltaX * OffsetY + (AbsDeltaY >> 1)) / AbsDeltaY;
+	}
 
-		if (DeltaY < 0) {
-			OffsetY = -OffsetY;
-		}
+	if (DeltaX < 0) {
+		OffsetX = -OffsetX;
+	}
 
-		NewPositionX = WaypointA->X + OffsetX;
-		NewPositionY = WaypointA->Y + OffsetY;
+	if (DeltaY < 0) {
+		OffsetY = -OffsetY;
 	}
 
-	Movement->PositionCurrent.X = NewPositionX;
-	Movement->PositionCurrent.Y = NewPositionY;
+	Movement->PositionCurrent.X = WaypointA->X + OffsetX;
+	Movement->PositionCurrent.Y = WaypointA->Y + OffsetY;
 }
 
 Void RTMovementSetSpeed(
@@ -234,6 +217,7 @@ Void RTMovementSetSpeed(
 	Int32 Speed
 ) {
 	Movement->Speed = (Float32)Speed / RUNTIME_MOVEMENT_SPEED_SCALE;
+	Movement->EvaluationTickCount = 0;
 }
 
 Void RTMovementSetPosition(
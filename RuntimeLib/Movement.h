@@ -19,17 +19,23 @@ struct _RTMovement {
     Int32 WaypointIndex;
     Int32 WaypointCount;
     RTPosition Waypoints[RUNTIME_MOVEMENT_MAX_WAYPOINT_COUNT]; // TODO: Add support for dynamic waypoint speeds
+    Float32 WaypointDistances[RUNTIME_MOVEMENT_MAX_WAYPOINT_COUNT];
     RTPosition PositionBegin;
     RTPosition PositionCurrent;
     RTPosition PositionEnd;
     RTPosition PositionTile;
+    UInt32 EvaluationTickCount;
     Float32 Base;
-    Float32 Distance;
     Float32 Speed;
-    Float32 Sin;
-    Float32 Cos;
 };
 
+Void RTMovementInitializeDistanceTable();
+
+Float32 RTMovementGetDistance(
+    Int32 DeltaX,
+    Int32 DeltaY
+);
+
 Void RTMovementInitialize(
     RTRuntimeRef Runtime,
     RTMovementRef Movement,
@@ -1,5 +1,6 @@
 #include "Runtime.h"
 #include "NotificationManager.h"
+#include "NotificationProtocol.h"
 #include "WorldManager.h"
 
 struct _RTNotificationCommandContext {
@@ -8,15 +9,36 @@ struct _RTNotificationCommandContext {
 };
 typedef struct _RTNotificationCommandContext* RTNotificationCommandContextRef;
 
+struct _RTNotificationOutboxEntry {
+    RTNotificationRef Notification;
+    Int32 Next;
+    Bool IsSuperseded;
+};
+typedef struct _RTNotificationOutboxEntry* RTNotificationOutboxEntryRef;
+
+struct _RTNotificationOutbox {
+    UInt32 CharacterIndex;
+    Int32 Head;
+    Int32 Tail;
+};
+typedef struct _RTNotificationOutbox* RTNotificationOutboxRef;
+
 struct _RTNotificationManager {
     AllocatorRef Allocator;
     RTRuntimeRef Runtime;
     DictionaryRef CommandRegistry;
+    Bool IsBatching;
+    Bool IsFlushing;
+    ArrayRef Outboxes;
+    ArrayRef OutboxEntries;
+    DictionaryRef OutboxTable;
+    DictionaryRef CollapseTable;
+    ArrayRef ArenaBlocks;
+    Int ArenaBlockIndex;
+    Int ArenaOffset;
+    RTNotificationRef ArenaTop;
 };
 
-static UInt8 kSharedNotificationBuffer[RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH] = { 0 };
-static RTNotificationRef kSharedNotification = (RTNotificationRef)kSharedNotificationBuffer;
-
 RTNotificationManagerRef RTNotificationManagerCreate(
     RTRuntimeRef Runtime
 ) {
@@ -24,12 +46,32 @@ RTNotificationManagerRef RTNotificationManagerCreate(
     NotificationManager->Allocator = Runtime->Allocator;
     NotificationManager->Runtime = Runtime;
     NotificationManager->CommandRegistry = IndexDictionaryCreate(Runtime->Allocator, 64);
+    NotificationManager->IsBatching = false;
+    NotificationManager->IsFlushing = false;
+    NotificationManager->Outboxes = ArrayCreateEmpty(Runtime->Allocator, sizeof(struct _RTNotificationOutbox), 64);
+    NotificationManager->OutboxEntries = ArrayCreateEmpty(Runtime->Allocator, sizeof(struct _RTNotificationOutboxEntry), 256);
+    NotificationManager->OutboxTable = IndexDictionaryCreate(Runtime->Allocator, 64);
+    NotificationManager->CollapseTable = UInt64DictionaryCreate(Runtime->Allocator, 256);
+    NotificationManager->ArenaBlocks = ArrayCreateEmpty(Runtime->Allocator, sizeof(UInt8*), 4);
+    NotificationManager->ArenaBlockIndex = 0;
+    NotificationManager->ArenaOffset = 0;
+    NotificationManager->ArenaTop = NULL;
     return NotificationManager;
 }
 
 Void RTNotificationManagerDestroy(
     RTNotificationManagerRef NotificationManager
 ) {
+    for (Int Index = 0; Index < ArrayGetElementCount(NotificationManager->ArenaBlocks); Index += 1) {
+        UInt8* Block = *(UInt8**)ArrayGetElementAtIndex(NotificationManager->ArenaBlocks, Index);
+        AllocatorDeallocate(NotificationManager->Allocator, Block);
+    }
+
+    ArrayDestroy(NotificationManager->ArenaBlocks);
+    DictionaryDestroy(NotificationManager->CollapseTable);
+    DictionaryDestroy(NotificationManager->OutboxTable);
+    ArrayDestroy(NotificationManager->OutboxEntries);
+    ArrayDestroy(NotificationManager->Outboxes);
     DictionaryDestroy(NotificationManager->CommandRegistry);
     AllocatorDeallocate(NotificationManager->Allocator, NotificationManager);
 }
@@ -49,12 +91,153 @@ Void RTNotificationManagerRegisterCallback(
     DictionaryInsert(NotificationManager->CommandRegistry, &Key, &Context, sizeof(struct _RTNotificationCommandContext));
 }
 
+// NOTE: A builder reserves the maximum notification length at the top of the arena until it is dispatched or released
+static Void RTNotificationManagerTrimArena(
+    RTNotificationManagerRef NotificationManager,
+    RTNotificationRef Notification
+) {
+    if (NotificationManager->ArenaTop != Notification) return;
+
+    NotificationManager->ArenaOffset -= RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH;
+    NotificationManager->ArenaOffset += Align(Notification->Length, 8);
+    NotificationManager->ArenaTop = NULL;
+}
+
+static Bool RTNotificationGetCollapseEntity(
+    RTNotificationRef Notification,
+    RTEntityID* Entity
+) {
+    // NOTE: Movement notifications fully describe the state of the mob so only the latest one per tick is relevant
+    switch (Notification->Command) {
+    case NOTIFICATION_MOB_MOVE_BEGIN:
+        *Entity = ((NOTIFICATION_DATA_MOB_MOVE_BEGIN*)Notification)->Entity;
+        return true;
+
+    case NOTIFICATION_MOB_MOVE_END:
+        *Entity = ((NOTIFICATION_DATA_MOB_MOVE_END*)Notification)->Entity;
+        return true;
+
+    case NOTIFICATION_MOB_CHASE_BEGIN:
+        *Entity = ((NOTIFICATION_DATA_MOB_CHASE_BEGIN*)Notification)->Entity;
+        return true;
+
+    case NOTIFICATION_MOB_CHASE_END:
+        *Entity = ((NOTIFICATION_DATA_MOB_CHASE_END*)Notification)->Entity;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static Void RTNotificationManagerEnqueue(
+    RTNotificationManagerRef NotificationManager,
+    RTNotificationRef Notification,
+    RTCharacterRef Character
+) {
+    Int OutboxKey = Character->CharacterIndex;
+    Int* OutboxIndex = (Int*)DictionaryLookup(NotificationManager->OutboxTable, &OutboxKey);
+    if (!OutboxIndex) {
+        Int NewOutboxIndex = ArrayGetElementCount(NotificationManager->Outboxes);
+        RTNotificationOutboxRef Outbox = (RTNotificationOutboxRef)ArrayAppendUninitializedElement(NotificationManager->Outboxes);
+        Outbox->CharacterIndex = Character->CharacterIndex;
+        Outbox->Head = -1;
+        Outbox->Tail = -1;
+        DictionaryInsert(NotificationManager->OutboxTable, &OutboxKey, &NewOutboxIndex, sizeof(Int));
+        OutboxIndex = (Int*)DictionaryLookup(NotificationManager->OutboxTable, &OutboxKey);
+    }
+
+    Int32 EntryIndex = (Int32)ArrayGetElementCount(NotificationManager->OutboxEntries);
+    RTEntityID Entity = kEntityIDNull;
+    if (RTNotificationGetCollapseEntity(Notification, &Entity)) {
+        UInt64 CollapseKey = ((UInt64)(UInt32)Character->CharacterIndex << 32) | (UInt32)Entity.Serial;
+        Int32* CollapseIndex = (Int32*)DictionaryLookup(NotificationManager->CollapseTable, &CollapseKey);
+        if (CollapseIndex) {
+            RTNotificationOutboxEntryRef SupersededEntry = (RTNotificationOutboxEntryRef)ArrayGetElementAtIndex(NotificationManager->OutboxEntries, *CollapseIndex);
+            SupersededEntry->IsSuperseded = true;
+            *CollapseIndex = EntryIndex;
+        }
+        else {
+            DictionaryInsert(NotificationManager->CollapseTable, &CollapseKey, &EntryIndex, sizeof(Int32));
+        }
+    }
+
+    // NOTE: The notification lives in the arena until the end of the tick so the outbox only keeps a reference
+    RTNotificationOutboxEntryRef Entry = (RTNotificationOutboxEntryRef)ArrayAppendUninitializedElement(NotificationManager->OutboxEntries);
+    Entry->Notification = Notification;
+    Entry->Next = -1;
+    Entry->IsSuperseded = false;
+
+    RTNotificationOutboxRef Outbox = (RTNotificationOutboxRef)ArrayGetElementAtIndex(NotificationManager->Outboxes, *OutboxIndex);
+    if (Outbox->Tail >= 0) {
+        RTNotificationOutboxEntryRef TailEntry = (RTNotificationOutboxEntryRef)ArrayGetElementAtIndex(NotificationManager->OutboxEntries, Outbox->Tail);
+        TailEntry->Next = EntryIndex;
+    }
+    else {
+        Outbox->Head = EntryIndex;
+    }
+    Outbox->Tail = EntryIndex;
+}
+
+Void RTNotificationManagerBeginBatch(
+    RTNotificationManagerRef NotificationManager
+) {
+    assert(!NotificationManager->IsFlushing);
+    NotificationManager->IsBatching = true;
+}
+
+Bool RTNotificationManagerIsFlushing(
+    RTNotificationManagerRef NotificationManager
+) {
+    return NotificationManager->IsFlushing;
+}
+
+Void RTNotificationManagerFlush(
+    RTNotificationManagerRef NotificationManager
+) {
+    NotificationManager->IsBatching = false;
+    NotificationManager->IsFlushing = true;
+
+    // NOTE: Recipients are flushed one after another so all their notifications of the tick are sent back to back
+    for (Int OutboxIndex = 0; OutboxIndex < ArrayGetElementCount(NotificationManager->Outboxes); OutboxIndex += 1) {
+        RTNotificationOutboxRef Outbox = (RTNotificationOutboxRef)ArrayGetElementAtIndex(NotificationManager->Outboxes, OutboxIndex);
+        RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(NotificationManager->Runtime->WorldManager, Outbox->CharacterIndex);
+        if (!Character) continue;
+
+        Int32 EntryIndex = Outbox->Head;
+        while (EntryIndex >= 0) {
+            RTNotificationOutboxEntryRef Entry = (RTNotificationOutboxEntryRef)ArrayGetElementAtIndex(NotificationManager->OutboxEntries, EntryIndex);
+            EntryIndex = Entry->Next;
+            if (Entry->IsSuperseded) continue;
+
+            RTNotificationManagerDispatchToCharacter(NotificationManager, Entry->Notification, Character);
+        }
+    }
+
+    ArrayRemoveAllElements(NotificationManager->Outboxes, true);
+    ArrayRemoveAllElements(NotificationManager->OutboxEntries, true);
+    DictionaryRemoveAll(NotificationManager->OutboxTable);
+    DictionaryRemoveAll(NotificationManager->CollapseTable);
+    NotificationManager->IsFlushing = false;
+
+    NotificationManager->ArenaBlockIndex = 0;
+    NotificationManager->ArenaOffset = 0;
+    NotificationManager->ArenaTop = NULL;
+}
+
 Void RTNotificationManagerDispatchToCharacter(
     RTNotificationManagerRef NotificationManager,
     Void* Notification,
     RTCharacterRef Character
 ) {
     assert(Character);
+    RTNotificationManagerTrimArena(NotificationManager, (RTNotificationRef)Notification);
+
+    if (NotificationManager->IsBatching) {
+        RTNotificationManagerEnqueue(NotificationManager, (RTNotificationRef)Notification, Character);
+        return;
+    }
+
     Int Key = ((RTNotificationRef)Notification)->Command;
     RTNotificationCommandContextRef Context = (RTNotificationCommandContextRef)DictionaryLookup(NotificationManager->CommandRegistry, &Key);
     if (Context) Context->Callback(
@@ -70,6 +253,7 @@ Void RTNotificationManagerDispatchToParty(
     Void* Notification,
     RTPartyRef Party
 ) {
+    RTNotificationManagerTrimArena(NotificationManager, (RTNotificationRef)Notification);
     RTRuntimeRef Runtime = NotificationManager->Runtime;
     for (Int Index = 0; Index < Party->MemberCount; Index += 1) {
         RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(Runtime->WorldManager, Party->Members[Index].CharacterIndex);
@@ -84,6 +268,7 @@ Void RTNotificationManagerDispatchToChunk(
     Void* Notification,
     RTWorldChunkRef WorldChunk
 ) {
+    RTNotificationManagerTrimArena(NotificationManager, (RTNotificationRef)Notification);
     for (Int Index = 0; Index < ArrayGetElementCount(WorldChunk->Characters); Index += 1) {
         RTEntityID Entity = *(RTEntityID*)ArrayGetElementAtIndex(WorldChunk->Characters, Index);
         RTCharacterRef Character = RTWorldManagerGetCharacter(WorldChunk->Runtime->WorldManager, Entity);
@@ -97,7 +282,12 @@ Void RTNotificationManagerDispatchToNearby(
     Void* Notification,
     RTWorldChunkRef WorldChunk
 ) {
+    RTNotificationManagerTrimArena(NotificationManager, (RTNotificationRef)Notification);
     RTRuntimeRef Runtime = WorldChunk->WorldContext->WorldManager->Runtime;
+
+    // NOTE: Everything broadcasted to nearby characters is a visible change of the chunk
+    RTWorldChunkInvalidateSnapshots(WorldChunk);
+
     if (!RTEntityIsNull(WorldChunk->WorldContext->Party)) {
         RTPartyRef Party = RTRuntimeGetParty(Runtime, WorldChunk->WorldContext->Party);
         RTNotificationManagerDispatchToParty(NotificationManager, Notification, Party);
@@ -121,14 +311,43 @@ Void RTNotificationManagerDispatchToNearby(
 }
 
 RTNotificationRef _RTNotificationInit(
+    RTNotificationManagerRef NotificationManager,
     Int32 Length,
     Int32 Command
 ) {
     assert(Length <= RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH);
-    memset(kSharedNotification, 0, Length);
-    kSharedNotification->Length = Length;
-    kSharedNotification->Command = Command;
-    return kSharedNotification;
+
+    if (NotificationManager->ArenaOffset + RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH > RUNTIME_NOTIFICATION_ARENA_BLOCK_SIZE) {
+        NotificationManager->ArenaBlockIndex += 1;
+        NotificationManager->ArenaOffset = 0;
+    }
+
+    if (NotificationManager->ArenaBlockIndex >= ArrayGetElementCount(NotificationManager->ArenaBlocks)) {
+        UInt8* Block = (UInt8*)AllocatorAllocate(NotificationManager->Allocator, RUNTIME_NOTIFICATION_ARENA_BLOCK_SIZE);
+        if (!Block) Fatal("Memory allocation failed!");
+
+        ArrayAppendElement(NotificationManager->ArenaBlocks, &Block);
+    }
+
+    UInt8* Block = *(UInt8**)ArrayGetElementAtIndex(NotificationManager->ArenaBlocks, NotificationManager->ArenaBlockIndex);
+    RTNotificationRef Notification = (RTNotificationRef)(Block + NotificationManager->ArenaOffset);
+    NotificationManager->ArenaOffset += RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH;
+    NotificationManager->ArenaTop = Notification;
+
+    memset(Notification, 0, Length);
+    Notification->Length = Length;
+    Notification->Command = Command;
+    return Notification;
+}
+
+Void RTNotificationManagerRelease(
+    RTNotificationManagerRef NotificationManager,
+    Void* Notification
+) {
+    if (NotificationManager->ArenaTop != Notification) return;
+
+    NotificationManager->ArenaOffset -= RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH;
+    NotificationManager->ArenaTop = NULL;
 }
 
 Void* RTNotificationAppend(
@@ -3,6 +3,7 @@
 #include "Base.h"
 
 #define RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH 0x4000
+#define RUNTIME_NOTIFICATION_ARENA_BLOCK_SIZE (RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH * 16)
 
 EXTERN_C_BEGIN
 
@@ -38,6 +39,18 @@ Void RTNotificationManagerRegisterCallback(
     Void* UserData
 );
 
+Void RTNotificationManagerBeginBatch(
+    RTNotificationManagerRef NotificationManager
+);
+
+Bool RTNotificationManagerIsFlushing(
+    RTNotificationManagerRef NotificationManager
+);
+
+Void RTNotificationManagerFlush(
+    RTNotificationManagerRef NotificationManager
+);
+
 Void RTNotificationManagerDispatchToCharacter(
     RTNotificationManagerRef NotificationManager,
     Void* Notification,
@@ -62,13 +75,23 @@ Void RTNotificationManagerDispatchToNearby(
     RTWorldChunkRef WorldChunk
 );
 
+// NOTE: Notifications are allocated from a per tick arena, a notification must not be appended to after it has been dispatched
 RTNotificationRef _RTNotificationInit(
+    RTNotificationManagerRef NotificationManager,
     Int32 Length,
     Int32 Command
 );
 
+Void RTNotificationManagerRelease(
+    RTNotificationManagerRef NotificationManager,
+    Void* Notification
+);
+
 #define RTNotificationInit(__NAME__) \
-((NOTIFICATION_DATA_ ## __NAME__*)_RTNotificationInit(sizeof(NOTIFICATION_DATA_ ## __NAME__), NOTIFICATION_ ## __NAME__))
+((NOTIFICATION_DATA_ ## __NAME__*)_RTNotificationInit(Runtime->NotificationManager, sizeof(NOTIFICATION_DATA_ ## __NAME__), NOTIFICATION_ ## __NAME__))
+
+#define RTNotificationRelease(Notification) \
+RTNotificationManagerRelease(Runtime->NotificationManager, Notification)
 
 #define RTNotificationDispatchToCharacter(Notification, Character) \
 RTNotificationManagerDispatchToCharacter(Runtime->NotificationManager, Notification, Character)
@@ -2,27 +2,173 @@
 #include "OptionPool.h"
 #include "Runtime.h"
 
+#define RUNTIME_OPTION_POOL_ALIAS_THRESHOLD_SCALE ((UInt32)1 << 31)
+
 struct _RTOptionPoolValue {
     Int32 Value;
     Int32 Rate;
 };
 typedef struct _RTOptionPoolValue* RTOptionPoolValueRef;
 
+struct _RTOptionPoolValueTable {
+    struct _Array Values;
+    Int64 TotalRate;
+    Int32* AliasIndices;
+    UInt32* Thresholds;
+};
+typedef struct _RTOptionPoolValueTable* RTOptionPoolValueTableRef;
+
 struct _RTOptionPool {
-    ArrayRef ItemLevels;
-    ArrayRef EpicLevels;
-    ArrayRef ForceSlots;
-    ArrayRef ForceOptionSlots;
+    struct _RTOptionPoolValueTable ItemLevels;
+    struct _RTOptionPoolValueTable EpicLevels;
+    struct _RTOptionPoolValueTable ForceSlots;
+    struct _RTOptionPoolValueTable ForceOptionSlots;
     DictionaryRef EpicOptions;
     DictionaryRef ForceOptions;
 };
 typedef struct _RTOptionPool* RTOptionPoolRef;
 
+struct _RTOptionPoolItemTypeTable {
+    RTOptionPoolRef OptionPool;
+    Int32 EpicOptionCount;
+    RTOptionPoolValueTableRef* EpicOptions;
+    RTOptionPoolValueTableRef ForceOptions;
+};
+
 struct _RTOptionPoolManager {
     AllocatorRef Allocator;
     DictionaryRef OptionPool;
+    DictionaryRef ItemTypeTables;
 };
 
+static Void RTOptionPoolValueTableInitialize(
+    AllocatorRef Allocator,
+    RTOptionPoolValueTableRef ValueTable
+) {
+    ArrayInitializeEmpty(&ValueTable->Values, Allocator, sizeof(struct _RTOptionPoolValue), 8);
+    ValueTable->TotalRate = 0;
+    ValueTable->AliasIndices = NULL;
+    ValueTable->Thresholds = NULL;
+}
+
+static Void RTOptionPoolValueTableReleaseAlias(
+    AllocatorRef Allocator,
+    RTOptionPoolValueTableRef ValueTable
+) {
+    if (ValueTable->AliasIndices) AllocatorDeallocate(Allocator, ValueTable->AliasIndices);
+    if (ValueTable->Thresholds) AllocatorDeallocate(Allocator, ValueTable->Thresholds);
+    ValueTable->AliasIndices = NULL;
+    ValueTable->Thresholds = NULL;
+}
+
+static Void RTOptionPoolValueTableDeinitialize(
+    AllocatorRef Allocator,
+    RTOptionPoolValueTableRef ValueTable
+) {
+    RTOptionPoolValueTableReleaseAlias(Allocator, ValueTable);
+    ArrayDealloc(&ValueTable->Values);
+}
+
+static Void RTOptionPoolValueTableAppend(
+    AllocatorRef Allocator,
+    RTOptionPoolValueTableRef ValueTable,
+    Int32 Value,
+    Float64 Rate
+) {
+    RTOptionPoolValueTableReleaseAlias(Allocator, ValueTable);
+
+    RTOptionPoolValueRef PoolValue = (RTOptionPoolValueRef)ArrayAppendUninitializedElement(&ValueTable->Values);
+    PoolValue->Value = Value;
+    PoolValue->Rate = (Int32)(Rate / 100.0 * INT32_MAX);
+}
+
+static Void RTOptionPoolValueTableCompile(
+    AllocatorRef Allocator,
+    RTOptionPoolValueTableRef ValueTable
+) {
+    RTOptionPoolValueTableReleaseAlias(Allocator, ValueTable);
+
+    Int32 Count = (Int32)ArrayGetElementCount(&ValueTable->Values);
+    ValueTable->TotalRate = 0;
+    ValueTable->AliasIndices = (Int32*)AllocatorAllocate(Allocator, sizeof(Int32) * MAX(1, Count));
+    ValueTable->Thresholds = (UInt32*)AllocatorAllocate(Allocator, sizeof(UInt32) * MAX(1, Count));
+    if (!ValueTable->AliasIndices || !ValueTable->Thresholds) Fatal("Memory allocation failed!");
+
+    for (Int32 Index = 0; Index < Count; Index += 1) {
+        RTOptionPoolValueRef PoolValue = (RTOptionPoolValueRef)ArrayGetElementAtIndex(&ValueTable->Values, Index);
+        ValueTable->TotalRate += MAX(0, PoolValue->Rate);
+        ValueTable->AliasIndices[Index] = Index;
+        ValueTable->Thresholds[Index] = RUNTIME_OPTION_POOL_ALIAS_THRESHOLD_SCALE;
+    }
+
+    if (ValueTable->TotalRate < 1) return;
+
+    UInt64* ScaledRates = (UInt64*)AllocatorAllocate(Allocator, sizeof(UInt64) * Count);
+    Int32* SmallIndices = (Int32*)AllocatorAllocate(Allocator, sizeof(Int32) * Count);
+    Int32* LargeIndices = (Int32*)AllocatorAllocate(Allocator, sizeof(Int32) * Count);
+    if (!ScaledRates || !SmallIndices || !LargeIndices) Fatal("Memory allocation failed!");
+
+    UInt64 TotalRate = (UInt64)ValueTable->TotalRate;
+    Int32 SmallCount = 0;
+    Int32 LargeCount = 0;
+    for (Int32 Index = 0; Index < Count; Index += 1) {
+        RTOptionPoolValueRef PoolValue = (RTOptionPoolValueRef)ArrayGetElementAtIndex(&ValueTable->Values, Index);
+        ScaledRates[Index] = (UInt64)MAX(0, PoolValue->Rate) * (UInt64)Count;
+
+        if (ScaledRates[Index] < TotalRate) {
+            SmallIndices[SmallCount++] = Index;
+        }
+        else {
+            LargeIndices[LargeCount++] = Index;
+        }
+    }
+
+    while (SmallCount > 0 && LargeCount > 0) {
+        Int32 SmallIndex = SmallIndices[--SmallCount];
+        Int32 LargeIndex = LargeIndices[LargeCount - 1];
+
+        ValueTable->AliasIndices[SmallIndex] = LargeIndex;
+        ValueTable->Thresholds[SmallIndex] = (UInt32)((Float64)ScaledRates[SmallIndex] / (Float64)TotalRate * RUNTIME_OPTION_POOL_ALIAS_THRESHOLD_SCALE);
+
+        ScaledRates[LargeIndex] -= TotalRate - ScaledRates[SmallIndex];
+        if (ScaledRates[LargeIndex] < TotalRate) {
+            LargeCount -= 1;
+            SmallIndices[SmallCount++] = LargeIndex;
+        }
+    }
+
+    AllocatorDeallocate(Allocator, LargeIndices);
+    AllocatorDeallocate(Allocator, SmallIndices);
+    AllocatorDeallocate(Allocator, ScaledRates);
+}
+
+static Int32 RTOptionPoolValueTableSample(
+    RTOptionPoolValueTableRef ValueTable,
+    Int32* Seed
+) {
+    if (!ValueTable || !ValueTable->Thresholds || ValueTable->TotalRate < 1) return -1;
+
+    // NOTE: The first roll keeps the chance of rolling no value at all when the rates don't add up to 100%
+    Int32 RateValue = RandomRange(Seed, 0, INT32_MAX);
+    if (RateValue > ValueTable->TotalRate) return -1;
+
+    // NOTE: The index and its threshold share a single roll like the drop alias tables do
+    UInt64 AliasValue = (UInt64)Random(Seed) * (UInt64)ArrayGetElementCount(&ValueTable->Values);
+    Int32 Index = (Int32)(AliasValue / RUNTIME_OPTION_POOL_ALIAS_THRESHOLD_SCALE);
+    if ((UInt32)(AliasValue % RUNTIME_OPTION_POOL_ALIAS_THRESHOLD_SCALE) >= ValueTable->Thresholds[Index]) Index = ValueTable->AliasIndices[Index];
+
+    return Index;
+}
+
+static RTOptionPoolValueRef RTOptionPoolValueTableGetValue(
+    RTOptionPoolValueTableRef ValueTable,
+    Int32 Index
+) {
+    if (Index < 0) return NULL;
+
+    return (RTOptionPoolValueRef)ArrayGetElementAtIndex(&ValueTable->Values, Index);
+}
+
 RTOptionPoolManagerRef RTOptionPoolManagerCreate(
     AllocatorRef Allocator
 ) {
@@ -30,34 +176,52 @@ RTOptionPoolManagerRef RTOptionPoolManagerCreate(
     if (!OptionPoolManager) Fatal("Memory allocation failed!");
     OptionPoolManager->Allocator = Allocator;
     OptionPoolManager->OptionPool = IndexDictionaryCreate(Allocator, 64);
+    OptionPoolManager->ItemTypeTables = UInt64DictionaryCreate(Allocator, 64);
     return OptionPoolManager;
 }
 
+static Void RTOptionPoolManagerReleaseItemTypeTables(
+    RTOptionPoolManagerRef OptionPoolManager
+) {
+    DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(OptionPoolManager->ItemTypeTables);
+    while (Iterator.Key) {
+        RTOptionPoolItemTypeTableRef ItemTypeTable = *(RTOptionPoolItemTypeTableRef*)Iterator.Value;
+        if (ItemTypeTable->EpicOptions) AllocatorDeallocate(OptionPoolManager->Allocator, ItemTypeTable->EpicOptions);
+        AllocatorDeallocate(OptionPoolManager->Allocator, ItemTypeTable);
+        Iterator = DictionaryKeyIteratorNext(Iterator);
+    }
+
+    DictionaryRemoveAll(OptionPoolManager->ItemTypeTables);
+}
+
 Void RTOptionPoolManagerDestroy(
     RTOptionPoolManagerRef OptionPoolManager
 ) {
+    RTOptionPoolManagerReleaseItemTypeTables(OptionPoolManager);
+    DictionaryDestroy(OptionPoolManager->ItemTypeTables);
+
     DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(OptionPoolManager->OptionPool);
     while (Iterator.Key) {
-        RTOptionPoolRef OptionPool = (RTOptionPoolRef)DictionaryLookup(OptionPoolManager->OptionPool, Iterator.Key);
-        ArrayDestroy(OptionPool->ItemLevels);
-        ArrayDestroy(OptionPool->EpicLevels);
-        ArrayDestroy(OptionPool->ForceSlots);
-        ArrayDestroy(OptionPool->ForceOptionSlots);
+        RTOptionPoolRef OptionPool = (RTOptionPoolRef)Iterator.Value;
+        RTOptionPoolValueTableDeinitialize(OptionPoolManager->Allocator, &OptionPool->ItemLevels);
+        RTOptionPoolValueTableDeinitialize(OptionPoolManager->Allocator, &OptionPool->EpicLevels);
+        RTOptionPoolValueTableDeinitialize(OptionPoolManager->Allocator, &OptionPool->ForceSlots);
+        RTOptionPoolValueTableDeinitialize(OptionPoolManager->Allocator, &OptionPool->ForceOptionSlots);
 
         DictionaryKeyIterator GroupIterator = DictionaryGetKeyIterator(OptionPool->EpicOptions);
         while (GroupIterator.Key) {
-            ArrayRef Group = DictionaryLookup(OptionPool->EpicOptions, GroupIterator.Key);
-            ArrayDealloc(Group);
+            RTOptionPoolValueTableDeinitialize(OptionPoolManager->Allocator, (RTOptionPoolValueTableRef)GroupIterator.Value);
             GroupIterator = DictionaryKeyIteratorNext(GroupIterator);
         }
 
         GroupIterator = DictionaryGetKeyIterator(OptionPool->ForceOptions);
         while (GroupIterator.Key) {
-            ArrayRef Group = DictionaryLookup(OptionPool->ForceOptions, GroupIterator.Key);
-            ArrayDealloc(Group);
+            RTOptionPoolValueTableDeinitialize(OptionPoolManager->Allocator, (RTOptionPoolValueTableRef)GroupIterator.Value);
             GroupIterator = DictionaryKeyIteratorNext(GroupIterator);
         }
 
+        DictionaryDestroy(OptionPool->EpicOptions);
+        DictionaryDestroy(OptionPool->ForceOptions);
         Iterator = DictionaryKeyIteratorNext(Iterator);
     }
 
@@ -73,10 +237,10 @@ RTOptionPoolRef RTOptionPoolManagerGetOptionPool(
     if (OptionPool) return OptionPool;
 
     struct _RTOptionPool OptionPoolMemory = { 0 };
-    OptionPoolMemory.ItemLevels = ArrayCreateEmpty(OptionPoolManager->Allocator, sizeof(struct _RTOptionPoolValue), 8);
-    OptionPoolMemory.EpicLevels = ArrayCreateEmpty(OptionPoolManager->Allocator, sizeof(struct _RTOptionPoolValue), 8);
-    OptionPoolMemory.ForceSlots = ArrayCreateEmpty(OptionPoolManager->Allocator, sizeof(struct _RTOptionPoolValue), 8);
-    OptionPoolMemory.ForceOptionSlots = ArrayCreateEmpty(OptionPoolManager->Allocator, sizeof(struct _RTOptionPoolValue), 8);
+    RTOptionPoolValueTableInitialize(OptionPoolManager->Allocator, &OptionPoolMemory.ItemLevels);
+    RTOptionPoolValueTableInitialize(OptionPoolManager->Allocator, &OptionPoolMemory.EpicLevels);
+    RTOptionPoolValueTableInitialize(OptionPoolManager->Allocator, &OptionPoolMemory.ForceSlots);
+    RTOptionPoolValueTableInitialize(OptionPoolManager->Allocator, &OptionPoolMemory.ForceOptionSlots);
     OptionPoolMemory.EpicOptions = IndexDictionaryCreate(OptionPoolManager->Allocator, 8);
     OptionPoolMemory.ForceOptions = IndexDictionaryCreate(OptionPoolManager->Allocator, 8);
     DictionaryInsert(OptionPoolManager->OptionPool, &PoolIndex, &OptionPoolMemory, sizeof(struct _RTOptionPool));
@@ -84,6 +248,23 @@ RTOptionPoolRef RTOptionPoolManagerGetOptionPool(
     return (RTOptionPoolRef)DictionaryLookup(OptionPoolManager->OptionPool, &PoolIndex);
 }
 
+static RTOptionPoolValueTableRef RTOptionPoolGetValueTableGroup(
+    RTOptionPoolManagerRef OptionPoolManager,
+    DictionaryRef Groups,
+    Int GroupIndex
+) {
+    RTOptionPoolValueTableRef ValueTable = (RTOptionPoolValueTableRef)DictionaryLookup(Groups, &GroupIndex);
+    if (ValueTable) return ValueTable;
+
+    struct _RTOptionPoolValueTable ValueTableMemory = { 0 };
+    RTOptionPoolValueTableInitialize(OptionPoolManager->Allocator, &ValueTableMemory);
+    DictionaryInsert(Groups, &GroupIndex, &ValueTableMemory, sizeof(struct _RTOptionPoolValueTable));
+
+    ValueTable = (RTOptionPoolValueTableRef)DictionaryLookup(Groups, &GroupIndex);
+    assert(ValueTable);
+    return ValueTable;
+}
+
 Void RTOptionPoolManagerAddItemLevel(
     RTOptionPoolManagerRef OptionPoolManager,
     Int PoolIndex,
@@ -91,9 +272,7 @@ Void RTOptionPoolManagerAddItemLevel(
     Float64 Rate
 ) {
     RTOptionPoolRef OptionPool = RTOptionPoolManagerGetOptionPool(OptionPoolManager, PoolIndex);
-    RTOptionPoolValueRef Value = (RTOptionPoolValueRef)ArrayAppendUninitializedElement(OptionPool->ItemLevels);
-    Value->Value = Level;
-    Value->Rate = (Int32)(Rate / 100.0 * INT32_MAX);
+    RTOptionPoolValueTableAppend(OptionPoolManager->Allocator, &OptionPool->ItemLevels, Level, Rate);
 }
 
 Void RTOptionPoolManagerAddEpicLevel(
@@ -103,9 +282,7 @@ Void RTOptionPoolManagerAddEpicLevel(
     Float64 Rate
 ) {
     RTOptionPoolRef OptionPool = RTOptionPoolManagerGetOptionPool(OptionPoolManager, PoolIndex);
-    RTOptionPoolValueRef Value = (RTOptionPoolValueRef)ArrayAppendUninitializedElement(OptionPool->EpicLevels);
-    Value->Value = Level;
-    Value->Rate = (Int32)(Rate / 100.0 * INT32_MAX);
+    RTOptionPoolValueTableAppend(OptionPoolManager->Allocator, &OptionPool->EpicLevels, Level, Rate);
 }
 
 Void RTOptionPoolManagerAddEpicOption(
@@ -118,18 +295,8 @@ Void RTOptionPoolManagerAddEpicOption(
 ) {
     RTOptionPoolRef OptionPool = RTOptionPoolManagerGetOptionPool(OptionPoolManager, PoolIndex);
     Int OptionIndex = (Int)Level << 16 | (Int)ItemType;
-    ArrayRef EpicOptions = (ArrayRef)DictionaryLookup(OptionPool->EpicOptions, &OptionIndex);
-    if (!EpicOptions) {
-        struct _Array EpicOptionsMemory = { 0 };
-        ArrayInitializeEmpty(&EpicOptionsMemory, OptionPoolManager->Allocator, sizeof(struct _RTOptionPoolValue), 8);
-        DictionaryInsert(OptionPool->EpicOptions, &OptionIndex, &EpicOptionsMemory, sizeof(struct _Array));
-        EpicOptions = DictionaryLookup(OptionPool->EpicOptions, &OptionIndex);
-        assert(EpicOptions);
-    }
-
-    RTOptionPoolValueRef Value = (RTOptionPoolValueRef)ArrayAppendUninitializedElement(EpicOptions);
-    Value->Value = ForceIndex;
-    Value->Rate = (Int32)(Rate / 100.0 * INT32_MAX);
+    RTOptionPoolValueTableRef EpicOptions = RTOptionPoolGetValueTableGroup(OptionPoolManager, OptionPool->EpicOptions, OptionIndex);
+    RTOptionPoolValueTableAppend(OptionPoolManager->Allocator, EpicOptions, ForceIndex, Rate);
 }
 
 Void RTOptionPoolManagerAddForceSlot(
@@ -139,9 +306,7 @@ Void RTOptionPoolManagerAddForceSlot(
     Float64 Rate
 ) {
     RTOptionPoolRef OptionPool = RTOptionPoolManagerGetOptionPool(OptionPoolManager, PoolIndex);
-    RTOptionPoolValueRef Value = (RTOptionPoolValueRef)ArrayAppendUninitializedElement(OptionPool->ForceSlots);
-    Value->Value = Count;
-    Value->Rate = (Int32)(Rate / 100.0 * INT32_MAX);
+    RTOptionPoolValueTableAppend(OptionPoolManager->Allocator, &OptionPool->ForceSlots, Count, Rate);
 }
 
 Void RTOptionPoolManagerAddForceOptionSlot(
@@ -151,9 +316,7 @@ Void RTOptionPoolManagerAddForceOptionSlot(
     Float64 Rate
 ) {
     RTOptionPoolRef OptionPool = RTOptionPoolManagerGetOptionPool(OptionPoolManager, PoolIndex);
-    RTOptionPoolValueRef Value = (RTOptionPoolValueRef)ArrayAppendUninitializedElement(OptionPool->ForceSlots);
-    Value->Value = Count;
-    Value->Rate = (Int32)(Rate / 100.0 * INT32_MAX);
+    RTOptionPoolValueTableAppend(OptionPoolManager->Allocator, &OptionPool->ForceOptionSlots, Count, Rate);
 }
 
 Void RTOptionPoolManagerAddForceOption(
@@ -165,64 +328,97 @@ Void RTOptionPoolManagerAddForceOption(
 ) {
     RTOptionPoolRef OptionPool = RTOptionPoolManagerGetOptionPool(OptionPoolManager, PoolIndex);
     Int OptionIndex = ItemType;
-    ArrayRef ForceOptions = DictionaryLookup(OptionPool->ForceOptions, &OptionIndex);
-    if (!ForceOptions) {
-        struct _Array ForceOptionsMemory = { 0 };
-        ArrayInitializeEmpty(&ForceOptionsMemory, OptionPoolManager->Allocator, sizeof(struct _RTOptionPoolValue), 8);
-        DictionaryInsert(OptionPool->ForceOptions, &OptionIndex, &ForceOptionsMemory, sizeof(struct _Array));
-        ForceOptions = DictionaryLookup(OptionPool->ForceOptions, &OptionIndex);
-        assert(ForceOptions);
-    }
-
-    RTOptionPoolValueRef Value = (RTOptionPoolValueRef)ArrayAppendUninitializedElement(ForceOptions);
-    Value->Value = ForceIndex;
-    Value->Rate = (Int32)(Rate / 100.0 * INT32_MAX);
+    RTOptionPoolValueTableRef ForceOptions = RTOptionPoolGetValueTableGroup(OptionPoolManager, OptionPool->ForceOptions, OptionIndex);
+    RTOptionPoolValueTableAppend(OptionPoolManager->Allocator, ForceOptions, ForceIndex, Rate);
 }
 
-RTOptionPoolValueRef RTCalculateOptionPoolValue(
-    ArrayRef ValuePool,
-    Int32* Seed
+Void RTOptionPoolManagerCompile(
+    RTOptionPoolManagerRef OptionPoolManager
 ) {
-    Int32 RateValue = RandomRange(Seed, 0, INT32_MAX);
-    Int32 RateOffset = 0;
+    RTOptionPoolManagerReleaseItemTypeTables(OptionPoolManager);
+
+    DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(OptionPoolManager->OptionPool);
+    while (Iterator.Key) {
+        RTOptionPoolRef OptionPool = (RTOptionPoolRef)Iterator.Value;
+        RTOptionPoolValueTableCompile(OptionPoolManager->Allocator, &OptionPool->ItemLevels);
+        RTOptionPoolValueTableCompile(OptionPoolManager->Allocator, &OptionPool->EpicLevels);
+        RTOptionPoolValueTableCompile(OptionPoolManager->Allocator, &OptionPool->ForceSlots);
+        RTOptionPoolValueTableCompile(OptionPoolManager->Allocator, &OptionPool->ForceOptionSlots);
+
+        DictionaryKeyIterator GroupIterator = DictionaryGetKeyIterator(OptionPool->EpicOptions);
+        while (GroupIterator.Key) {
+            RTOptionPoolValueTableCompile(OptionPoolManager->Allocator, (RTOptionPoolValueTableRef)GroupIterator.Value);
+            GroupIterator = DictionaryKeyIteratorNext(GroupIterator);
+        }
 
-    for (Int Index = 0; Index < ArrayGetElementCount(ValuePool); Index += 1) {
-        RTOptionPoolValueRef Value = (RTOptionPoolValueRef)ArrayGetElementAtIndex(ValuePool, Index);
-        if (RateValue <= RateOffset + Value->Rate) {
-            return Value;
+        GroupIterator = DictionaryGetKeyIterator(OptionPool->ForceOptions);
+        while (GroupIterator.Key) {
+            RTOptionPoolValueTableCompile(OptionPoolManager->Allocator, (RTOptionPoolValueTableRef)GroupIterator.Value);
+            GroupIterator = DictionaryKeyIteratorNext(GroupIterator);
         }
 
-        RateOffset += Value->Rate;
+        Iterator = DictionaryKeyIteratorNext(Iterator);
     }
-
-    return NULL;
 }
 
-Void RTOptionPoolManagerCalculateOptions(
-    RTRuntimeRef Runtime,
+RTOptionPoolItemTypeTableRef RTOptionPoolManagerGetItemTypeTable(
     RTOptionPoolManagerRef OptionPoolManager,
     Int OptionPoolIndex,
+    Int32 ItemType
+) {
+    if (OptionPoolIndex < 1) return NULL;
+
+    UInt64 TableKey = ((UInt64)(UInt32)OptionPoolIndex << 32) | (UInt32)ItemType;
+    RTOptionPoolItemTypeTableRef* Cached = (RTOptionPoolItemTypeTableRef*)DictionaryLookup(OptionPoolManager->ItemTypeTables, &TableKey);
+    if (Cached) return *Cached;
+
+    RTOptionPoolRef OptionPool = (RTOptionPoolRef)DictionaryLookup(OptionPoolManager->OptionPool, &OptionPoolIndex);
+    if (!OptionPool) return NULL;
+
+    RTOptionPoolItemTypeTableRef ItemTypeTable = (RTOptionPoolItemTypeTableRef)AllocatorAllocate(OptionPoolManager->Allocator, sizeof(struct _RTOptionPoolItemTypeTable));
+    if (!ItemTypeTable) Fatal("Memory allocation failed!");
+
+    ItemTypeTable->OptionPool = OptionPool;
+    ItemTypeTable->EpicOptionCount = (Int32)ArrayGetElementCount(&OptionPool->EpicLevels.Values);
+    ItemTypeTable->EpicOptions = NULL;
+    if (ItemTypeTable->EpicOptionCount > 0) {
+        ItemTypeTable->EpicOptions = (RTOptionPoolValueTableRef*)AllocatorAllocate(OptionPoolManager->Allocator, sizeof(RTOptionPoolValueTableRef) * ItemTypeTable->EpicOptionCount);
+        if (!ItemTypeTable->EpicOptions) Fatal("Memory allocation failed!");
+    }
+
+    for (Int32 Index = 0; Index < ItemTypeTable->EpicOptionCount; Index += 1) {
+        RTOptionPoolValueRef EpicLevel = RTOptionPoolValueTableGetValue(&OptionPool->EpicLevels, Index);
+        Int OptionIndex = (Int)EpicLevel->Value << 16 | (Int)ItemType;
+        ItemTypeTable->EpicOptions[Index] = (RTOptionPoolValueTableRef)DictionaryLookup(OptionPool->EpicOptions, &OptionIndex);
+    }
+
+    Int OptionIndex = ItemType;
+    ItemTypeTable->ForceOptions = (RTOptionPoolValueTableRef)DictionaryLookup(OptionPool->ForceOptions, &OptionIndex);
+
+    DictionaryInsert(OptionPoolManager->ItemTypeTables, &TableKey, &ItemTypeTable, sizeof(RTOptionPoolItemTypeTableRef));
+    return ItemTypeTable;
+}
+
+Void RTOptionPoolManagerCalculateOptions(
+    RTOptionPoolItemTypeTableRef ItemTypeTable,
+    Int32* Seed,
     RTDropResultRef DropResult
 ) {
-    if (OptionPoolIndex < 1) return;
-
-    RTItemDataRef ItemData = RTRuntimeGetItemDataByIndex(Runtime, DropResult->ItemID.ID);
-    RTOptionPoolRef OptionPool = RTOptionPoolManagerGetOptionPool(OptionPoolManager, OptionPoolIndex);
-    if (!OptionPool) return;
-    
-    Int32 Seed = (Int32)GetTimestampMs();
-    RTOptionPoolValueRef ItemLevelValue = RTCalculateOptionPoolValue(OptionPool->ItemLevels, &Seed);
+    if (!ItemTypeTable) return;
+
+    RTOptionPoolRef OptionPool = ItemTypeTable->OptionPool;
+    RTOptionPoolValueRef ItemLevelValue = RTOptionPoolValueTableGetValue(&OptionPool->ItemLevels, RTOptionPoolValueTableSample(&OptionPool->ItemLevels, Seed));
     if (ItemLevelValue) {
         DropResult->ItemID.UpgradeLevel = ItemLevelValue->Value;
     }
 
     RTItemOptions ItemOptions = { .Serial = DropResult->ItemOptions };
 
-    RTOptionPoolValueRef EpicLevelValue = RTCalculateOptionPoolValue(OptionPool->EpicLevels, &Seed);
+    Int32 EpicLevelIndex = RTOptionPoolValueTableSample(&OptionPool->EpicLevels, Seed);
+    RTOptionPoolValueRef EpicLevelValue = RTOptionPoolValueTableGetValue(&OptionPool->EpicLevels, EpicLevelIndex);
     if (EpicLevelValue && EpicLevelValue->Value > 0) {
-        Int OptionIndex = EpicLevelValue->Value << 16 | ItemData->ItemType;
-        ArrayRef EpicOptions = (ArrayRef)DictionaryLookup(OptionPool->EpicOptions, &OptionIndex);
-        RTOptionPoolValueRef EpicOptionValue = RTCalculateOptionPoolValue(EpicOptions, &Seed);
+        RTOptionPoolValueTableRef EpicOptions = ItemTypeTable->EpicOptions[EpicLevelIndex];
+        RTOptionPoolValueRef EpicOptionValue = (EpicOptions) ? RTOptionPoolValueTableGetValue(EpicOptions, RTOptionPoolValueTableSample(EpicOptions, Seed)) : NULL;
         if (EpicOptionValue && EpicOptionValue->Value > 0) {
             RTItemOptionSlot Slot = {
                 .ForceIndex = EpicOptionValue->Value,
@@ -233,17 +429,16 @@ Void RTOptionPoolManagerCalculateOptions(
         }
     }
 
-    RTOptionPoolValueRef ForceSlotValue = RTCalculateOptionPoolValue(OptionPool->ForceSlots, &Seed);
+    RTOptionPoolValueRef ForceSlotValue = RTOptionPoolValueTableGetValue(&OptionPool->ForceSlots, RTOptionPoolValueTableSample(&OptionPool->ForceSlots, Seed));
     if (ForceSlotValue) {
         ItemOptions.Equipment.SlotCount = ForceSlotValue->Value;
     }
 
-    RTOptionPoolValueRef ForceOptionSlotValue = RTCalculateOptionPoolValue(OptionPool->ForceOptionSlots, &Seed);
-    if (ForceOptionSlotValue) {
+    RTOptionPoolValueRef ForceOptionSlotValue = RTOptionPoolValueTableGetValue(&OptionPool->ForceOptionSlots, RTOptionPoolValueTableSample(&OptionPool->ForceOptionSlots, Seed));
+    if (ForceOptionSlotValue && ItemTypeTable->ForceOptions) {
         for (Int SlotIndex = 0; SlotIndex < ForceOptionSlotValue->Value; SlotIndex += 1) {
-            Int OptionIndex = ItemData->ItemType;
-            ArrayRef ForceOptions = (ArrayRef)DictionaryLookup(OptionPool->ForceOptions, &OptionIndex);
-            RTOptionPoolValueRef ForceOptionValue = RTCalculateOptionPoolValue(ForceOptions, &Seed);
+            RTOptionPoolValueTableRef ForceOptions = ItemTypeTable->ForceOptions;
+            RTOptionPoolValueRef ForceOptionValue = RTOptionPoolValueTableGetValue(ForceOptions, RTOptionPoolValueTableSample(ForceOptions, Seed));
             if (ForceOptionValue && ForceOptionValue->Value > 0) {
                 RTItemOptionSlot Slot = {
                     .ForceIndex = ForceOptionValue->Value,
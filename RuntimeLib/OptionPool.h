@@ -58,10 +58,19 @@ Void RTOptionPoolManagerAddForceOption(
     Float64 Rate
 );
 
-Void RTOptionPoolManagerCalculateOptions(
-    RTRuntimeRef Runtime,
+Void RTOptionPoolManagerCompile(
+    RTOptionPoolManagerRef OptionPoolManager
+);
+
+RTOptionPoolItemTypeTableRef RTOptionPoolManagerGetItemTypeTable(
     RTOptionPoolManagerRef OptionPoolManager,
     Int OptionPoolIndex,
+    Int32 ItemType
+);
+
+Void RTOptionPoolManagerCalculateOptions(
+    RTOptionPoolItemTypeTableRef ItemTypeTable,
+    Int32* Seed,
     RTDropResultRef DropResult
 );
 
@@ -25,7 +25,7 @@ Void RTCharacterAddOverlordExp(
 			Character->Data.OverlordMasteryInfo.Info.Level = NextMastery->Level;
 			Character->SyncMask.OverlordMasteryInfo = true;
 
-			RTCharacterInitializeAttributes(Runtime, Character);
+			RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_OVERLORD_MASTERY));
             RTRuntimeBroadcastCharacterData(
                 Runtime,
                 Character,
@@ -1,5 +1,20 @@
 #include "Party.h"
 
+#define SPARSE_SCHEMA_STRUCT struct _RTParty
+
+static const struct _SparseField kRTPartySchemaFields[] = {
+    RUNTIME_PARTY_FIELDS(SPARSE_SCHEMA_FIELD, SPARSE_SCHEMA_COUNTED_ARRAY, SPARSE_SCHEMA_ARRAY)
+};
+
+#undef SPARSE_SCHEMA_STRUCT
+
+const struct _SparseSchema kRTPartySchema = {
+    "RTParty",
+    sizeof(struct _RTParty),
+    sizeof(kRTPartySchemaFields) / sizeof(kRTPartySchemaFields[0]),
+    kRTPartySchemaFields
+};
+
 RTPartyMemberInfoRef RTPartyGetMember(
     RTPartyRef Party,
     UInt32 CharacterIndex
@@ -60,19 +60,24 @@ struct _RTPartyInvitation {
     Timestamp InvitationTimestamp;
 };
 
+#define RUNTIME_PARTY_FIELDS(__FIELD__, __COUNTED_ARRAY__, __ARRAY__) \
+    __FIELD__(RTEntityID, ID) \
+    __FIELD__(Int, LeaderCharacterIndex) \
+    __FIELD__(Int, WorldServerIndex) \
+    __FIELD__(Int32, PartyType) \
+    __FIELD__(Int32, MemberCount) \
+    __COUNTED_ARRAY__(struct _RTPartyMemberInfo, Members, RUNTIME_PARTY_MAX_MEMBER_COUNT, MemberCount) \
+    __ARRAY__(struct _RTItemSlot, Inventory, RUNTIME_PARTY_MAX_INVENTORY_SLOT_COUNT) \
+    __ARRAY__(struct _RTQuestSlot, QuestSlot, RUNTIME_PARTY_MAX_QUEST_SLOT_COUNT)
+
 struct _RTParty {
-	RTEntityID ID;
-    Int LeaderCharacterIndex;
-    Int WorldServerIndex;
-	Int32 PartyType;
-	Int32 MemberCount;
-    struct _RTPartyMemberInfo Members[RUNTIME_PARTY_MAX_MEMBER_COUNT];
-	struct _RTItemSlot Inventory[RUNTIME_PARTY_MAX_INVENTORY_SLOT_COUNT];
-	struct _RTQuestSlot QuestSlot[RUNTIME_PARTY_MAX_QUEST_SLOT_COUNT];
+    RUNTIME_PARTY_FIELDS(SPARSE_STRUCT_FIELD, SPARSE_STRUCT_COUNTED_ARRAY, SPARSE_STRUCT_ARRAY)
 };
 
 #pragma pack(pop)
 
+extern const struct _SparseSchema kRTPartySchema;
+
 Bool RTPartyIsSoloDungeon(
     RTEntityID PartyID
 );
@@ -12,6 +12,8 @@ RTPartyManagerRef RTPartyManagerCreate(
     PartyManager->SoloPartyPool = MemoryPoolCreate(Allocator, sizeof(struct _RTParty), MaxPartyCount);
     PartyManager->CharacterToPartyEntity = IndexDictionaryCreate(Allocator, MaxPartyCount);
     PartyManager->CharacterToPartyInvite = IndexDictionaryCreate(Allocator, MaxPartyCount);
+    PartyManager->OnDestroyParty = NULL;
+    PartyManager->OnDestroyPartyUserData = NULL;
 
     Int NullIndex = 0;
     MemoryPoolReserve(PartyManager->PartyPool, NullIndex);
@@ -32,6 +34,15 @@ Void RTPartyManagerDestroy(
     AllocatorDeallocate(PartyManager->Allocator, PartyManager);
 }
 
+Void RTPartyManagerSetDestroyPartyCallback(
+    RTPartyManagerRef PartyManager,
+    RTPartyManagerDestroyPartyCallback Callback,
+    Void* UserData
+) {
+    PartyManager->OnDestroyParty = Callback;
+    PartyManager->OnDestroyPartyUserData = UserData;
+}
+
 // TODO: Solo dungeon party is not cleaned up always when the socket disconnects with a timeout (simulatable by halting on a breakpoint)
 RTPartyRef RTPartyManagerCreateParty(
     RTPartyManagerRef PartyManager,
@@ -83,6 +94,10 @@ Void RTPartyManagerDestroyParty(
 ) {
     // TODO: Cleanup also all invitations to this party!!!
 
+    if (PartyManager->OnDestroyParty) {
+        PartyManager->OnDestroyParty(PartyManager, Party, PartyManager->OnDestroyPartyUserData);
+    }
+
     for (Int MemberIndex = 0; MemberIndex < Party->MemberCount; MemberIndex += 1) {
         UInt32 CharacterIndex = Party->Members[MemberIndex].CharacterIndex;
         DictionaryRemove(PartyManager->CharacterToPartyEntity, &CharacterIndex);
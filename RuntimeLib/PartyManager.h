@@ -5,6 +5,12 @@
 
 EXTERN_C_BEGIN
 
+typedef Void (*RTPartyManagerDestroyPartyCallback)(
+    RTPartyManagerRef PartyManager,
+    RTPartyRef Party,
+    Void* UserData
+);
+
 struct _RTPartyManager {
     AllocatorRef Allocator;
     MemoryPoolRef PartyPool;
@@ -12,6 +18,8 @@ struct _RTPartyManager {
     MemoryPoolRef SoloPartyPool;
     DictionaryRef CharacterToPartyEntity;
     DictionaryRef CharacterToPartyInvite;
+    RTPartyManagerDestroyPartyCallback OnDestroyParty;
+    Void* OnDestroyPartyUserData;
 };
 
 RTPartyManagerRef RTPartyManagerCreate(
@@ -23,6 +31,13 @@ Void RTPartyManagerDestroy(
     RTPartyManagerRef PartyManager
 );
 
+// NOTE: The callback runs for every party destroyed locally or remotely before its memory is released
+Void RTPartyManagerSetDestroyPartyCallback(
+    RTPartyManagerRef PartyManager,
+    RTPartyManagerDestroyPartyCallback Callback,
+    Void* UserData
+);
+
 RTPartyRef RTPartyManagerCreateParty(
     RTPartyManagerRef PartyManager,
     RTPartyMemberInfoRef Member,
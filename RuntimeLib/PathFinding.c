@@ -1,155 +1,886 @@
-#include "World.h"
 #include "Movement.h"
+#include "PathFinding.h"
+#include "Runtime.h"
+#include "World.h"
+#include "WorldManager.h"
+
+#define RUNTIME_PATH_FINDING_STRAIGHT_COST		10
+#define RUNTIME_PATH_FINDING_DIAGONAL_COST		14
+#define RUNTIME_PATH_FINDING_TILE_COUNT			(RUNTIME_WORLD_SIZE * RUNTIME_WORLD_SIZE)
+#define RUNTIME_PATH_FINDING_CLUSTER_COUNT		(RUNTIME_WORLD_CHUNK_COUNT * RUNTIME_WORLD_CHUNK_COUNT)
+#define RUNTIME_PATH_FINDING_CACHE_BUCKET_COUNT	(RUNTIME_PATH_FINDING_CACHE_SIZE * 2)
+
+struct _RTPathFindingNodeState {
+	UInt32 Generation;
+	Int32 Cost;
+	Int32 Parent;
+	Int32 HeapIndex;
+};
+typedef struct _RTPathFindingNodeState* RTPathFindingNodeStateRef;
 
-typedef struct _RTPathFindingOpenNode* RTPathFindingOpenNodeRef;
-typedef struct _RTPathFindingNode* RTPathFindingNodeRef;
+struct _RTPathFindingHeapNode {
+	Int32 Priority;
+	Int32 Heuristic;
+	Int32 Node;
+};
+typedef struct _RTPathFindingHeapNode* RTPathFindingHeapNodeRef;
+
+struct _RTPathFindingHeap {
+	Int32 Count;
+	Int32 Capacity;
+	RTPathFindingHeapNodeRef Nodes;
+};
+typedef struct _RTPathFindingHeap* RTPathFindingHeapRef;
 
-struct _RTPathFindingOpenNode {
-	RTPathFindingOpenNodeRef Next;
-	Bool IsOpen;
+struct _RTPathFindingBounds {
+	Int32 MinX;
+	Int32 MinY;
+	Int32 MaxX;
+	Int32 MaxY;
 };
+typedef struct _RTPathFindingBounds RTPathFindingBounds;
 
-struct _RTPathFindingNode {
+struct _RTPathFindingGraphNode {
 	Int32 X;
 	Int32 Y;
-	Int32 TotalCost;
-	RTPathFindingNodeRef Parent;
-	RTPathFindingNodeRef Next;
+	Int32 Cluster;
+	Int32 EdgeIndex;
+	Int32 EdgeCount;
+};
+typedef struct _RTPathFindingGraphNode* RTPathFindingGraphNodeRef;
+
+struct _RTPathFindingGraphEdge {
+	Int32 Target;
+	Int32 Cost;
+};
+typedef struct _RTPathFindingGraphEdge* RTPathFindingGraphEdgeRef;
+
+struct _RTPathFindingGraph {
+	AllocatorRef Allocator;
+	UInt32 CollisionMask;
+	ArrayRef Nodes;
+	ArrayRef Edges;
+	Int32 ClusterNodeIndex[RUNTIME_PATH_FINDING_CLUSTER_COUNT];
+	Int32 ClusterNodeCount[RUNTIME_PATH_FINDING_CLUSTER_COUNT];
+};
+
+struct _RTPathFindingCacheEntry {
+	UInt64 Key;
+	Bool IsPathFound;
+	Int32 WaypointCount;
+	RTPosition Waypoints[RUNTIME_MOVEMENT_MAX_WAYPOINT_COUNT];
+	Int32 BucketNext;
+	Int32 Previous;
+	Int32 Next;
+};
+typedef struct _RTPathFindingCacheEntry* RTPathFindingCacheEntryRef;
+
+struct _RTPathFindingCache {
+	AllocatorRef Allocator;
+	Int32 Count;
+	Int32 Head;
+	Int32 Tail;
+	Int32 Buckets[RUNTIME_PATH_FINDING_CACHE_BUCKET_COUNT];
+	struct _RTPathFindingCacheEntry Entries[RUNTIME_PATH_FINDING_CACHE_SIZE];
 };
 
 struct _RTPathFindingContext {
-	Int32 TargetX;
-	Int32 TargetY;
+	AllocatorRef Allocator;
+	UInt32 TileGeneration;
+	UInt32 GraphGeneration;
+	Int32 GraphCapacity;
 	Int32 PathLength;
-	Int32 PathLengthPrevious;
-	Int32 PathX[RUNTIME_MOVEMENT_MAX_PATH_FIND_NODE_COUNT];
-	Int32 PathY[RUNTIME_MOVEMENT_MAX_PATH_FIND_NODE_COUNT];
-	RTPathFindingNodeRef OpenList;
-	RTPathFindingOpenNodeRef OpenNodeHead;
-	RTPathFindingOpenNodeRef OpenNodeTail;
-	struct _RTPathFindingNode Nodes[RUNTIME_MOVEMENT_MAX_PATH_FIND_NODE_COUNT];
-	struct _RTPathFindingOpenNode OpenNodes[RUNTIME_WORLD_SIZE * RUNTIME_WORLD_SIZE];
+	struct _RTPathFindingHeap TileHeap;
+	struct _RTPathFindingHeap GraphHeap;
+	RTPathFindingNodeStateRef GraphStates;
+	Int32* GraphTargetCosts;
+	Int32* GraphPath;
+	Int32 PathX[RUNTIME_MOVEMENT_MAX_PATH_LENGTH];
+	Int32 PathY[RUNTIME_MOVEMENT_MAX_PATH_LENGTH];
+	struct _RTPathFindingNodeState TileStates[RUNTIME_PATH_FINDING_TILE_COUNT];
 };
 
 const Int32 PathFindingOffsetX[8] = { 1, -1,  0,  0, -1,  1,  1, -1 };
 const Int32 PathFindingOffsetY[8] = { 0,  0,  1, -1,  1, -1,  1, -1 };
-static struct _RTPathFindingContext PathFindingContext = { 0 };
 
-RTPathFindingNodeRef RTPathFindingAStar(
-	RTRuntimeRef Runtime,
-	RTWorldContextRef World,
+static inline Int32 RTPathFindingGetTileIndex(
+	Int32 X,
+	Int32 Y
+) {
+	return Y + X * RUNTIME_WORLD_SIZE;
+}
+
+static inline Int32 RTPathFindingGetClusterIndex(
+	Int32 X,
+	Int32 Y
+) {
+	return (X >> RUNTIME_WORLD_CHUNK_SIZE_EXPONENT) + (Y >> RUNTIME_WORLD_CHUNK_SIZE_EXPONENT) * RUNTIME_WORLD_CHUNK_COUNT;
+}
+
+static inline Int32 RTPathFindingHeuristic(
+	Int32 X,
+	Int32 Y,
+	Int32 EndX,
+	Int32 EndY
+) {
+	Int32 DeltaX = ABS(EndX - X);
+	Int32 DeltaY = ABS(EndY - Y);
+	Int32 Straight = ABS(DeltaX - DeltaY);
+	Int32 Diagonal = MIN(DeltaX, DeltaY);
+	return Straight * RUNTIME_PATH_FINDING_STRAIGHT_COST + Diagonal * RUNTIME_PATH_FINDING_DIAGONAL_COST;
+}
+
+static inline Bool RTPathFindingIsTileBlocked(
+	RTWorldTile* Tiles,
+	Int32 TileIndex,
+	UInt32 CollisionMask
+) {
+	return (Tiles[TileIndex].Serial & CollisionMask) > 0;
+}
+
+static RTPathFindingBounds RTPathFindingGetClusterBounds(
+	Int32 Cluster
+) {
+	RTPathFindingBounds Bounds = { 0 };
+	Bounds.MinX = (Cluster % RUNTIME_WORLD_CHUNK_COUNT) * RUNTIME_WORLD_CHUNK_SIZE;
+	Bounds.MinY = (Cluster / RUNTIME_WORLD_CHUNK_COUNT) * RUNTIME_WORLD_CHUNK_SIZE;
+	Bounds.MaxX = Bounds.MinX + RUNTIME_WORLD_CHUNK_SIZE - 1;
+	Bounds.MaxY = Bounds.MinY + RUNTIME_WORLD_CHUNK_SIZE - 1;
+	return Bounds;
+}
+
+static RTPathFindingBounds RTPathFindingGetWorldBounds() {
+	RTPathFindingBounds Bounds = { 0, 0, RUNTIME_WORLD_SIZE - 1, RUNTIME_WORLD_SIZE - 1 };
+	return Bounds;
+}
+
+static Void RTPathFindingHeapInitialize(
+	AllocatorRef Allocator,
+	RTPathFindingHeapRef Heap,
+	Int32 Capacity
+) {
+	Heap->Count = 0;
+	Heap->Capacity = Capacity;
+	Heap->Nodes = (RTPathFindingHeapNodeRef)AllocatorAllocate(Allocator, sizeof(struct _RTPathFindingHeapNode) * Capacity);
+	if (!Heap->Nodes) Fatal("Memory allocation failed!");
+}
+
+static Void RTPathFindingHeapReserve(
+	AllocatorRef Allocator,
+	RTPathFindingHeapRef Heap,
+	Int32 Capacity
+) {
+	if (Heap->Capacity >= Capacity) return;
+
+	Heap->Nodes = (RTPathFindingHeapNodeRef)AllocatorReallocate(Allocator, Heap->Nodes, sizeof(struct _RTPathFindingHeapNode) * Capacity);
+	if (!Heap->Nodes) Fatal("Memory allocation failed!");
+	Heap->Capacity = Capacity;
+}
+
+static inline Bool RTPathFindingHeapIsLess(
+	RTPathFindingHeapNodeRef Lhs,
+	RTPathFindingHeapNodeRef Rhs
+) {
+	if (Lhs->Priority != Rhs->Priority) return Lhs->Priority < Rhs->Priority;
+	return Lhs->Heuristic < Rhs->Heuristic;
+}
+
+static Void RTPathFindingHeapSiftUp(
+	RTPathFindingHeapRef Heap,
+	RTPathFindingNodeStateRef States,
+	Int32 Index
+) {
+	struct _RTPathFindingHeapNode Node = Heap->Nodes[Index];
+	while (Index > 0) {
+		Int32 ParentIndex = (Index - 1) >> 1;
+		if (!RTPathFindingHeapIsLess(&Node, &Heap->Nodes[ParentIndex])) break;
+
+		Heap->Nodes[Index] = Heap->Nodes[ParentIndex];
+		States[Heap->Nodes[Index].Node].HeapIndex = Index;
+		Index = ParentIndex;
+	}
+
+	Heap->Nodes[Index] = Node;
+	States[Node.Node].HeapIndex = Index;
+}
+
+static Void RTPathFindingHeapSiftDown(
+	RTPathFindingHeapRef Heap,
+	RTPathFindingNodeStateRef States,
+	Int32 Index
+) {
+	struct _RTPathFindingHeapNode Node = Heap->Nodes[Index];
+	while (true) {
+		Int32 ChildIndex = (Index << 1) + 1;
+		if (ChildIndex >= Heap->Count) break;
+
+		if (ChildIndex + 1 < Heap->Count && RTPathFindingHeapIsLess(&Heap->Nodes[ChildIndex + 1], &Heap->Nodes[ChildIndex])) {
+			ChildIndex += 1;
+		}
+
+		if (!RTPathFindingHeapIsLess(&Heap->Nodes[ChildIndex], &Node)) break;
+
+		Heap->Nodes[Index] = Heap->Nodes[ChildIndex];
+		States[Heap->Nodes[Index].Node].HeapIndex = Index;
+		Index = ChildIndex;
+	}
+
+	Heap->Nodes[Index] = Node;
+	States[Node.Node].HeapIndex = Index;
+}
+
+static Void RTPathFindingHeapPush(
+	RTPathFindingHeapRef Heap,
+	RTPathFindingNodeStateRef States,
+	Int32 Node,
+	Int32 Priority,
+	Int32 Heuristic
+) {
+	assert(Heap->Count < Heap->Capacity);
+
+	Int32 Index = Heap->Count;
+	Heap->Count += 1;
+	Heap->Nodes[Index].Priority = Priority;
+	Heap->Nodes[Index].Heuristic = Heuristic;
+	Heap->Nodes[Index].Node = Node;
+	RTPathFindingHeapSiftUp(Heap, States, Index);
+}
+
+static Void RTPathFindingHeapDecrease(
+	RTPathFindingHeapRef Heap,
+	RTPathFindingNodeStateRef States,
+	Int32 Node,
+	Int32 Priority
+) {
+	Int32 Index = States[Node].HeapIndex;
+	assert(Index >= 0 && Index < Heap->Count);
+
+	Heap->Nodes[Index].Priority = Priority;
+	RTPathFindingHeapSiftUp(Heap, States, Index);
+}
+
+static Int32 RTPathFindingHeapPop(
+	RTPathFindingHeapRef Heap,
+	RTPathFindingNodeStateRef States
+) {
+	assert(Heap->Count > 0);
+
+	Int32 Node = Heap->Nodes[0].Node;
+	States[Node].HeapIndex = -1;
+	Heap->Count -= 1;
+
+	if (Heap->Count > 0) {
+		Heap->Nodes[0] = Heap->Nodes[Heap->Count];
+		RTPathFindingHeapSiftDown(Heap, States, 0);
+	}
+
+	return Node;
+}
+
+static UInt32 RTPathFindingNextTileGeneration(
+	RTPathFindingContextRef Context
+) {
+	Context->TileGeneration += 1;
+	if (Context->TileGeneration == 0) {
+		memset(Context->TileStates, 0, sizeof(Context->TileStates));
+		Context->TileGeneration = 1;
+	}
+
+	Context->TileHeap.Count = 0;
+	return Context->TileGeneration;
+}
+
+static UInt32 RTPathFindingNextGraphGeneration(
+	RTPathFindingContextRef Context
+) {
+	Context->GraphGeneration += 1;
+	if (Context->GraphGeneration == 0) {
+		memset(Context->GraphStates, 0, sizeof(struct _RTPathFindingNodeState) * Context->GraphCapacity);
+		Context->GraphGeneration = 1;
+	}
+
+	Context->GraphHeap.Count = 0;
+	return Context->GraphGeneration;
+}
+
+static Void RTPathFindingReserveGraphCapacity(
+	RTPathFindingContextRef Context,
+	Int32 Capacity
+) {
+	if (Context->GraphCapacity >= Capacity) return;
+
+	Context->GraphStates = (RTPathFindingNodeStateRef)AllocatorReallocate(Context->Allocator, Context->GraphStates, sizeof(struct _RTPathFindingNodeState) * Capacity);
+	Context->GraphTargetCosts = (Int32*)AllocatorReallocate(Context->Allocator, Context->GraphTargetCosts, sizeof(Int32) * Capacity);
+	Context->GraphPath = (Int32*)AllocatorReallocate(Context->Allocator, Context->GraphPath, sizeof(Int32) * Capacity);
+	if (!Context->GraphStates || !Context->GraphTargetCosts || !Context->GraphPath) Fatal("Memory allocation failed!");
+
+	// NOTE: Resetting the generation forces all states to be treated as unvisited after growing
+	memset(Context->GraphStates, 0, sizeof(struct _RTPathFindingNodeState) * Capacity);
+	Context->GraphGeneration = 0;
+	Context->GraphCapacity = Capacity;
+	RTPathFindingHeapReserve(Context->Allocator, &Context->GraphHeap, Capacity);
+}
+
+RTPathFindingContextRef RTPathFindingContextCreate(
+	AllocatorRef Allocator
+) {
+	RTPathFindingContextRef Context = (RTPathFindingContextRef)AllocatorAllocate(Allocator, sizeof(struct _RTPathFindingContext));
+	if (!Context) Fatal("Memory allocation failed!");
+	memset(Context, 0, sizeof(struct _RTPathFindingContext));
+
+	Context->Allocator = Allocator;
+	RTPathFindingHeapInitialize(Allocator, &Context->TileHeap, RUNTIME_PATH_FINDING_TILE_COUNT);
+	RTPathFindingHeapInitialize(Allocator, &Context->GraphHeap, 1);
+	return Context;
+}
+
+Void RTPathFindingContextDestroy(
+	RTPathFindingContextRef Context
+) {
+	AllocatorDeallocate(Context->Allocator, Context->TileHeap.Nodes);
+	AllocatorDeallocate(Context->Allocator, Context->GraphHeap.Nodes);
+	if (Context->GraphStates) AllocatorDeallocate(Context->Allocator, Context->GraphStates);
+	if (Context->GraphTargetCosts) AllocatorDeallocate(Context->Allocator, Context->GraphTargetCosts);
+	if (Context->GraphPath) AllocatorDeallocate(Context->Allocator, Context->GraphPath);
+	AllocatorDeallocate(Context->Allocator, Context);
+}
+
+// NOTE: Searches the tiles inside the bounds, a negative end position floods the whole bounds to collect the costs
+static Bool RTPathFindingSearchTiles(
+	RTPathFindingContextRef Context,
+	RTWorldTile* Tiles,
+	RTPathFindingBounds Bounds,
 	Int32 StartX,
 	Int32 StartY,
 	Int32 EndX,
 	Int32 EndY,
 	UInt32 CollisionMask,
-    UInt32 IgnoreMask
+	Int32 MaxNodeCount
 ) {
-	struct _RTPathFindingContext* Context = &PathFindingContext;
+	UInt32 Generation = RTPathFindingNextTileGeneration(Context);
+	RTPathFindingNodeStateRef States = Context->TileStates;
+	RTPathFindingHeapRef Heap = &Context->TileHeap;
+	Bool IsFlooding = (EndX < 0 || EndY < 0);
+	Int32 EndIndex = IsFlooding ? -1 : RTPathFindingGetTileIndex(EndX, EndY);
 
-	RTPathFindingOpenNodeRef OpenNode;
-	while (Context->OpenNodeHead) {
-		OpenNode = Context->OpenNodeHead;
-		Context->OpenNodeHead = Context->OpenNodeHead->Next;
-		OpenNode->IsOpen = false;
-		OpenNode->Next = NULL;
-	}
+	Int32 StartIndex = RTPathFindingGetTileIndex(StartX, StartY);
+	Int32 StartHeuristic = IsFlooding ? 0 : RTPathFindingHeuristic(StartX, StartY, EndX, EndY);
+	States[StartIndex].Generation = Generation;
+	States[StartIndex].Cost = 0;
+	States[StartIndex].Parent = -1;
+	RTPathFindingHeapPush(Heap, States, StartIndex, StartHeuristic, StartHeuristic);
 
-	Context->TargetX = EndX;
-	Context->TargetY = EndY;
-	Context->Nodes[0].X = StartX;
-	Context->Nodes[0].Y = StartY;
-	Context->OpenNodeHead = Context->OpenNodeTail = Context->OpenNodes + StartX + StartY * RUNTIME_WORLD_SIZE;
-	Context->OpenNodeHead->IsOpen = true;
-	Context->Nodes[0].TotalCost = MAX(ABS(EndX - StartX), ABS(EndY - StartY));
-	Context->Nodes[0].Parent = NULL;
-	Context->Nodes[0].Next = NULL;
-	Context->OpenList = Context->Nodes;
-
-	Int32 NodeIndex = 1;
-	while (Context->OpenList) {
-		RTPathFindingNodeRef Node = Context->OpenList;
-		Context->OpenList = Context->OpenList->Next;
-
-		if (Node->X == Context->TargetX && Node->Y == Context->TargetY) {
-			return Node;
-		}
+	Int32 NodeCount = 0;
+	while (Heap->Count > 0) {
+		Int32 NodeIndex = RTPathFindingHeapPop(Heap, States);
+		if (NodeIndex == EndIndex) return true;
+
+		NodeCount += 1;
+		if (NodeCount > MaxNodeCount) return false;
+
+		Int32 NodeX = NodeIndex / RUNTIME_WORLD_SIZE;
+		Int32 NodeY = NodeIndex % RUNTIME_WORLD_SIZE;
+		Int32 NodeCost = States[NodeIndex].Cost;
 
 		for (Int Index = 0; Index < 8; Index += 1) {
-			Int32 X = Node->X + PathFindingOffsetX[Index];
-			Int32 Y = Node->Y + PathFindingOffsetY[Index];
+			Int32 X = NodeX + PathFindingOffsetX[Index];
+			Int32 Y = NodeY + PathFindingOffsetY[Index];
 
-			if (X < 0 || X >= RUNTIME_WORLD_SIZE || Y < 0 || Y >= RUNTIME_WORLD_SIZE) {
+			if (X < Bounds.MinX || X > Bounds.MaxX || Y < Bounds.MinY || Y > Bounds.MaxY) {
 				continue;
 			}
 
-			if (Context->OpenNodes[X + Y * RUNTIME_WORLD_SIZE].IsOpen) {
+			Int32 TileIndex = RTPathFindingGetTileIndex(X, Y);
+			if (RTPathFindingIsTileBlocked(Tiles, TileIndex, CollisionMask)) {
 				continue;
 			}
 
-			if (RTWorldIsTileColliding(Runtime, World, X, Y, CollisionMask)) {
-				OpenNode = Context->OpenNodes + X + Y * RUNTIME_WORLD_SIZE;
-				OpenNode->IsOpen = true;
-				Context->OpenNodeTail->Next = OpenNode;
-				Context->OpenNodeTail = OpenNode;
-				continue;
+			Bool IsDiagonal = (PathFindingOffsetX[Index] != 0 && PathFindingOffsetY[Index] != 0);
+			Int32 Cost = NodeCost + (IsDiagonal ? RUNTIME_PATH_FINDING_DIAGONAL_COST : RUNTIME_PATH_FINDING_STRAIGHT_COST);
+			RTPathFindingNodeStateRef State = &States[TileIndex];
+
+			if (State->Generation != Generation) {
+				Int32 Heuristic = IsFlooding ? 0 : RTPathFindingHeuristic(X, Y, EndX, EndY);
+				State->Generation = Generation;
+				State->Cost = Cost;
+				State->Parent = NodeIndex;
+				RTPathFindingHeapPush(Heap, States, TileIndex, Cost + Heuristic, Heuristic);
 			}
+			else if (State->HeapIndex >= 0 && Cost < State->Cost) {
+				Int32 Heuristic = Heap->Nodes[State->HeapIndex].Heuristic;
+				State->Cost = Cost;
+				State->Parent = NodeIndex;
+				RTPathFindingHeapDecrease(Heap, States, TileIndex, Cost + Heuristic);
+			}
+		}
+	}
 
-			RTPathFindingNodeRef NewNode = Context->Nodes + NodeIndex;
-			NodeIndex += 1;
+	return false;
+}
 
-			if (NodeIndex >= RUNTIME_MOVEMENT_MAX_PATH_FIND_NODE_COUNT) {
-				return NULL;
-			}
+static Bool RTPathFindingIsTileReached(
+	RTPathFindingContextRef Context,
+	Int32 TileIndex
+) {
+	return Context->TileStates[TileIndex].Generation == Context->TileGeneration;
+}
 
-			NewNode->Parent = Node;
-			NewNode->Next = NULL;
-			NewNode->TotalCost = MAX(ABS(EndX - X), ABS(EndY - Y));
-			NewNode->X = X;
-			NewNode->Y = Y;
+// NOTE: Appends the tiles of the last search ending at EndIndex to the path, the first tile is skipped when continuing a path
+static Bool RTPathFindingAppendPath(
+	RTPathFindingContextRef Context,
+	Int32 EndIndex
+) {
+	Int32 Length = 0;
+	for (Int32 NodeIndex = EndIndex; NodeIndex >= 0; NodeIndex = Context->TileStates[NodeIndex].Parent) {
+		Length += 1;
+	}
 
-			OpenNode = Context->OpenNodes + X + Y * RUNTIME_WORLD_SIZE;
-			OpenNode->IsOpen = true;
-			Context->OpenNodeTail->Next = OpenNode;
-			Context->OpenNodeTail = OpenNode;
+	Int32 SkipCount = (Context->PathLength > 0) ? 1 : 0;
+	if (Context->PathLength + Length - SkipCount > RUNTIME_MOVEMENT_MAX_PATH_LENGTH) return false;
 
-			if ((!Context->OpenList) || (Context->OpenList->TotalCost > NewNode->TotalCost)) {
-				NewNode->Next = Context->OpenList;
-				Context->OpenList = NewNode;
-			}
-			else {
-				RTPathFindingNodeRef TempNode = Context->OpenList;
-				while (TempNode->Next) {
-					if (TempNode->Next->TotalCost >= NewNode->TotalCost) {
-						NewNode->Next = TempNode->Next;
-						TempNode->Next = NewNode;
-						break;
-					}
+	Int32 PathIndex = Context->PathLength + Length - SkipCount - 1;
+	for (Int32 NodeIndex = EndIndex; NodeIndex >= 0 && PathIndex >= Context->PathLength; NodeIndex = Context->TileStates[NodeIndex].Parent) {
+		Context->PathX[PathIndex] = NodeIndex / RUNTIME_WORLD_SIZE;
+		Context->PathY[PathIndex] = NodeIndex % RUNTIME_WORLD_SIZE;
+		PathIndex -= 1;
+	}
+
+	Context->PathLength += Length - SkipCount;
+	return true;
+}
+
+RTPathFindingGraphRef RTPathFindingGraphCreate(
+	RTPathFindingContextRef Context,
+	RTWorldDataRef WorldData,
+	UInt32 CollisionMask
+) {
+	assert((CollisionMask & ~RUNTIME_PATH_FINDING_STATIC_TILE_MASK) == 0);
+
+	RTPathFindingGraphRef Graph = (RTPathFindingGraphRef)AllocatorAllocate(Context->Allocator, sizeof(struct _RTPathFindingGraph));
+	if (!Graph) Fatal("Memory allocation failed!");
+	memset(Graph, 0, sizeof(struct _RTPathFindingGraph));
 
-					TempNode = TempNode->Next;
+	Graph->Allocator = Context->Allocator;
+	Graph->CollisionMask = CollisionMask;
+	Graph->Nodes = ArrayCreateEmpty(Context->Allocator, sizeof(struct _RTPathFindingGraphNode), 256);
+	Graph->Edges = ArrayCreateEmpty(Context->Allocator, sizeof(struct _RTPathFindingGraphEdge), 1024);
+
+	Int32* TileToNode = (Int32*)AllocatorAllocate(Context->Allocator, sizeof(Int32) * RUNTIME_PATH_FINDING_TILE_COUNT);
+	if (!TileToNode) Fatal("Memory allocation failed!");
+	for (Int Index = 0; Index < RUNTIME_PATH_FINDING_TILE_COUNT; Index += 1) TileToNode[Index] = -1;
+
+	RTWorldTile* Tiles = WorldData->Tiles;
+
+	// NOTE: Each run of walkable tile pairs along a cluster border becomes an entrance,
+	//       short runs are represented by their center and long runs by both of their ends
+	for (Int32 Axis = 0; Axis < 2; Axis += 1) {
+		for (Int32 Border = RUNTIME_WORLD_CHUNK_SIZE - 1; Border < RUNTIME_WORLD_SIZE - 1; Border += RUNTIME_WORLD_CHUNK_SIZE) {
+			Int32 RunStart = -1;
+			for (Int32 Offset = 0; Offset <= RUNTIME_WORLD_SIZE; Offset += 1) {
+				Bool IsOpen = false;
+				Bool IsRunEnd = (Offset == RUNTIME_WORLD_SIZE) || (Offset % RUNTIME_WORLD_CHUNK_SIZE == 0);
+				if (Offset < RUNTIME_WORLD_SIZE) {
+					Int32 X = (Axis == 0) ? Border : Offset;
+					Int32 Y = (Axis == 0) ? Offset : Border;
+					Int32 NextX = (Axis == 0) ? X + 1 : X;
+					Int32 NextY = (Axis == 0) ? Y : Y + 1;
+					IsOpen = (
+						!RTPathFindingIsTileBlocked(Tiles, RTPathFindingGetTileIndex(X, Y), CollisionMask) &&
+						!RTPathFindingIsTileBlocked(Tiles, RTPathFindingGetTileIndex(NextX, NextY), CollisionMask)
+					);
 				}
 
-				if (!TempNode->Next) {
-					TempNode->Next = NewNode;
+				if (RunStart >= 0 && (!IsOpen || IsRunEnd)) {
+					Int32 RunLength = Offset - RunStart;
+					Int32 Entrances[2] = { RunStart + RunLength / 2, -1 };
+					if (RunLength > RUNTIME_PATH_FINDING_MAX_ENTRANCE_LENGTH) {
+						Entrances[0] = RunStart;
+						Entrances[1] = Offset - 1;
+					}
+
+					for (Int Index = 0; Index < 2; Index += 1) {
+						if (Entrances[Index] < 0) continue;
+
+						Int32 X = (Axis == 0) ? Border : Entrances[Index];
+						Int32 Y = (Axis == 0) ? Entrances[Index] : Border;
+						TileToNode[RTPathFindingGetTileIndex(X, Y)] = -2;
+						TileToNode[RTPathFindingGetTileIndex((Axis == 0) ? X + 1 : X, (Axis == 0) ? Y : Y + 1)] = -2;
+					}
+
+					RunStart = -1;
 				}
+
+				if (IsOpen && RunStart < 0) RunStart = Offset;
+			}
+		}
+	}
+
+	// NOTE: Nodes are stored grouped by their cluster to resolve the entrances of a cluster without a lookup
+	for (Int32 Cluster = 0; Cluster < RUNTIME_PATH_FINDING_CLUSTER_COUNT; Cluster += 1) {
+		RTPathFindingBounds Bounds = RTPathFindingGetClusterBounds(Cluster);
+		Graph->ClusterNodeIndex[Cluster] = (Int32)ArrayGetElementCount(Graph->Nodes);
+
+		for (Int32 X = Bounds.MinX; X <= Bounds.MaxX; X += 1) {
+			for (Int32 Y = Bounds.MinY; Y <= Bounds.MaxY; Y += 1) {
+				Int32 TileIndex = RTPathFindingGetTileIndex(X, Y);
+				if (TileToNode[TileIndex] != -2) continue;
+
+				TileToNode[TileIndex] = (Int32)ArrayGetElementCount(Graph->Nodes);
+
+				RTPathFindingGraphNodeRef Node = (RTPathFindingGraphNodeRef)ArrayAppendUninitializedElement(Graph->Nodes);
+				Node->X = X;
+				Node->Y = Y;
+				Node->Cluster = Cluster;
+				Node->EdgeIndex = 0;
+				Node->EdgeCount = 0;
+			}
+		}
+
+		Graph->ClusterNodeCount[Cluster] = (Int32)ArrayGetElementCount(Graph->Nodes) - Graph->ClusterNodeIndex[Cluster];
+	}
+
+	for (Int32 NodeIndex = 0; NodeIndex < ArrayGetElementCount(Graph->Nodes); NodeIndex += 1) {
+		RTPathFindingGraphNodeRef Node = (RTPathFindingGraphNodeRef)ArrayGetElementAtIndex(Graph->Nodes, NodeIndex);
+		Int32 EdgeIndex = (Int32)ArrayGetElementCount(Graph->Edges);
+
+		RTPathFindingSearchTiles(
+			Context,
+			Tiles,
+			RTPathFindingGetClusterBounds(Node->Cluster),
+			Node->X,
+			Node->Y,
+			-1,
+			-1,
+			CollisionMask,
+			INT32_MAX
+		);
+
+		Int32 ClusterNodeIndex = Graph->ClusterNodeIndex[Node->Cluster];
+		Int32 ClusterNodeCount = Graph->ClusterNodeCount[Node->Cluster];
+		for (Int32 TargetIndex = ClusterNodeIndex; TargetIndex < ClusterNodeIndex + ClusterNodeCount; TargetIndex += 1) {
+			if (TargetIndex == NodeIndex) continue;
+
+			RTPathFindingGraphNodeRef Target = (RTPathFindingGraphNodeRef)ArrayGetElementAtIndex(Graph->Nodes, TargetIndex);
+			Int32 TileIndex = RTPathFindingGetTileIndex(Target->X, Target->Y);
+			if (!RTPathFindingIsTileReached(Context, TileIndex)) continue;
+
+			RTPathFindingGraphEdgeRef Edge = (RTPathFindingGraphEdgeRef)ArrayAppendUninitializedElement(Graph->Edges);
+			Edge->Target = TargetIndex;
+			Edge->Cost = Context->TileStates[TileIndex].Cost;
+		}
+
+		for (Int Index = 0; Index < 4; Index += 1) {
+			Int32 X = Node->X + PathFindingOffsetX[Index];
+			Int32 Y = Node->Y + PathFindingOffsetY[Index];
+			if (X < 0 || X >= RUNTIME_WORLD_SIZE || Y < 0 || Y >= RUNTIME_WORLD_SIZE) continue;
+			if (RTPathFindingGetClusterIndex(X, Y) == Node->Cluster) continue;
+
+			Int32 TargetIndex = TileToNode[RTPathFindingGetTileIndex(X, Y)];
+			if (TargetIndex < 0) continue;
+
+			RTPathFindingGraphEdgeRef Edge = (RTPathFindingGraphEdgeRef)ArrayAppendUninitializedElement(Graph->Edges);
+			Edge->Target = TargetIndex;
+			Edge->Cost = RUNTIME_PATH_FINDING_STRAIGHT_COST;
+		}
+
+		Node = (RTPathFindingGraphNodeRef)ArrayGetElementAtIndex(Graph->Nodes, NodeIndex);
+		Node->EdgeIndex = EdgeIndex;
+		Node->EdgeCount = (Int32)ArrayGetElementCount(Graph->Edges) - EdgeIndex;
+	}
+
+	AllocatorDeallocate(Context->Allocator, TileToNode);
+
+	Trace(
+		"PathFinding graph for world (%d) created with %d nodes and %d edges",
+		(Int32)WorldData->WorldIndex,
+		(Int32)ArrayGetElementCount(Graph->Nodes),
+		(Int32)ArrayGetElementCount(Graph->Edges)
+	);
+
+	return Graph;
+}
+
+Void RTPathFindingGraphDestroy(
+	RTPathFindingGraphRef Graph
+) {
+	ArrayDestroy(Graph->Nodes);
+	ArrayDestroy(Graph->Edges);
+	AllocatorDeallocate(Graph->Allocator, Graph);
+}
+
+static RTPathFindingGraphRef RTPathFindingGetGraph(
+	RTPathFindingContextRef Context,
+	RTWorldContextRef World,
+	UInt32 CollisionMask
+) {
+	RTWorldDataRef WorldData = World->WorldData;
+	for (Int32 Index = 0; Index < WorldData->PathFindingGraphCount; Index += 1) {
+		if (WorldData->PathFindingGraphs[Index]->CollisionMask == CollisionMask) return WorldData->PathFindingGraphs[Index];
+	}
+
+	// NOTE: Graphs are built lazily per static collision mask, further masks fall back to the tile search
+	if (WorldData->PathFindingGraphCount >= RUNTIME_PATH_FINDING_MAX_GRAPH_COUNT) return NULL;
+
+	RTPathFindingGraphRef Graph = RTPathFindingGraphCreate(Context, WorldData, CollisionMask);
+	WorldData->PathFindingGraphs[WorldData->PathFindingGraphCount] = Graph;
+	WorldData->PathFindingGraphCount += 1;
+	return Graph;
+}
+
+static Bool RTPathFindingSearchGraph(
+	RTPathFindingContextRef Context,
+	RTPathFindingGraphRef Graph,
+	RTWorldTile* Tiles,
+	Int32 StartX,
+	Int32 StartY,
+	Int32 EndX,
+	Int32 EndY
+) {
+	Int32 NodeCount = (Int32)ArrayGetElementCount(Graph->Nodes);
+	Int32 GoalIndex = NodeCount;
+	Int32 StartCluster = RTPathFindingGetClusterIndex(StartX, StartY);
+	Int32 EndCluster = RTPathFindingGetClusterIndex(EndX, EndY);
+	if (Graph->ClusterNodeCount[StartCluster] < 1 || Graph->ClusterNodeCount[EndCluster] < 1) return false;
+
+	RTPathFindingReserveGraphCapacity(Context, NodeCount + 1);
+
+	UInt32 Generation = RTPathFindingNextGraphGeneration(Context);
+	RTPathFindingNodeStateRef States = Context->GraphStates;
+	RTPathFindingHeapRef Heap = &Context->GraphHeap;
+
+	RTPathFindingSearchTiles(Context, Tiles, RTPathFindingGetClusterBounds(StartCluster), StartX, StartY, -1, -1, Graph->CollisionMask, INT32_MAX);
+	for (Int32 NodeIndex = Graph->ClusterNodeIndex[StartCluster]; NodeIndex < Graph->ClusterNodeIndex[StartCluster] + Graph->ClusterNodeCount[StartCluster]; NodeIndex += 1) {
+		RTPathFindingGraphNodeRef Node = (RTPathFindingGraphNodeRef)ArrayGetElementAtIndex(Graph->Nodes, NodeIndex);
+		Int32 TileIndex = RTPathFindingGetTileIndex(Node->X, Node->Y);
+		if (!RTPathFindingIsTileReached(Context, TileIndex)) continue;
+
+		Int32 Heuristic = RTPathFindingHeuristic(Node->X, Node->Y, EndX, EndY);
+		States[NodeIndex].Generation = Generation;
+		States[NodeIndex].Cost = Context->TileStates[TileIndex].Cost;
+		States[NodeIndex].Parent = -1;
+		RTPathFindingHeapPush(Heap, States, NodeIndex, States[NodeIndex].Cost + Heuristic, Heuristic);
+	}
+
+	// NOTE: Movement costs are symmetric so flooding from the end position yields the costs towards it
+	RTPathFindingSearchTiles(Context, Tiles, RTPathFindingGetClusterBounds(EndCluster), EndX, EndY, -1, -1, Graph->CollisionMask, INT32_MAX);
+	for (Int32 NodeIndex = Graph->ClusterNodeIndex[EndCluster]; NodeIndex < Graph->ClusterNodeIndex[EndCluster] + Graph->ClusterNodeCount[EndCluster]; NodeIndex += 1) {
+		RTPathFindingGraphNodeRef Node = (RTPathFindingGraphNodeRef)ArrayGetElementAtIndex(Graph->Nodes, NodeIndex);
+		Int32 TileIndex = RTPathFindingGetTileIndex(Node->X, Node->Y);
+		Context->GraphTargetCosts[NodeIndex] = RTPathFindingIsTileReached(Context, TileIndex) ? Context->TileStates[TileIndex].Cost : -1;
+	}
+
+	Bool IsGoalReached = false;
+	while (Heap->Count > 0) {
+		Int32 NodeIndex = RTPathFindingHeapPop(Heap, States);
+		if (NodeIndex == GoalIndex) {
+			IsGoalReached = true;
+			break;
+		}
+
+		RTPathFindingGraphNodeRef Node = (RTPathFindingGraphNodeRef)ArrayGetElementAtIndex(Graph->Nodes, NodeIndex);
+		Int32 NodeCost = States[NodeIndex].Cost;
+
+		if (Node->Cluster == EndCluster && Context->GraphTargetCosts[NodeIndex] >= 0) {
+			Int32 Cost = NodeCost + Context->GraphTargetCosts[NodeIndex];
+			if (States[GoalIndex].Generation != Generation) {
+				States[GoalIndex].Generation = Generation;
+				States[GoalIndex].Cost = Cost;
+				States[GoalIndex].Parent = NodeIndex;
+				RTPathFindingHeapPush(Heap, States, GoalIndex, Cost, 0);
+			}
+			else if (States[GoalIndex].HeapIndex >= 0 && Cost < States[GoalIndex].Cost) {
+				States[GoalIndex].Cost = Cost;
+				States[GoalIndex].Parent = NodeIndex;
+				RTPathFindingHeapDecrease(Heap, States, GoalIndex, Cost);
 			}
 		}
+
+		for (Int32 EdgeIndex = Node->EdgeIndex; EdgeIndex < Node->EdgeIndex + Node->EdgeCount; EdgeIndex += 1) {
+			RTPathFindingGraphEdgeRef Edge = (RTPathFindingGraphEdgeRef)ArrayGetElementAtIndex(Graph->Edges, EdgeIndex);
+			RTPathFindingNodeStateRef State = &States[Edge->Target];
+			Int32 Cost = NodeCost + Edge->Cost;
+
+			if (State->Generation != Generation) {
+				RTPathFindingGraphNodeRef Target = (RTPathFindingGraphNodeRef)ArrayGetElementAtIndex(Graph->Nodes, Edge->Target);
+				Int32 Heuristic = RTPathFindingHeuristic(Target->X, Target->Y, EndX, EndY);
+				State->Generation = Generation;
+				State->Cost = Cost;
+				State->Parent = NodeIndex;
+				RTPathFindingHeapPush(Heap, States, Edge->Target, Cost + Heuristic, Heuristic);
+			}
+			else if (State->HeapIndex >= 0 && Cost < State->Cost) {
+				Int32 Heuristic = Heap->Nodes[State->HeapIndex].Heuristic;
+				State->Cost = Cost;
+				State->Parent = NodeIndex;
+				RTPathFindingHeapDecrease(Heap, States, Edge->Target, Cost + Heuristic);
+			}
+		}
+	}
+
+	if (!IsGoalReached) return false;
+
+	Int32 GraphPathLength = 0;
+	for (Int32 NodeIndex = States[GoalIndex].Parent; NodeIndex >= 0; NodeIndex = States[NodeIndex].Parent) {
+		Context->GraphPath[GraphPathLength] = NodeIndex;
+		GraphPathLength += 1;
+	}
+
+	// NOTE: Refine the abstract path by searching the tiles between each pair of consecutive nodes inside their clusters
+	Context->PathLength = 0;
+	Int32 SegmentStartX = StartX;
+	Int32 SegmentStartY = StartY;
+	for (Int32 PathIndex = GraphPathLength; PathIndex >= 0; PathIndex -= 1) {
+		Int32 SegmentEndX = EndX;
+		Int32 SegmentEndY = EndY;
+		if (PathIndex > 0) {
+			RTPathFindingGraphNodeRef Node = (RTPathFindingGraphNodeRef)ArrayGetElementAtIndex(Graph->Nodes, Context->GraphPath[PathIndex - 1]);
+			SegmentEndX = Node->X;
+			SegmentEndY = Node->Y;
+		}
+
+		RTPathFindingBounds Bounds = RTPathFindingGetClusterBounds(RTPathFindingGetClusterIndex(SegmentStartX, SegmentStartY));
+		RTPathFindingBounds EndBounds = RTPathFindingGetClusterBounds(RTPathFindingGetClusterIndex(SegmentEndX, SegmentEndY));
+		Bounds.MinX = MIN(Bounds.MinX, EndBounds.MinX);
+		Bounds.MinY = MIN(Bounds.MinY, EndBounds.MinY);
+		Bounds.MaxX = MAX(Bounds.MaxX, EndBounds.MaxX);
+		Bounds.MaxY = MAX(Bounds.MaxY, EndBounds.MaxY);
+
+		Bool IsSegmentFound = RTPathFindingSearchTiles(
+			Context,
+			Tiles,
+			Bounds,
+			SegmentStartX,
+			SegmentStartY,
+			SegmentEndX,
+			SegmentEndY,
+			Graph->CollisionMask,
+			INT32_MAX
+		);
+		if (!IsSegmentFound) return false;
+		if (!RTPathFindingAppendPath(Context, RTPathFindingGetTileIndex(SegmentEndX, SegmentEndY))) return false;
+
+		SegmentStartX = SegmentEndX;
+		SegmentStartY = SegmentEndY;
+	}
+
+	return true;
+}
+
+RTPathFindingCacheRef RTPathFindingCacheCreate(
+	AllocatorRef Allocator
+) {
+	RTPathFindingCacheRef Cache = (RTPathFindingCacheRef)AllocatorAllocate(Allocator, sizeof(struct _RTPathFindingCache));
+	if (!Cache) Fatal("Memory allocation failed!");
+
+	Cache->Allocator = Allocator;
+	RTPathFindingCacheClear(Cache);
+	return Cache;
+}
+
+Void RTPathFindingCacheDestroy(
+	RTPathFindingCacheRef Cache
+) {
+	AllocatorDeallocate(Cache->Allocator, Cache);
+}
+
+Void RTPathFindingCacheClear(
+	RTPathFindingCacheRef Cache
+) {
+	Cache->Count = 0;
+	Cache->Head = -1;
+	Cache->Tail = -1;
+	for (Int Index = 0; Index < RUNTIME_PATH_FINDING_CACHE_BUCKET_COUNT; Index += 1) {
+		Cache->Buckets[Index] = -1;
+	}
+}
+
+static inline Int32 RTPathFindingCacheGetBucket(
+	UInt64 Key
+) {
+	return (Int32)((Key * 0x9E3779B97F4A7C15ULL) >> 32) % RUNTIME_PATH_FINDING_CACHE_BUCKET_COUNT;
+}
+
+static Void RTPathFindingCacheUnlink(
+	RTPathFindingCacheRef Cache,
+	Int32 EntryIndex
+) {
+	RTPathFindingCacheEntryRef Entry = &Cache->Entries[EntryIndex];
+	if (Entry->Previous >= 0) Cache->Entries[Entry->Previous].Next = Entry->Next;
+	else Cache->Head = Entry->Next;
+
+	if (Entry->Next >= 0) Cache->Entries[Entry->Next].Previous = Entry->Previous;
+	else Cache->Tail = Entry->Previous;
+}
+
+static Void RTPathFindingCacheLinkHead(
+	RTPathFindingCacheRef Cache,
+	Int32 EntryIndex
+) {
+	RTPathFindingCacheEntryRef Entry = &Cache->Entries[EntryIndex];
+	Entry->Previous = -1;
+	Entry->Next = Cache->Head;
+	if (Cache->Head >= 0) Cache->Entries[Cache->Head].Previous = EntryIndex;
+	Cache->Head = EntryIndex;
+	if (Cache->Tail < 0) Cache->Tail = EntryIndex;
+}
+
+static RTPathFindingCacheEntryRef RTPathFindingCacheLookup(
+	RTPathFindingCacheRef Cache,
+	UInt64 Key
+) {
+	Int32 EntryIndex = Cache->Buckets[RTPathFindingCacheGetBucket(Key)];
+	while (EntryIndex >= 0) {
+		RTPathFindingCacheEntryRef Entry = &Cache->Entries[EntryIndex];
+		if (Entry->Key == Key) {
+			RTPathFindingCacheUnlink(Cache, EntryIndex);
+			RTPathFindingCacheLinkHead(Cache, EntryIndex);
+			return Entry;
+		}
+
+		EntryIndex = Entry->BucketNext;
 	}
 
 	return NULL;
 }
 
+static RTPathFindingCacheEntryRef RTPathFindingCacheInsert(
+	RTPathFindingCacheRef Cache,
+	UInt64 Key
+) {
+	Int32 EntryIndex = Cache->Count;
+	if (Cache->Count < RUNTIME_PATH_FINDING_CACHE_SIZE) {
+		Cache->Count += 1;
+	}
+	else {
+		EntryIndex = Cache->Tail;
+		RTPathFindingCacheUnlink(Cache, EntryIndex);
+
+		Int32* Link = &Cache->Buckets[RTPathFindingCacheGetBucket(Cache->Entries[EntryIndex].Key)];
+		while (*Link != EntryIndex) {
+			Link = &Cache->Entries[*Link].BucketNext;
+		}
+		*Link = Cache->Entries[EntryIndex].BucketNext;
+	}
+
+	RTPathFindingCacheEntryRef Entry = &Cache->Entries[EntryIndex];
+	Int32 Bucket = RTPathFindingCacheGetBucket(Key);
+	Entry->Key = Key;
+	Entry->BucketNext = Cache->Buckets[Bucket];
+	Cache->Buckets[Bucket] = EntryIndex;
+	RTPathFindingCacheLinkHead(Cache, EntryIndex);
+	return Entry;
+}
+
 Int32 RTPathFindLastVisibleNodeIndex(
+	RTPathFindingContextRef Context,
 	RTRuntimeRef Runtime,
 	RTWorldContextRef World,
 	Int32 PathIndex,
 	UInt32 CollisionMask,
 	UInt32 IgnoreMask
 ) {
-	struct _RTPathFindingContext* Context = &PathFindingContext;
-
 	Int32 PathIndexA = PathIndex + 1;
-	Int32 PathIndexB = Context->PathLengthPrevious - 1;
+	Int32 PathIndexB = Context->PathLength - 1;
 	Bool HasCollision = !RTWorldTraceMovement(
 		Runtime,
 		World,
@@ -194,89 +925,93 @@ Int32 RTPathFindLastVisibleNodeIndex(
 	return PathIndexA;
 }
 
-Bool RTMovementFindPath(
+static Bool RTPathFindingFindPathUncached(
+	RTPathFindingContextRef Context,
 	RTRuntimeRef Runtime,
 	RTWorldContextRef World,
-	RTMovementRef Movement
+	RTMovementRef Movement,
+	Bool IsStatic
 ) {
-	struct _RTPathFindingContext* Context = &PathFindingContext;
+	Int32 StartX = Movement->PositionBegin.X;
+	Int32 StartY = Movement->PositionBegin.Y;
+	Int32 EndX = Movement->PositionEnd.X;
+	Int32 EndY = Movement->PositionEnd.Y;
+	Bool IsPathFound = false;
 
-	if (Movement->PositionBegin.X == Movement->PositionEnd.X &&
-		Movement->PositionBegin.Y == Movement->PositionEnd.Y) {
+	if (StartX < 0 || StartX >= RUNTIME_WORLD_SIZE || StartY < 0 || StartY >= RUNTIME_WORLD_SIZE ||
+		EndX < 0 || EndX >= RUNTIME_WORLD_SIZE || EndY < 0 || EndY >= RUNTIME_WORLD_SIZE) {
+		Movement->WaypointCount = 0;
 		return false;
 	}
-	
+
+	Int32 Distance = MAX(ABS(EndX - StartX), ABS(EndY - StartY));
+	Bool IsClusterCrossing = RTPathFindingGetClusterIndex(StartX, StartY) != RTPathFindingGetClusterIndex(EndX, EndY);
+	if (IsStatic && Runtime->Config.IsPathFindingGraphEnabled && IsClusterCrossing && Distance >= RUNTIME_PATH_FINDING_GRAPH_MIN_DISTANCE) {
+		RTPathFindingGraphRef Graph = RTPathFindingGetGraph(Context, World, Movement->CollisionMask);
+		if (Graph) IsPathFound = RTPathFindingSearchGraph(Context, Graph, World->Tiles, StartX, StartY, EndX, EndY);
+	}
+
+	if (!IsPathFound) {
+		Context->PathLength = 0;
+		IsPathFound = RTPathFindingSearchTiles(
+			Context,
+			World->Tiles,
+			RTPathFindingGetWorldBounds(),
+			StartX,
+			StartY,
+			EndX,
+			EndY,
+			Movement->CollisionMask,
+			RUNTIME_MOVEMENT_MAX_PATH_FIND_NODE_COUNT
+		) && RTPathFindingAppendPath(Context, RTPathFindingGetTileIndex(EndX, EndY));
+	}
+
 	Int32 WaypointIndex = 0;
 	RTPositionRef Waypoint = &Movement->Waypoints[WaypointIndex];
-	RTPathFindingNodeRef Node = RTPathFindingAStar(
-		Runtime,
-		World,
-		Movement->PositionBegin.X,
-		Movement->PositionBegin.Y,
-		Movement->PositionEnd.X,
-		Movement->PositionEnd.Y,
-		Movement->CollisionMask,
-		Movement->IgnoreMask
-	);
 
-	if (!Node) {
-		Int32 EndX = 0;
-		Int32 EndY = 0;
+	if (!IsPathFound) {
+		Int32 TraceEndX = 0;
+		Int32 TraceEndY = 0;
 		RTWorldTraceMovement(
 			Runtime,
 			World,
-			Context->Nodes[0].X,
-			Context->Nodes[0].Y,
-			Context->TargetX,
-			Context->TargetY,
-			&EndX,
-			&EndY,
+			StartX,
+			StartY,
+			EndX,
+			EndY,
+			&TraceEndX,
+			&TraceEndY,
 			Movement->CollisionMask,
 			Movement->IgnoreMask
 		);
 
-		if (EndX == Context->Nodes[0].X && EndY == Context->Nodes[0].Y) {
+		if (TraceEndX == StartX && TraceEndY == StartY) {
 			Movement->WaypointCount = 0;
 		}
 		else {
-			Waypoint->X = Movement->PositionBegin.X;
-			Waypoint->Y = Movement->PositionBegin.Y;
+			Waypoint->X = StartX;
+			Waypoint->Y = StartY;
 			WaypointIndex += 1;
 			Waypoint = &Movement->Waypoints[WaypointIndex];
 
-			Waypoint->X = EndX;
-			Waypoint->Y = EndY;
+			Waypoint->X = TraceEndX;
+			Waypoint->Y = TraceEndY;
 			Movement->WaypointCount = 2;
 		}
 
 		return false;
 	}
 
-	RTPathFindingNodeRef TempNode = Node;
-	Int32 PathIndex = 0;
-	while (TempNode) {
-		TempNode = TempNode->Parent;
-		PathIndex += 1;
-	}
-
-	Context->PathLengthPrevious = 0;
-	while (Node) {
-		Context->PathX[PathIndex - 1 - Context->PathLengthPrevious] = Node->X;
-		Context->PathY[PathIndex - 1 - Context->PathLengthPrevious] = Node->Y;
-		Context->PathLengthPrevious += 1;
-
-		Node = Node->Parent;
-	}
-
-	Waypoint->X = Context->Nodes[0].X;
-	Waypoint->Y = Context->Nodes[0].Y;
+	Waypoint->X = StartX;
+	Waypoint->Y = StartY;
 	WaypointIndex += 1;
 	Waypoint = &Movement->Waypoints[WaypointIndex];
 
-	Context->PathLength = 1;
-	PathIndex = 0;
-	while (PathIndex != Context->PathLengthPrevious - 1) {
+	Int32 WaypointCount = 1;
+	Int32 PathIndex = 0;
+	while (PathIndex != Context->PathLength - 1) {
 		PathIndex = RTPathFindLastVisibleNodeIndex(
+			Context,
 			Runtime,
 			World,
 			PathIndex,
@@ -288,13 +1023,64 @@ Bool RTMovementFindPath(
 		WaypointIndex += 1;
 		Waypoint = &Movement->Waypoints[WaypointIndex];
 
-		Context->PathLength += 1;
-		if (Context->PathLength >= RUNTIME_MOVEMENT_MAX_WAYPOINT_COUNT) {
+		WaypointCount += 1;
+		if (WaypointCount >= RUNTIME_MOVEMENT_MAX_WAYPOINT_COUNT) {
 			Movement->WaypointCount = 2;
 			return false;
 		}
 	}
 
-	Movement->WaypointCount = Context->PathLength;
+	Movement->WaypointCount = WaypointCount;
 	return true;
 }
+
+Bool RTPathFindingFindPath(
+	RTPathFindingContextRef Context,
+	RTRuntimeRef Runtime,
+	RTWorldContextRef World,
+	RTMovementRef Movement
+) {
+	if (Movement->PositionBegin.X == Movement->PositionEnd.X &&
+		Movement->PositionBegin.Y == Movement->PositionEnd.Y) {
+		return false;
+	}
+
+	Bool IsStatic = ((Movement->CollisionMask | Movement->IgnoreMask) & ~RUNTIME_PATH_FINDING_STATIC_TILE_MASK) == 0;
+	RTPathFindingCacheRef Cache = IsStatic ? World->PathFindingCache : NULL;
+	UInt64 Key = 0;
+
+	if (Cache) {
+		Key = (
+			((UInt64)(UInt16)RTPathFindingGetTileIndex(Movement->PositionBegin.X, Movement->PositionBegin.Y) << 48) |
+			((UInt64)(UInt16)RTPathFindingGetTileIndex(Movement->PositionEnd.X, Movement->PositionEnd.Y) << 32) |
+			((UInt64)(Movement->CollisionMask & RUNTIME_PATH_FINDING_STATIC_TILE_MASK) << 8) |
+			((UInt64)(Movement->IgnoreMask & RUNTIME_PATH_FINDING_STATIC_TILE_MASK))
+		);
+
+		RTPathFindingCacheEntryRef Entry = RTPathFindingCacheLookup(Cache, Key);
+		if (Entry) {
+			Movement->WaypointCount = Entry->WaypointCount;
+			memcpy(Movement->Waypoints, Entry->Waypoints, sizeof(RTPosition) * Entry->WaypointCount);
+			return Entry->IsPathFound;
+		}
+	}
+
+	Bool IsPathFound = RTPathFindingFindPathUncached(Context, Runtime, World, Movement, IsStatic);
+
+	if (Cache) {
+		RTPathFindingCacheEntryRef Entry = RTPathFindingCacheInsert(Cache, Key);
+		Entry->IsPathFound = IsPathFound;
+		Entry->WaypointCount = Movement->WaypointCount;
+		memcpy(Entry->Waypoints, Movement->Waypoints, sizeof(RTPosition) * Movement->WaypointCount);
+	}
+
+	return IsPathFound;
+}
+
+Bool RTMovementFindPath(
+	RTRuntimeRef Runtime,
+	RTWorldContextRef World,
+	RTMovementRef Movement
+) {
+	return RTPathFindingFindPath(World->WorldManager->PathFindingContext, Runtime, World, Movement);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Base.h"
+#include "Constants.h"
+
+EXTERN_C_BEGIN
+
+// NOTE: Only the static bits of a tile (wall, safe zone, town, ...) can be used for cached paths and the cluster graph,
+//       character and mob counts are changing every tick and always require a fresh search.
+#define RUNTIME_PATH_FINDING_STATIC_TILE_MASK 0x000000FF
+
+RTPathFindingContextRef RTPathFindingContextCreate(
+    AllocatorRef Allocator
+);
+
+Void RTPathFindingContextDestroy(
+    RTPathFindingContextRef Context
+);
+
+RTPathFindingGraphRef RTPathFindingGraphCreate(
+    RTPathFindingContextRef Context,
+    RTWorldDataRef WorldData,
+    UInt32 CollisionMask
+);
+
+Void RTPathFindingGraphDestroy(
+    RTPathFindingGraphRef Graph
+);
+
+RTPathFindingCacheRef RTPathFindingCacheCreate(
+    AllocatorRef Allocator
+);
+
+Void RTPathFindingCacheDestroy(
+    RTPathFindingCacheRef Cache
+);
+
+Void RTPathFindingCacheClear(
+    RTPathFindingCacheRef Cache
+);
+
+Bool RTPathFindingFindPath(
+    RTPathFindingContextRef Context,
+    RTRuntimeRef Runtime,
+    RTWorldContextRef World,
+    RTMovementRef Movement
+);
+
+EXTERN_C_END
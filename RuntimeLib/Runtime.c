@@ -21,12 +21,7 @@ RTRuntimeRef RTRuntimeCreate(
     if (!Runtime) Fatal("Memory allocation failed!");
     memset(Runtime, 0, sizeof(struct _RTRuntime));
 
-    for (Int X = 0; X < RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH; X++) {
-        for (Int Y = 0; Y < RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH; Y++) {
-            Int Index = X + Y * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH;
-            Runtime->MovementDistanceCache[Index] = (Float32)sqrt((Float64)X * (Float64)X + (Float64)Y * (Float64)Y);
-        }
-    }
+    RTMovementInitializeDistanceTable();
 
     Runtime->Environment.RawValue = 0;
     Runtime->Context = NULL;
@@ -39,6 +34,8 @@ RTRuntimeRef RTRuntimeCreate(
         RUNTIME_MEMORY_MAX_PARTY_WORLD_CONTEXT_COUNT,
         RUNTIME_MEMORY_MAX_CHARACTER_COUNT
     );
+    Runtime->TimerWheel = TimerWheelCreate(Allocator, RUNTIME_TIMER_WHEEL_RESOLUTION, GetTimestampMs(), RUNTIME_MEMORY_MAX_CHARACTER_COUNT * 2);
+    Runtime->CharacterSyncQueue = ArrayCreateEmpty(Allocator, sizeof(UInt32), RUNTIME_MEMORY_MAX_CHARACTER_COUNT);
     Runtime->NotificationManager = RTNotificationManagerCreate(Runtime);
     Runtime->OptionPoolManager = RTOptionPoolManagerCreate(Runtime->Allocator);
     Runtime->DropTable.WorldDropPool = ArrayCreateEmpty(Runtime->Allocator, sizeof(struct _RTDropItem), 8);
@@ -94,6 +91,7 @@ Void RTRuntimeDestroy(
         DictionaryDestroy(DungeonData->TimeControls);
         DictionaryDestroy(DungeonData->ImmuneControls);
         DictionaryDestroy(DungeonData->GateControls);
+        RTDropTableDestroyAliasPools(Runtime, &DungeonData->DropTable);
         ArrayDestroy(DungeonData->DropTable.WorldDropPool);
 
         Iterator = DictionaryKeyIteratorNext(Iterator);
@@ -131,6 +129,7 @@ Void RTRuntimeDestroy(
     MemoryPoolDestroy(Runtime->ForceEffectFormulaPool);
     MemoryPoolDestroy(Runtime->MobPatrolDataPool);
     MemoryPoolDestroy(Runtime->MobPatternDataPool);
+    RTDropTableDestroyAliasPools(Runtime, &Runtime->DropTable);
     ArrayDestroy(Runtime->DropTable.WorldDropPool);
     DictionaryDestroy(Runtime->DropTable.MobDropPool);
     DictionaryDestroy(Runtime->DropTable.QuestDropPool);
@@ -139,6 +138,8 @@ Void RTRuntimeDestroy(
     RTScriptManagerDestroy(Runtime->ScriptManager);
     if (Runtime->Context) RTRuntimeDataContextDestroy(Runtime->Context);
     RTWorldManagerDestroy(Runtime->WorldManager);
+    TimerWheelDestroy(Runtime->TimerWheel);
+    ArrayDestroy(Runtime->CharacterSyncQueue);
     AllocatorDeallocate(Runtime->Allocator, Runtime);
 }
 
@@ -157,12 +158,15 @@ Bool RTRuntimeLoadData(
 Void RTRuntimeUpdate(
     RTRuntimeRef Runtime
 ) {
+    RTNotificationManagerBeginBatch(Runtime->NotificationManager);
     RTWorldManagerUpdate(Runtime->WorldManager);
 
     if (Runtime->Environment.IsRaidBossEnabled) {
 
     }
 
+    RTNotificationManagerFlush(Runtime->NotificationManager);
+
     /* Movement Debugging
     for (Int Index = 0; Index < Runtime->Characters.Count; Index++) {
         RTCharacterRef Character = (RTCharacterRef)ArrayGetElementAtIndex(&Runtime->Characters, Index);
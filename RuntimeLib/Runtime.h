@@ -41,10 +41,16 @@ typedef union _RTRuntimeEnvironment RTRuntimeEnvironment;
 struct _RTRuntimeConfig {
     Bool IsSkillRankUpLimitEnabled;
     UInt64 WorldItemDespawnInterval;
+    Bool IsPathFindingGraphEnabled;
     Int32 NewbieSupportTimeout;
     Int64 MaxHonorPoint;
     Int64 MinHonorPoint;
     CString ScriptFilePath;
+    Timestamp CharacterUpdateInterval;
+    Timestamp MobUpdateInterval;
+    Timestamp ItemUpdateInterval;
+    Timestamp DungeonUpdateInterval;
+    Timestamp CharacterSyncInterval;
 };
 
 struct _RTRuntime {
@@ -57,6 +63,8 @@ struct _RTRuntime {
     RTWorldManagerRef WorldManager;
     RTNotificationManagerRef NotificationManager;
     RTOptionPoolManagerRef OptionPoolManager;
+    TimerWheelRef TimerWheel;
+    ArrayRef CharacterSyncQueue;
     Int32 SlopeFormulaDataCount;
     Int32 ItemDataCount;
     Int32 MobDataCount;
@@ -80,7 +88,6 @@ struct _RTRuntime {
     struct _RTTrainerData TrainerData[RUNTIME_MEMORY_MAX_TRAINER_DATA_COUNT];
     struct _RTWarp Warps[RUNTIME_MEMORY_MAX_WARP_COUNT];
     struct _RTDropTable DropTable;
-    Float32 MovementDistanceCache[RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH * RUNTIME_MOVEMENT_MAX_DISTANCE_LENGTH];
     MemoryPoolRef SkillDataPool;
     MemoryPoolRef ForceEffectFormulaPool;
     MemoryPoolRef MobPatrolDataPool;
@@ -34,6 +34,7 @@
 #include <RuntimeLib/OverlordMastery.h>
 #include <RuntimeLib/Party.h>
 #include <RuntimeLib/PartyManager.h>
+#include <RuntimeLib/PathFinding.h>
 #include <RuntimeLib/Quest.h>
 #include <RuntimeLib/Quickslot.h>
 #include <RuntimeLib/Recovery.h>
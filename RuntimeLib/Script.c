@@ -16,6 +16,16 @@ struct _RTScript {
     Char FilePath[MAX_PATH];
     FileEventRef FileEvent;
     lua_State* State;
+    UInt32 EventMask;
+    Int32 EventReferences[RUNTIME_SCRIPT_EVENT_COUNT];
+};
+
+static const CString kScriptEventNames[RUNTIME_SCRIPT_EVENT_COUNT] = {
+    "OnEvent",
+    "on_spawn",
+    "on_despawn",
+    "on_update",
+    "on_damage",
 };
 
 struct _RTScriptManager {
@@ -41,6 +51,24 @@ static Int32 SCRIPT_PROC_ ## __TYPE__ ## _ ## __NAME__ (lua_State* State) {
 }
 #include "MobAPI.h"
 
+Void RTScriptResolveEvents(
+    RTScriptRef Script
+) {
+    Script->EventMask = 0;
+
+    for (Int Index = 0; Index < RUNTIME_SCRIPT_EVENT_COUNT; Index += 1) {
+        Script->EventReferences[Index] = LUA_NOREF;
+
+        if (lua_getglobal(Script->State, kScriptEventNames[Index]) != LUA_TFUNCTION) {
+            lua_pop(Script->State, 1);
+            continue;
+        }
+
+        Script->EventReferences[Index] = luaL_ref(Script->State, LUA_REGISTRYINDEX);
+        Script->EventMask |= (1 << Index);
+    }
+}
+
 Void RTScriptBindMobAPI(
     RTScriptRef Script
 ) {
@@ -127,6 +155,8 @@ Void _OnScriptFileChanged(
         Script->State = OldState;
         return;
     }
+
+    RTScriptResolveEvents(Script);
 }
 
 RTScriptRef RTScriptManagerLoadScript(
@@ -166,6 +196,8 @@ RTScriptRef RTScriptManagerLoadScript(
     if (luaL_loadfile(Script->State, FilePath) != LUA_OK) Fatal("Lua: %s", lua_tostring(Script->State, -1));
     if (lua_pcall(Script->State, 0, 0, 0) != LUA_OK) Fatal("Lua: %s", lua_tostring(Script->State, -1));
 
+    RTScriptResolveEvents(Script);
+
     Script->FileEvent = FileEventCreate(Script->FilePath, _OnScriptFileChanged, Script);
 
     return Script;
@@ -285,12 +317,68 @@ Bool RTScriptCall(
     return true;
 }
 
+Bool RTScriptHasEvent(
+    RTScriptRef Script,
+    Int32 Event
+) {
+    assert(0 <= Event && Event < RUNTIME_SCRIPT_EVENT_COUNT);
+    return (Script->EventMask & (1 << Event)) != 0;
+}
+
+static Bool RTScriptCallEventReference(
+    RTScriptRef Script,
+    Int32 ArgumentCount
+) {
+    if (lua_pcall(Script->State, ArgumentCount, 0, 0) != LUA_OK) {
+        Error("Lua: %s", lua_tostring(Script->State, -1));
+        lua_pop(Script->State, 1);
+        return false;
+    }
+
+    return true;
+}
+
+Bool RTScriptCallMobEvent(
+    RTScriptRef Script,
+    Int32 Event,
+    RTRuntimeRef Runtime,
+    RTWorldContextRef WorldContext,
+    RTMobRef Mob
+) {
+    if (!RTScriptHasEvent(Script, Event)) return false;
+
+    lua_rawgeti(Script->State, LUA_REGISTRYINDEX, Script->EventReferences[Event]);
+    lua_pushlightuserdata(Script->State, Runtime);
+    lua_pushlightuserdata(Script->State, WorldContext);
+    lua_pushlightuserdata(Script->State, Mob);
+    return RTScriptCallEventReference(Script, 3);
+}
+
+Bool RTScriptCallMobDamageEvent(
+    RTScriptRef Script,
+    RTRuntimeRef Runtime,
+    RTWorldContextRef WorldContext,
+    RTMobRef Mob,
+    Int64 Damage
+) {
+    if (!RTScriptHasEvent(Script, RUNTIME_SCRIPT_EVENT_MOB_DAMAGE)) return false;
+
+    lua_rawgeti(Script->State, LUA_REGISTRYINDEX, Script->EventReferences[RUNTIME_SCRIPT_EVENT_MOB_DAMAGE]);
+    lua_pushlightuserdata(Script->State, Runtime);
+    lua_pushlightuserdata(Script->State, WorldContext);
+    lua_pushlightuserdata(Script->State, Mob);
+    lua_pushnumber(Script->State, (lua_Number)Damage);
+    return RTScriptCallEventReference(Script, 4);
+}
+
 Bool RTScriptCallOnEvent(
     RTScriptRef Script,
     RTRuntimeRef Runtime,
     RTCharacterRef Character
 ) {
-    lua_getglobal(Script->State, "OnEvent");
+    if (!RTScriptHasEvent(Script, RUNTIME_SCRIPT_EVENT_ON_EVENT)) return false;
+
+    lua_rawgeti(Script->State, LUA_REGISTRYINDEX, Script->EventReferences[RUNTIME_SCRIPT_EVENT_ON_EVENT]);
 
     RTScriptPushObject(Script, "Character", Runtime, Character);
 
@@ -8,6 +8,16 @@
 
 EXTERN_C_BEGIN
 
+enum {
+    RUNTIME_SCRIPT_EVENT_ON_EVENT,
+    RUNTIME_SCRIPT_EVENT_MOB_SPAWN,
+    RUNTIME_SCRIPT_EVENT_MOB_DESPAWN,
+    RUNTIME_SCRIPT_EVENT_MOB_UPDATE,
+    RUNTIME_SCRIPT_EVENT_MOB_DAMAGE,
+
+    RUNTIME_SCRIPT_EVENT_COUNT
+};
+
 RTScriptManagerRef RTScriptManagerCreate(
     RTRuntimeRef Runtime,
     Int MaxScriptCount
@@ -50,6 +60,27 @@ Bool RTScriptCall(
     ...
 );
 
+Bool RTScriptHasEvent(
+    RTScriptRef Script,
+    Int32 Event
+);
+
+Bool RTScriptCallMobEvent(
+    RTScriptRef Script,
+    Int32 Event,
+    RTRuntimeRef Runtime,
+    RTWorldContextRef WorldContext,
+    RTMobRef Mob
+);
+
+Bool RTScriptCallMobDamageEvent(
+    RTScriptRef Script,
+    RTRuntimeRef Runtime,
+    RTWorldContextRef WorldContext,
+    RTMobRef Mob,
+    Int64 Damage
+);
+
 Bool RTScriptCallOnEvent(
     RTScriptRef Script,
     RTRuntimeRef Runtime,
@@ -57,7 +57,7 @@ RTSkillSlotRef RTCharacterAddSkillSlot(
 	Character->SyncMask.SkillSlotInfo = true;
 
 	if (SkillData->SkillGroup == RUNTIME_SKILL_GROUP_PASSIVE) {
-		RTCharacterInitializeAttributes(Runtime, Character);
+		RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_SKILL) | RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BATTLE_MODE));
 	}
 
 	return SkillSlot;
@@ -110,7 +110,7 @@ Void RTCharacterRemoveSkillSlot(
 
 			Character->Data.SkillSlotInfo.Info.SlotCount -= 1;
 			Character->SyncMask.SkillSlotInfo = true;
-			RTCharacterInitializeAttributes(Runtime, Character);
+			RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_SKILL) | RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BATTLE_MODE));
 		}
 	}
 }
@@ -168,7 +168,7 @@ Bool RTCharacterChangeSkillLevel(
 
 	Character->SyncMask.Info = true;
 	Character->SyncMask.SkillSlotInfo = true;
-	RTCharacterInitializeAttributes(Runtime, Character);
+	RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_SKILL) | RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BATTLE_MODE));
 
 	return true;
 }
@@ -143,7 +143,7 @@ Bool RTRuntimeWarpCharacter(
             Character->Data.Info.WorldIndex = WarpPoint.WorldIndex;
             Character->Data.Info.DungeonIndex = (Int32)TargetWorld->DungeonIndex;
             Character->SyncMask.Info = true;
-            RTCharacterInitializeAttributes(Runtime, Character);
+            RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_BUFF));
 
             RTMovementInitialize(
                 Runtime,
@@ -2,6 +2,7 @@
 #include "MobPattern.h"
 #include "PartyManager.h"
 #include "Runtime.h"
+#include "Script.h"
 #include "World.h"
 #include "WorldManager.h"
 #include "NotificationProtocol.h"
@@ -68,12 +69,15 @@ Void RTWorldContextAddReferenceCount(
 }
 
 Void RTWorldContextUpdate(
-    RTWorldContextRef WorldContext
+    RTWorldContextRef WorldContext,
+    Int32 Phase
 ) {
     if (WorldContext->Paused) return;
 
-    if (WorldContext->WorldData->Type == RUNTIME_WORLD_TYPE_DUNGEON ||
-        WorldContext->WorldData->Type == RUNTIME_WORLD_TYPE_QUEST_DUNGEON) {
+    if (Phase == RUNTIME_WORLD_UPDATE_PHASE_DUNGEON) {
+        if (WorldContext->WorldData->Type != RUNTIME_WORLD_TYPE_DUNGEON &&
+            WorldContext->WorldData->Type != RUNTIME_WORLD_TYPE_QUEST_DUNGEON) return;
+
         RTDungeonUpdate(WorldContext);
 
         /* NOTE: See @MobUpdateImprovement
@@ -86,18 +90,25 @@ Void RTWorldContextUpdate(
             Iterator = DictionaryKeyIteratorNext(Iterator);
         }
         */
+        return;
     } 
 
-    // NOTE: See @MobUpdateImprovement
-    DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(WorldContext->EntityToMob);
-    while (Iterator.Key) {
-        RTEntityID MobID = *(RTEntityID*)Iterator.Key;
-        RTMobRef Mob = RTWorldContextGetMob(WorldContext, MobID);
-        assert(Mob);
-        RTMobUpdate(WorldContext->WorldManager->Runtime, WorldContext, Mob);
-        Iterator = DictionaryKeyIteratorNext(Iterator);
+    if (Phase == RUNTIME_WORLD_UPDATE_PHASE_MOB) {
+        // NOTE: See @MobUpdateImprovement
+        DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(WorldContext->EntityToMob);
+        while (Iterator.Key) {
+            RTEntityID MobID = *(RTEntityID*)Iterator.Key;
+            RTMobRef Mob = RTWorldContextGetMob(WorldContext, MobID);
+            assert(Mob);
+            RTMobUpdate(WorldContext->WorldManager->Runtime, WorldContext, Mob);
+            Iterator = DictionaryKeyIteratorNext(Iterator);
+        }
+
+        return;
     }
 
+    if (Phase != RUNTIME_WORLD_UPDATE_PHASE_ITEM) return;
+
     Timestamp Timestamp = PlatformGetTickCount();
     if (WorldContext->NextItemUpdateTimestamp <= Timestamp) {
         WorldContext->NextItemUpdateTimestamp = INT64_MAX;
@@ -165,7 +176,7 @@ Void RTWorldSpawnCharacterWithoutNotification(
     UInt16 X = Character->Movement.PositionCurrent.X;
     UInt16 Y = Character->Movement.PositionCurrent.Y;
     RTWorldChunkRef WorldChunk = RTWorldContextGetChunk(WorldContext, X, Y);
-    RTWorldChunkInsert(WorldChunk, Entity, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
+    RTWorldChunkInsert(WorldChunk, Entity, &Character->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
     RTWorldContextAddReferenceCount(WorldContext, X, Y, 1);
     RTWorldTileIncreaseCharacterCount(Runtime, WorldContext, Character->Movement.PositionTile.X, Character->Movement.PositionTile.Y);
 
@@ -203,7 +214,7 @@ Void RTWorldDespawnCharacter(
 
     UInt16 X = Character->Movement.PositionCurrent.X;
     UInt16 Y = Character->Movement.PositionCurrent.Y;
-    RTWorldChunkRemove(Character->Movement.WorldChunk, Entity, Reason);
+    RTWorldChunkRemove(Character->Movement.WorldChunk, Entity, &Character->WorldChunkSlotIndex, Reason);
     RTWorldContextAddReferenceCount(WorldContext, X, Y, -1);
     RTWorldTileDecreaseCharacterCount(Runtime, WorldContext, Character->Movement.PositionTile.X, Character->Movement.PositionTile.Y);
 
@@ -282,7 +293,7 @@ Void RTWorldSpawnMob(
     Mob->EventRespawnTimestamp = 0;
 
     RTWorldChunkRef WorldChunk = RTWorldContextGetChunk(WorldContext, X, Y);
-    RTWorldChunkInsert(WorldChunk, Mob->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
+    RTWorldChunkInsert(WorldChunk, Mob->ID, &Mob->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
 
     Mob->Movement.WorldContext = WorldContext;
     Mob->Movement.WorldChunk = WorldChunk;
@@ -354,7 +365,7 @@ Void RTWorldSpawnMob(
         }
     }
 
-    RTMobOnEvent(Runtime, WorldContext, Mob, MOB_EVENT_SPAWN);
+    RTMobOnEvent(Runtime, WorldContext, Mob, RUNTIME_SCRIPT_EVENT_MOB_SPAWN);
 
     DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(WorldContext->EntityToMob);
     while (Iterator.Key) {
@@ -555,8 +566,8 @@ Void RTWorldDespawnMob(
 
     RTWorldChunkRef WorldChunk = Mob->Movement.WorldChunk;
     Int32 UpdateReason = RTEntityIsNull(Mob->EventDespawnLinkID) ? RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT : RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE;
-    RTWorldChunkRemove(WorldChunk, Mob->ID, UpdateReason);
-    RTMobOnEvent(Runtime, WorldContext, Mob, MOB_EVENT_DESPAWN);
+    RTWorldChunkRemove(WorldChunk, Mob->ID, &Mob->WorldChunkSlotIndex, UpdateReason);
+    RTMobOnEvent(Runtime, WorldContext, Mob, RUNTIME_SCRIPT_EVENT_MOB_DESPAWN);
     RTWorldTileDecreaseMobCount(Runtime, WorldContext, Mob->Movement.PositionTile.X, Mob->Movement.PositionTile.Y);
 
     if (!RTEntityIsNull(Mob->EventDespawnLinkID)) {
@@ -709,7 +720,7 @@ Void RTWorldRespawnMob(
 
         RTWorldChunkRef WorldChunk = Mob->Movement.WorldChunk;
         Int32 UpdateReason = RTEntityIsNull(Mob->EventDespawnLinkID) ? RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT : RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE;
-        RTWorldChunkRemove(WorldChunk, Mob->ID, UpdateReason);
+        RTWorldChunkRemove(WorldChunk, Mob->ID, &Mob->WorldChunkSlotIndex, UpdateReason);
         RTWorldTileDecreaseMobCount(Runtime, WorldContext, Mob->Movement.PositionTile.X, Mob->Movement.PositionTile.Y);
     }
     
@@ -758,7 +769,7 @@ Void RTWorldRespawnMob(
     Mob->Movement.WorldContext = WorldContext;
     Mob->Movement.WorldChunk = WorldChunk;
     Mob->Movement.Entity = Mob->ID;
-    RTWorldChunkInsert(WorldChunk, Mob->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
+    RTWorldChunkInsert(WorldChunk, Mob->ID, &Mob->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
 
     if (Mob->Pattern) RTMobPatternSpawn(Runtime, WorldContext, Mob, Mob->Pattern);
 }
@@ -844,7 +855,7 @@ RTWorldItemRef RTWorldSpawnItem(
     
     RTWorldChunkRef WorldChunk = RTWorldContextGetChunk(WorldContext, X, Y);
     WorldChunk->NextItemUpdateTimestamp = MIN(WorldChunk->NextItemUpdateTimestamp, Item->DespawnTimestamp);
-    RTWorldChunkInsert(WorldChunk, Item->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
+    RTWorldChunkInsert(WorldChunk, Item->ID, &Item->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
 
     return Item;
 }
@@ -855,7 +866,7 @@ Void RTWorldDespawnItem(
     RTWorldItemRef Item
 ) {
     RTWorldChunkRef WorldChunk = RTWorldContextGetChunk(WorldContext, Item->X, Item->Y);
-    RTWorldChunkRemove(WorldChunk, Item->ID, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
+    RTWorldChunkRemove(WorldChunk, Item->ID, &Item->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
     
     DictionaryRemove(WorldContext->EntityToItem, &Item->ID);
     MemoryPoolRelease(WorldContext->ItemPool, Item->Index);
@@ -1062,7 +1073,8 @@ Void RTWorldSetMobTable(
         RTWorldChunkRef WorldChunk = &WorldContext->Chunks[ChunkIndex];
         for (Int MobIndex = (Int32)ArrayGetElementCount(WorldChunk->Mobs) - 1; MobIndex >= 0; MobIndex -= 1) {
             RTEntityID Entity = *(RTEntityID*)ArrayGetElementAtIndex(WorldChunk->Mobs, MobIndex);
-            RTWorldChunkRemove(WorldChunk, Entity, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
+            Int32* SlotIndex = *(Int32**)ArrayGetElementAtIndex(WorldChunk->MobSlotIndices, MobIndex);
+            RTWorldChunkRemove(WorldChunk, Entity, SlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_INIT);
         }
     }
 
@@ -53,6 +53,7 @@ enum {
 struct _RTWorldItem {
     Int Index;
     RTEntityID ID;
+    Int32 WorldChunkSlotIndex;
     UInt64 ItemOptions;
     UInt32 ItemSourceIndex;
     RTItem Item;
@@ -78,6 +79,8 @@ struct _RTWorldData {
     ArrayRef MobTable;
     ArrayRef MobScriptTable;
     struct _RTDropTable DropTable;
+    Int32 PathFindingGraphCount;
+    RTPathFindingGraphRef PathFindingGraphs[RUNTIME_PATH_FINDING_MAX_GRAPH_COUNT];
     RTWorldTile Tiles[RUNTIME_WORLD_SIZE * RUNTIME_WORLD_SIZE];
 };
 
@@ -115,6 +118,7 @@ struct _RTWorldContext {
     DictionaryRef EntityToMob;
     DictionaryRef EntityToMobPattern;
     DictionaryRef EntityToItem;
+    RTPathFindingCacheRef PathFindingCache;
 };
 
 RTWorldChunkRef RTWorldContextGetChunk(
@@ -124,7 +128,8 @@ RTWorldChunkRef RTWorldContextGetChunk(
 );
 
 Void RTWorldContextUpdate(
-    RTWorldContextRef WorldContext
+    RTWorldContextRef WorldContext,
+    Int32 Phase
 );
 
 Void* RTWorldContextGetEntityContext(
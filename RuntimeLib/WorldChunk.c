@@ -136,19 +136,49 @@ Void RTNotificationAppendCharacterSpawnIndex(
 }
 
 
-Void RTWorldChunkBroadcastCharactersToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
-);
+Void RTNotificationAppendMobSpawnIndex(
+    RTRuntimeRef Runtime,
+    Void* Notification,
+    RTMobRef Mob
+) {
+    NOTIFICATION_DATA_MOBS_SPAWN_INDEX* NotificationMob = RTNotificationAppendStruct(Notification, NOTIFICATION_DATA_MOBS_SPAWN_INDEX);
+    NotificationMob->Entity = Mob->ID;
+    NotificationMob->PositionBeginX = Mob->Movement.PositionCurrent.X;
+    NotificationMob->PositionBeginY = Mob->Movement.PositionCurrent.Y;
+    NotificationMob->PositionEndX = Mob->Movement.PositionEnd.X;
+    NotificationMob->PositionEndY = Mob->Movement.PositionEnd.Y;
+    NotificationMob->MobSpeciesIndex = Mob->SpeciesData->MobSpeciesIndex;
+    NotificationMob->MaxHP = Mob->Attributes.Values[RUNTIME_ATTRIBUTE_HP_MAX];
+    NotificationMob->CurrentHP = Mob->Attributes.Values[RUNTIME_ATTRIBUTE_HP_CURRENT];
+    NotificationMob->IsChasing = Mob->IsChasing;
+    NotificationMob->Level = Mob->Attributes.Values[RUNTIME_ATTRIBUTE_LEVEL];
+    NotificationMob->Nation = 0;
+}
 
-Void RTWorldChunkBroadcastMobsToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
-);
+Void RTNotificationAppendItemSpawnIndex(
+    RTRuntimeRef Runtime,
+    Void* Notification,
+    RTWorldItemRef Item
+) {
+    NOTIFICATION_DATA_ITEMS_SPAWN_INDEX* NotificationItem = RTNotificationAppendStruct(Notification, NOTIFICATION_DATA_ITEMS_SPAWN_INDEX);
+    NotificationItem->Entity = Item->ID;
+    NotificationItem->ItemOptions = Item->ItemOptions;
+    NotificationItem->SourceIndex = Item->ItemSourceIndex;
+    NotificationItem->ItemID = Item->Item.Serial;
+    NotificationItem->X = Item->X;
+    NotificationItem->Y = Item->Y;
+    NotificationItem->UniqueKey = Item->ItemUniqueKey;
+    NotificationItem->ContextType = Item->ContextType;
+    NotificationItem->ItemProperty = Item->ItemProperty;
+}
 
-Void RTWorldChunkBroadcastItemsToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
+Void RTWorldChunkBroadcastSnapshotsToCharacter(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character,
+    RTEntityID Entity,
+    RTWorldChunkRef* Chunks,
+    Int32 ChunkCount,
+    Int32 SnapshotType
 );
 
 Void RTWorldChunkInitialize(
@@ -171,6 +201,10 @@ Void RTWorldChunkInitialize(
 	Chunk->Mobs = ArrayCreateEmpty(Runtime->Allocator, sizeof(RTEntityID), 8);
 	Chunk->Items = ArrayCreateEmpty(Runtime->Allocator, sizeof(RTEntityID), 8);
     Chunk->Objects = ArrayCreateEmpty(Runtime->Allocator, sizeof(RTEntityID), 8);
+    Chunk->CharacterSlotIndices = ArrayCreateEmpty(Runtime->Allocator, sizeof(Int32*), 8);
+    Chunk->MobSlotIndices = ArrayCreateEmpty(Runtime->Allocator, sizeof(Int32*), 8);
+    Chunk->ItemSlotIndices = ArrayCreateEmpty(Runtime->Allocator, sizeof(Int32*), 8);
+    memset(Chunk->Snapshots, 0, sizeof(Chunk->Snapshots));
 }
 
 Void RTWorldChunkDeinitialize(
@@ -180,6 +214,215 @@ Void RTWorldChunkDeinitialize(
 	ArrayDestroy(Chunk->Mobs);
 	ArrayDestroy(Chunk->Items);
     ArrayDestroy(Chunk->Objects);
+    ArrayDestroy(Chunk->CharacterSlotIndices);
+    ArrayDestroy(Chunk->MobSlotIndices);
+    ArrayDestroy(Chunk->ItemSlotIndices);
+
+    for (Int Index = 0; Index < RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_COUNT; Index += 1) {
+        RTWorldChunkSnapshotRef Snapshot = &Chunk->Snapshots[Index];
+        if (Snapshot->Entries) ArrayDestroy(Snapshot->Entries);
+        if (Snapshot->Data) ArrayDestroy(Snapshot->Data);
+    }
+}
+
+Void RTWorldChunkInvalidateSnapshots(
+    RTWorldChunkRef Chunk
+) {
+    for (Int Index = 0; Index < RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_COUNT; Index += 1) {
+        Chunk->Snapshots[Index].IsValid = false;
+    }
+}
+
+static RTWorldChunkSnapshotRef RTWorldChunkGetSnapshot(
+    RTWorldChunkRef Chunk,
+    Int32 SnapshotType
+) {
+    RTRuntimeRef Runtime = Chunk->Runtime;
+    RTWorldChunkSnapshotRef Snapshot = &Chunk->Snapshots[SnapshotType];
+    UInt64 UpdateTick = Runtime->WorldManager->UpdateTick;
+    if (Snapshot->IsValid && Snapshot->UpdateTick == UpdateTick) return Snapshot;
+
+    if (!Snapshot->Entries) {
+        Snapshot->Entries = ArrayCreateEmpty(Runtime->Allocator, sizeof(struct _RTWorldChunkSnapshotEntry), 8);
+        Snapshot->Data = ArrayCreateEmpty(Runtime->Allocator, sizeof(UInt8), 256);
+    }
+
+    ArrayRemoveAllElements(Snapshot->Entries, true);
+    ArrayRemoveAllElements(Snapshot->Data, true);
+
+    ArrayRef Container = NULL;
+    switch (SnapshotType) {
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_CHARACTER:
+        Container = Chunk->Characters;
+        break;
+
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_MOB:
+        Container = Chunk->Mobs;
+        break;
+
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_ITEM:
+        Container = Chunk->Items;
+        break;
+
+    default:
+        UNREACHABLE("Invalid snapshot type given for world chunk!");
+    }
+
+    // NOTE: The records are serialized into a nested builder as the snapshot can be requested while another notification is built
+    RTNotificationRef Scratch = _RTNotificationInit(Runtime->NotificationManager, sizeof(struct _RTNotification), 0);
+    for (Int Index = 0; Index < ArrayGetElementCount(Container); Index += 1) {
+        RTEntityID Entity = *(RTEntityID*)ArrayGetElementAtIndex(Container, Index);
+        Scratch->Length = sizeof(struct _RTNotification);
+
+        if (SnapshotType == RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_CHARACTER) {
+            RTCharacterRef Character = RTWorldManagerGetCharacter(Runtime->WorldManager, Entity);
+            if (!Character) continue;
+
+            RTNotificationAppendCharacterSpawnIndex(Runtime, (NOTIFICATION_DATA_CHARACTERS_SPAWN*)Scratch, Character);
+        }
+        else if (SnapshotType == RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_MOB) {
+            RTMobRef Mob = RTWorldContextGetMob(Chunk->WorldContext, Entity);
+            assert(Mob);
+
+            RTNotificationAppendMobSpawnIndex(Runtime, Scratch, Mob);
+        }
+        else {
+            RTWorldItemRef Item = RTWorldContextGetItem(Chunk->WorldContext, Entity);
+            assert(Item);
+
+            RTNotificationAppendItemSpawnIndex(Runtime, Scratch, Item);
+        }
+
+        RTWorldChunkSnapshotEntryRef Entry = (RTWorldChunkSnapshotEntryRef)ArrayAppendUninitializedElement(Snapshot->Entries);
+        Entry->Entity = Entity;
+        Entry->Offset = (Int32)ArrayGetElementCount(Snapshot->Data);
+        Entry->Length = Scratch->Length - sizeof(struct _RTNotification);
+        ArrayAppendMemory(Snapshot->Data, (UInt8*)Scratch + sizeof(struct _RTNotification), Entry->Length);
+    }
+
+    RTNotificationRelease(Scratch);
+
+    Snapshot->UpdateTick = UpdateTick;
+    Snapshot->IsValid = true;
+    return Snapshot;
+}
+
+static RTNotificationRef RTWorldChunkInitSnapshotNotification(
+    RTRuntimeRef Runtime,
+    Int32 SnapshotType
+) {
+    switch (SnapshotType) {
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_CHARACTER: {
+        NOTIFICATION_DATA_CHARACTERS_SPAWN* Notification = RTNotificationInit(CHARACTERS_SPAWN);
+        Notification->SpawnType = NOTIFICATION_SPAWN_TYPE_LIST;
+        return (RTNotificationRef)Notification;
+    }
+
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_MOB:
+        return (RTNotificationRef)RTNotificationInit(MOBS_SPAWN);
+
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_ITEM:
+        return (RTNotificationRef)RTNotificationInit(ITEMS_SPAWN);
+
+    default:
+        UNREACHABLE("Invalid snapshot type given for world chunk!");
+    }
+}
+
+static Void RTWorldChunkDispatchSnapshotNotification(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character,
+    RTNotificationRef Notification,
+    Int32 SnapshotType,
+    Int32 Count
+) {
+    switch (SnapshotType) {
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_CHARACTER:
+        ((NOTIFICATION_DATA_CHARACTERS_SPAWN*)Notification)->Count = Count;
+        break;
+
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_MOB:
+        ((NOTIFICATION_DATA_MOBS_SPAWN*)Notification)->Count = Count;
+        break;
+
+    case RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_ITEM:
+        ((NOTIFICATION_DATA_ITEMS_SPAWN*)Notification)->Count = Count;
+        break;
+
+    default:
+        UNREACHABLE("Invalid snapshot type given for world chunk!");
+    }
+
+    RTNotificationDispatchToCharacter(Notification, Character);
+}
+
+Void RTWorldChunkBroadcastSnapshotsToCharacter(
+    RTRuntimeRef Runtime,
+    RTCharacterRef Character,
+    RTEntityID Entity,
+    RTWorldChunkRef* Chunks,
+    Int32 ChunkCount,
+    Int32 SnapshotType
+) {
+    RTNotificationRef Notification = NULL;
+    Int32 Count = 0;
+
+    for (Int ChunkIndex = 0; ChunkIndex < ChunkCount; ChunkIndex += 1) {
+        RTWorldChunkSnapshotRef Snapshot = RTWorldChunkGetSnapshot(Chunks[ChunkIndex], SnapshotType);
+        if (ArrayGetElementCount(Snapshot->Entries) < 1) continue;
+
+        UInt8* Data = (UInt8*)ArrayGetElementAtIndex(Snapshot->Data, 0);
+
+        for (Int Index = 0; Index < ArrayGetElementCount(Snapshot->Entries); Index += 1) {
+            RTWorldChunkSnapshotEntryRef Entry = (RTWorldChunkSnapshotEntryRef)ArrayGetElementAtIndex(Snapshot->Entries, Index);
+            if (RTEntityIsEqual(Entry->Entity, Entity)) continue;
+
+            // NOTE: The spawn count is limited to a single byte, larger deltas are split into multiple notifications
+            if (Notification && (Count >= UINT8_MAX || Notification->Length + Entry->Length > RUNTIME_MAX_NOTIFICATION_BUFFER_LENGTH)) {
+                RTWorldChunkDispatchSnapshotNotification(Runtime, Character, Notification, SnapshotType, Count);
+                Notification = NULL;
+                Count = 0;
+            }
+
+            if (!Notification) Notification = RTWorldChunkInitSnapshotNotification(Runtime, SnapshotType);
+
+            RTNotificationAppendCopy(Notification, &Data[Entry->Offset], Entry->Length);
+            Count += 1;
+        }
+    }
+
+    if (Notification) {
+        RTWorldChunkDispatchSnapshotNotification(Runtime, Character, Notification, SnapshotType, Count);
+    }
+}
+
+static Void RTWorldChunkBroadcastNearbySnapshotsToCharacter(
+    RTWorldChunkRef WorldChunk,
+    RTCharacterRef Character,
+    RTEntityID Entity
+) {
+    RTRuntimeRef Runtime = WorldChunk->Runtime;
+    RTWorldChunkRef Chunks[(2 * RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS + 1) * (2 * RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS + 1)] = { 0 };
+    Int32 ChunkCount = 0;
+
+    Int32 StartChunkX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
+    Int32 StartChunkY = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkY - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
+    Int32 EndChunkX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX + RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
+    Int32 EndChunkY = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkY + RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
+
+    for (Int DeltaChunkX = StartChunkX; DeltaChunkX <= EndChunkX; DeltaChunkX += 1) {
+        for (Int DeltaChunkY = StartChunkY; DeltaChunkY <= EndChunkY; DeltaChunkY += 1) {
+            Int WorldChunkIndex = DeltaChunkX + DeltaChunkY * RUNTIME_WORLD_CHUNK_COUNT;
+            assert(WorldChunkIndex < RUNTIME_WORLD_CHUNK_COUNT * RUNTIME_WORLD_CHUNK_COUNT);
+
+            Chunks[ChunkCount] = &WorldChunk->WorldContext->Chunks[WorldChunkIndex];
+            ChunkCount += 1;
+        }
+    }
+
+    for (Int32 SnapshotType = 0; SnapshotType < RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_COUNT; SnapshotType += 1) {
+        RTWorldChunkBroadcastSnapshotsToCharacter(Runtime, Character, Entity, Chunks, ChunkCount, SnapshotType);
+    }
 }
 
 ArrayRef RTWorldChunkGetContainer(
@@ -204,14 +447,45 @@ ArrayRef RTWorldChunkGetContainer(
 	}
 }
 
+// NOTE: Entities store their index inside of the chunk container to make membership changes constant time
+static ArrayRef RTWorldChunkGetSlotIndexContainer(
+    RTWorldChunkRef Chunk,
+    RTEntityID Entity
+) {
+    switch (Entity.EntityType) {
+    case RUNTIME_ENTITY_TYPE_CHARACTER:
+        return Chunk->CharacterSlotIndices;
+
+    case RUNTIME_ENTITY_TYPE_MOB:
+        return Chunk->MobSlotIndices;
+
+    case RUNTIME_ENTITY_TYPE_ITEM:
+        return Chunk->ItemSlotIndices;
+
+    default:
+        return NULL;
+    }
+}
+
 Void RTWorldChunkInsert(
 	RTWorldChunkRef Chunk,
 	RTEntityID Entity,
+    Int32* SlotIndex,
     Int32 Reason
 ) {
 	ArrayRef Container = RTWorldChunkGetContainer(Chunk, Entity);
-	assert(!ArrayContainsElement(Container, &Entity));
+    ArrayRef SlotIndexContainer = RTWorldChunkGetSlotIndexContainer(Chunk, Entity);
+    assert((SlotIndex != NULL) == (SlotIndexContainer != NULL));
+    if (SlotIndex) {
+        *SlotIndex = (Int32)ArrayGetElementCount(Container);
+        ArrayAppendElement(SlotIndexContainer, &SlotIndex);
+    }
+    else {
+        assert(!ArrayContainsElement(Container, &Entity));
+    }
+
 	ArrayAppendElement(Container, &Entity);
+    RTWorldChunkInvalidateSnapshots(Chunk);
     RTWorldChunkNotify(Chunk, Entity, Reason, true);
 
     if (Entity.EntityType == RUNTIME_ENTITY_TYPE_CHARACTER) {
@@ -233,8 +507,8 @@ Void RTWorldChunkUpdate(
     RTWorldChunkRef NewChunk = RTWorldContextGetChunk(Movement->WorldContext, Movement->PositionCurrent.X, Movement->PositionCurrent.Y);
     if (WorldChunk == NewChunk) return;
     
-    RTWorldChunkRemove(Movement->WorldChunk, Entity, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
-    RTWorldChunkInsert(NewChunk, Entity, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
+    RTWorldChunkRemove(Movement->WorldChunk, Entity, &Character->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
+    RTWorldChunkInsert(NewChunk, Entity, &Character->WorldChunkSlotIndex, RUNTIME_WORLD_CHUNK_UPDATE_REASON_NONE);
     
     Trace("ServerSetChunkPos(%d, %d)", NewChunk->ChunkX, NewChunk->ChunkY);
     Int32 OldBeginX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
@@ -248,6 +522,9 @@ Void RTWorldChunkUpdate(
 
     Movement->WorldChunk = NewChunk;
 
+    RTWorldChunkRef Chunks[(2 * RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS + 1) * (2 * RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS + 1)] = { 0 };
+    Int32 ChunkCount = 0;
+
     NOTIFICATION_DATA_CHARACTERS_SPAWN* Notification = RTNotificationInit(CHARACTERS_SPAWN);
     Notification->SpawnType = NOTIFICATION_SPAWN_TYPE_MOVE;
     Notification->Count = 1;
@@ -262,185 +539,52 @@ Void RTWorldChunkUpdate(
         
             RTWorldChunkRef NearbyWorldChunk = &WorldChunk->WorldContext->Chunks[WorldChunkIndex];
             RTNotificationDispatchToChunk(Notification, NearbyWorldChunk);
-            RTWorldChunkBroadcastCharactersToCharacter(NearbyWorldChunk, Entity);
-            RTWorldChunkBroadcastMobsToCharacter(NearbyWorldChunk, Entity);
-            RTWorldChunkBroadcastItemsToCharacter(NearbyWorldChunk, Entity);
+            Chunks[ChunkCount] = NearbyWorldChunk;
+            ChunkCount += 1;
         }
     }
+
+    // NOTE: The whole visibility delta is sent as a single notification per entity type after the shared notification is no longer used
+    for (Int32 SnapshotType = 0; SnapshotType < RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_COUNT; SnapshotType += 1) {
+        RTWorldChunkBroadcastSnapshotsToCharacter(Runtime, Character, Entity, Chunks, ChunkCount, SnapshotType);
+    }
 }
 
 Void RTWorldChunkRemove(
 	RTWorldChunkRef Chunk,
 	RTEntityID Entity,
+    Int32* SlotIndex,
     Int32 Reason
 ) {
     RTWorldChunkNotify(Chunk, Entity, Reason, false);
     ArrayRef Container = RTWorldChunkGetContainer(Chunk, Entity);
-	assert(ArrayContainsElement(Container, &Entity));
-	ArrayRemoveElement(Container, &Entity);
-
-    if (Entity.EntityType == RUNTIME_ENTITY_TYPE_CHARACTER) {
-        Chunk->WorldContext->ReferenceCount -= 1;
-    }
-}
-
-Void RTWorldChunkBroadcastNearbyCharactersToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
-) {
-    Int32 StartChunkX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 StartChunkY = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkY - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 EndChunkX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX + RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 EndChunkY = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkY + RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-
-    for (Int DeltaChunkX = StartChunkX; DeltaChunkX <= EndChunkX; DeltaChunkX += 1) {
-        for (Int DeltaChunkY = StartChunkY; DeltaChunkY <= EndChunkY; DeltaChunkY += 1) {
-            Int WorldChunkIndex = (Int)DeltaChunkX + DeltaChunkY * RUNTIME_WORLD_CHUNK_COUNT;
-            assert(WorldChunkIndex < RUNTIME_WORLD_CHUNK_COUNT * RUNTIME_WORLD_CHUNK_COUNT);
-
-            RTWorldChunkRef NearbyWorldChunk = &WorldChunk->WorldContext->Chunks[WorldChunkIndex];
-            RTWorldChunkBroadcastCharactersToCharacter(NearbyWorldChunk, Entity);
-        }
-    }
-}
-
-Void RTWorldChunkBroadcastCharactersToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
-) {
-    RTRuntimeRef Runtime = WorldChunk->Runtime;
-    assert(Runtime);
-    
-    RTCharacterRef Character = RTWorldManagerGetCharacter(Runtime->WorldManager, Entity);
-    assert(Character);
-    
-    NOTIFICATION_DATA_CHARACTERS_SPAWN* Notification = RTNotificationInit(CHARACTERS_SPAWN);
-    Notification->SpawnType = NOTIFICATION_SPAWN_TYPE_LIST;
-    Notification->Count = 0;
-    
-    for (Int EntityIndex = 0; EntityIndex < ArrayGetElementCount(WorldChunk->Characters); EntityIndex += 1) {
-        RTEntityID CharacterEntity = *(RTEntityID*)ArrayGetElementAtIndex(WorldChunk->Characters, EntityIndex);
-        if (RTEntityIsEqual(Entity, CharacterEntity)) continue;
-        
-        RTCharacterRef Character = RTWorldManagerGetCharacter(Runtime->WorldManager, CharacterEntity);
-        RTNotificationAppendCharacterSpawnIndex(Runtime, Notification, Character);
-        Notification->Count += 1;
-    }
-
-    if (Notification->Count > 0) {
-        RTNotificationDispatchToCharacter(Notification, Character);
-    }
-}
-
-Void RTWorldChunkBroadcastNearbyMobsToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
-) {
-    Int32 StartChunkX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 StartChunkY = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkY - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 EndChunkX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX + RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 EndChunkY = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkY + RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-
-    for (Int DeltaChunkX = StartChunkX; DeltaChunkX <= EndChunkX; DeltaChunkX += 1) {
-        for (Int DeltaChunkY = StartChunkY; DeltaChunkY <= EndChunkY; DeltaChunkY += 1) {
-            Int WorldChunkIndex = DeltaChunkX + DeltaChunkY * RUNTIME_WORLD_CHUNK_COUNT;
-            assert(WorldChunkIndex < RUNTIME_WORLD_CHUNK_COUNT* RUNTIME_WORLD_CHUNK_COUNT);
-
-            RTWorldChunkRef NearbyWorldChunk = &WorldChunk->WorldContext->Chunks[WorldChunkIndex];
-            RTWorldChunkBroadcastMobsToCharacter(NearbyWorldChunk, Entity);
+    ArrayRef SlotIndexContainer = RTWorldChunkGetSlotIndexContainer(Chunk, Entity);
+    assert((SlotIndex != NULL) == (SlotIndexContainer != NULL));
+    if (SlotIndex) {
+        Int32 LastSlotIndex = (Int32)ArrayGetElementCount(Container) - 1;
+        assert(0 <= *SlotIndex && *SlotIndex <= LastSlotIndex);
+        assert(RTEntityIsEqual(*(RTEntityID*)ArrayGetElementAtIndex(Container, *SlotIndex), Entity));
+
+        if (*SlotIndex < LastSlotIndex) {
+            RTEntityID LastEntity = *(RTEntityID*)ArrayGetElementAtIndex(Container, LastSlotIndex);
+            Int32* LastSlotIndexRef = *(Int32**)ArrayGetElementAtIndex(SlotIndexContainer, LastSlotIndex);
+            ArraySetElementAtIndex(Container, *SlotIndex, &LastEntity);
+            ArraySetElementAtIndex(SlotIndexContainer, *SlotIndex, &LastSlotIndexRef);
+            *LastSlotIndexRef = *SlotIndex;
         }
-    }
-}
 
-Void RTWorldChunkBroadcastMobsToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
-) {
-    RTRuntimeRef Runtime = WorldChunk->Runtime;
-    assert(Runtime);
-    
-    RTCharacterRef Character = RTWorldManagerGetCharacter(Runtime->WorldManager, Entity);
-    assert(Character);
-    
-    NOTIFICATION_DATA_MOBS_SPAWN* Notification = RTNotificationInit(MOBS_SPAWN);
-    Notification->Count = ArrayGetElementCount(WorldChunk->Mobs);
-    
-    for (Int Index = 0; Index < ArrayGetElementCount(WorldChunk->Mobs); Index += 1) {
-        RTEntityID MobEntity = *(RTEntityID*)ArrayGetElementAtIndex(WorldChunk->Mobs, Index);
-        RTMobRef Mob = RTWorldContextGetMob(WorldChunk->WorldContext, MobEntity);
-        assert(Mob);
-
-        NOTIFICATION_DATA_MOBS_SPAWN_INDEX* NotificationMob = RTNotificationAppendStruct(Notification, NOTIFICATION_DATA_MOBS_SPAWN_INDEX);
-        NotificationMob->Entity = MobEntity;
-        NotificationMob->PositionBeginX = Mob->Movement.PositionCurrent.X;
-        NotificationMob->PositionBeginY = Mob->Movement.PositionCurrent.Y;
-        NotificationMob->PositionEndX = Mob->Movement.PositionEnd.X;
-        NotificationMob->PositionEndY = Mob->Movement.PositionEnd.Y;
-        NotificationMob->MobSpeciesIndex = Mob->SpeciesData->MobSpeciesIndex;
-        NotificationMob->MaxHP = Mob->Attributes.Values[RUNTIME_ATTRIBUTE_HP_MAX];
-        NotificationMob->CurrentHP = Mob->Attributes.Values[RUNTIME_ATTRIBUTE_HP_CURRENT];
-        NotificationMob->IsChasing = Mob->IsChasing;
-        NotificationMob->Level = Mob->Attributes.Values[RUNTIME_ATTRIBUTE_LEVEL];
-        NotificationMob->Nation = 0;
+        ArrayRemoveElementAtIndex(Container, LastSlotIndex);
+        ArrayRemoveElementAtIndex(SlotIndexContainer, LastSlotIndex);
+        *SlotIndex = -1;
     }
-    
-    if (Notification->Count > 0) {
-        RTNotificationDispatchToCharacter(Notification, Character);
-    }
-}
-
-Void RTWorldChunkBroadcastNearbyItemsToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
-) {
-    Int32 StartChunkX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 StartChunkY = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkY - RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 EndChunkX = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkX + RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-    Int32 EndChunkY = MAX(0, MIN(RUNTIME_WORLD_CHUNK_COUNT - 1, WorldChunk->ChunkY + RUNTIME_WORLD_CHUNK_VISIBLE_RADIUS));
-
-    for (Int DeltaChunkX = StartChunkX; DeltaChunkX <= EndChunkX; DeltaChunkX += 1) {
-        for (Int DeltaChunkY = StartChunkY; DeltaChunkY <= EndChunkY; DeltaChunkY += 1) {
-            Int WorldChunkIndex = DeltaChunkX + DeltaChunkY * RUNTIME_WORLD_CHUNK_COUNT;
-            assert(WorldChunkIndex < RUNTIME_WORLD_CHUNK_COUNT* RUNTIME_WORLD_CHUNK_COUNT);
-
-            RTWorldChunkRef NearbyWorldChunk = &WorldChunk->WorldContext->Chunks[WorldChunkIndex];
-            RTWorldChunkBroadcastItemsToCharacter(NearbyWorldChunk, Entity);
-        }
+    else {
+        assert(ArrayContainsElement(Container, &Entity));
+        ArrayRemoveElement(Container, &Entity);
     }
-}
-
-Void RTWorldChunkBroadcastItemsToCharacter(
-    RTWorldChunkRef WorldChunk,
-    RTEntityID Entity
-) {
-    RTRuntimeRef Runtime = WorldChunk->Runtime;
-    assert(Runtime);
-    
-    RTCharacterRef Character = RTWorldManagerGetCharacter(Runtime->WorldManager, Entity);
-    assert(Character);
-    
-    NOTIFICATION_DATA_ITEMS_SPAWN* Notification = RTNotificationInit(ITEMS_SPAWN);
-    Notification->Count = ArrayGetElementCount(WorldChunk->Items);
-    
-    for (Int Index = 0; Index < ArrayGetElementCount(WorldChunk->Items); Index += 1) {
-        RTEntityID ItemEntity = *(RTEntityID*)ArrayGetElementAtIndex(WorldChunk->Items, Index);
-        RTWorldItemRef Item = RTWorldContextGetItem(WorldChunk->WorldContext, ItemEntity);
-        assert(Item);
+    RTWorldChunkInvalidateSnapshots(Chunk);
 
-        NOTIFICATION_DATA_ITEMS_SPAWN_INDEX* NotificationItem = RTNotificationAppendStruct(Notification, NOTIFICATION_DATA_ITEMS_SPAWN_INDEX);
-        NotificationItem->Entity = ItemEntity;
-        NotificationItem->ItemOptions = Item->ItemOptions;
-        NotificationItem->SourceIndex = Item->ItemSourceIndex;
-        NotificationItem->ItemID = Item->Item.Serial;
-        NotificationItem->X = Item->X;
-        NotificationItem->Y = Item->Y;
-        NotificationItem->UniqueKey = Item->ItemUniqueKey;
-        NotificationItem->ContextType = Item->ContextType;
-        NotificationItem->ItemProperty = Item->ItemProperty;
-    }
-    
-    if (Notification->Count > 0) {
-        RTNotificationDispatchToCharacter(Notification, Character);
+    if (Entity.EntityType == RUNTIME_ENTITY_TYPE_CHARACTER) {
+        Chunk->WorldContext->ReferenceCount -= 1;
     }
 }
 
@@ -509,16 +653,7 @@ Void RTWorldChunkNotify(
         RTWorldItemRef Item = RTWorldContextGetItem(WorldChunk->WorldContext, Entity);
         assert(Item);
 
-        NOTIFICATION_DATA_ITEMS_SPAWN_INDEX* NotificationItem = RTNotificationAppendStruct(Notification, NOTIFICATION_DATA_ITEMS_SPAWN_INDEX);
-        NotificationItem->Entity = Entity;
-        NotificationItem->ItemOptions = Item->ItemOptions;
-        NotificationItem->SourceIndex = Item->ItemSourceIndex;
-        NotificationItem->ItemID = Item->Item.Serial;
-        NotificationItem->X = Item->X;
-        NotificationItem->Y = Item->Y;
-        NotificationItem->UniqueKey = Item->ItemUniqueKey;
-        NotificationItem->ContextType = Item->ContextType;
-        NotificationItem->ItemProperty = Item->ItemProperty;
+        RTNotificationAppendItemSpawnIndex(Runtime, Notification, Item);
         RTNotificationDispatchToNearby(Notification, WorldChunk);
     }
 
@@ -585,8 +720,6 @@ Void RTWorldChunkNotify(
         RTNotificationAppendCharacterSpawnIndex(Runtime, Notification, Character);
         RTNotificationDispatchToNearby(Notification, WorldChunk);
 
-        RTWorldChunkBroadcastNearbyCharactersToCharacter(WorldChunk, Entity);
-        RTWorldChunkBroadcastNearbyMobsToCharacter(WorldChunk, Entity);
-        RTWorldChunkBroadcastNearbyItemsToCharacter(WorldChunk, Entity);
+        RTWorldChunkBroadcastNearbySnapshotsToCharacter(WorldChunk, Character, Entity);
     }
 }
@@ -12,6 +12,30 @@ enum {
     RUNTIME_WORLD_CHUNK_UPDATE_REASON_MOVE,
 };
 
+enum {
+    RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_CHARACTER,
+    RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_MOB,
+    RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_ITEM,
+
+    RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_COUNT,
+};
+
+struct _RTWorldChunkSnapshotEntry {
+    RTEntityID Entity;
+    Int32 Offset;
+    Int32 Length;
+};
+typedef struct _RTWorldChunkSnapshotEntry* RTWorldChunkSnapshotEntryRef;
+
+// NOTE: The serialized spawn data of a chunk is only valid within the update tick it has been built in
+struct _RTWorldChunkSnapshot {
+    UInt64 UpdateTick;
+    Bool IsValid;
+    ArrayRef Entries;
+    ArrayRef Data;
+};
+typedef struct _RTWorldChunkSnapshot* RTWorldChunkSnapshotRef;
+
 struct _RTWorldChunk {
     RTRuntimeRef Runtime;
     RTWorldContextRef WorldContext;
@@ -24,7 +48,12 @@ struct _RTWorldChunk {
 	ArrayRef Mobs;
 	ArrayRef Items;
     ArrayRef Objects;
+    // NOTE: Parallel to the entity containers and holding the address of each entity's stored slot index
+    ArrayRef CharacterSlotIndices;
+    ArrayRef MobSlotIndices;
+    ArrayRef ItemSlotIndices;
     Timestamp NextItemUpdateTimestamp;
+    struct _RTWorldChunkSnapshot Snapshots[RUNTIME_WORLD_CHUNK_SNAPSHOT_TYPE_COUNT];
 };
 
 typedef Void* RTWorldChunkIteratorRef;
@@ -43,9 +72,11 @@ Void RTWorldChunkDeinitialize(
 	RTWorldChunkRef Chunk
 );
 
+// NOTE: SlotIndex is the entity's stored index inside of the chunk container and is NULL for objects
 Void RTWorldChunkInsert(
 	RTWorldChunkRef Chunk,
 	RTEntityID Entity,
+    Int32* SlotIndex,
     Int32 Reason
 );
 
@@ -57,9 +88,14 @@ Void RTWorldChunkUpdate(
 Void RTWorldChunkRemove(
 	RTWorldChunkRef Chunk,
 	RTEntityID Entity,
+    Int32* SlotIndex,
     Int32 Reason
 );
 
+Void RTWorldChunkInvalidateSnapshots(
+    RTWorldChunkRef Chunk
+);
+
 Void RTWorldChunkNotify(
     RTWorldChunkRef Chunk,
     RTEntityID Entity,
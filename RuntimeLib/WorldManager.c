@@ -1,3 +1,4 @@
+#include "PathFinding.h"
 #include "Runtime.h"
 #include "WorldManager.h"
 
@@ -17,6 +18,9 @@ RTWorldManagerRef RTWorldManagerCreate(
     WorldManager->MaxGlobalWorldContextCount = MaxGlobalWorldContextCount;
     WorldManager->MaxPartyWorldContextCount = MaxPartyWorldContextCount;
     WorldManager->MaxCharacterCount = MaxCharacterCount;
+    WorldManager->UpdateTick = 0;
+    WorldManager->UpdateTimestamp = GetTimestampMs();
+    memset(WorldManager->UpdateAccumulators, 0, sizeof(WorldManager->UpdateAccumulators));
     WorldManager->WorldDataPool = MemoryPoolCreate(
         Runtime->Allocator,
         sizeof(struct _RTWorldData),
@@ -49,6 +53,7 @@ RTWorldManagerRef RTWorldManagerCreate(
         Runtime->Allocator,
         MaxCharacterCount
     );
+    WorldManager->PathFindingContext = RTPathFindingContextCreate(Runtime->Allocator);
 
     // NOTE: WorldIndex 0 is reserved for an unused world context to preserve it for null checks
     Int NullIndex = 0;
@@ -94,9 +99,13 @@ Void RTWorldManagerDestroy(
             NodeIterator = DictionaryKeyIteratorNext(NodeIterator);
         }
 
+        RTDropTableDestroyAliasPools(WorldManager->Runtime, &WorldData->DropTable);
         ArrayDestroy(WorldData->DropTable.WorldDropPool);
         ArrayDestroy(WorldData->MobTable);
         ArrayDestroy(WorldData->MobScriptTable);
+        for (Int32 GraphIndex = 0; GraphIndex < WorldData->PathFindingGraphCount; GraphIndex += 1) {
+            RTPathFindingGraphDestroy(WorldData->PathFindingGraphs[GraphIndex]);
+        }
     }
 
     MemoryPoolDestroy(WorldManager->WorldDataPool);
@@ -106,17 +115,49 @@ Void RTWorldManagerDestroy(
     DictionaryDestroy(WorldManager->IndexToGlobalWorldContextPoolIndex);
     DictionaryDestroy(WorldManager->PartyToWorldContextPoolIndex);
     DictionaryDestroy(WorldManager->IndexToCharacterContextPoolIndex);
+    RTPathFindingContextDestroy(WorldManager->PathFindingContext);
     AllocatorDeallocate(WorldManager->Allocator, WorldManager);
 }
 
-Void RTWorldManagerUpdate(
-    RTWorldManagerRef WorldManager
+static Timestamp RTWorldManagerGetUpdateInterval(
+    RTWorldManagerRef WorldManager,
+    Int32 Phase
 ) {
+    RTRuntimeRef Runtime = WorldManager->Runtime;
+
+    switch (Phase) {
+    case RUNTIME_WORLD_UPDATE_PHASE_DUNGEON:
+        return Runtime->Config.DungeonUpdateInterval;
+
+    case RUNTIME_WORLD_UPDATE_PHASE_MOB:
+        return Runtime->Config.MobUpdateInterval;
+
+    case RUNTIME_WORLD_UPDATE_PHASE_ITEM:
+        return Runtime->Config.ItemUpdateInterval;
+
+    case RUNTIME_WORLD_UPDATE_PHASE_CHARACTER:
+        return Runtime->Config.CharacterUpdateInterval;
+
+    default:
+        UNREACHABLE("Invalid world update phase given!");
+    }
+}
+
+static Void RTWorldManagerUpdatePhase(
+    RTWorldManagerRef WorldManager,
+    Int32 Phase
+) {
+    if (Phase == RUNTIME_WORLD_UPDATE_PHASE_CHARACTER) {
+        // NOTE: Characters are only touched when one of their timers is due
+        TimerWheelUpdate(WorldManager->Runtime->TimerWheel, GetTimestampMs(), RTWorldManagerOnTimer, WorldManager);
+        return;
+    }
+
     DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(WorldManager->IndexToGlobalWorldContextPoolIndex);
     while (Iterator.Key) {
         Int WorldIndex = *(Int64*)Iterator.Key;
         RTWorldContextRef WorldContext = RTWorldContextGetGlobal(WorldManager, WorldIndex);
-        if (WorldContext->Active) RTWorldContextUpdate(WorldContext);
+        if (WorldContext->Active) RTWorldContextUpdate(WorldContext, Phase);
         Iterator = DictionaryKeyIteratorNext(Iterator);
     }
 
@@ -124,19 +165,84 @@ Void RTWorldManagerUpdate(
     while (Iterator.Key) {
         RTEntityID Party = *(RTEntityID*)Iterator.Key;
         RTWorldContextRef WorldContext = RTWorldContextGetParty(WorldManager, Party);
-        if (WorldContext->Active) RTWorldContextUpdate(WorldContext);
+        if (WorldContext->Active) RTWorldContextUpdate(WorldContext, Phase);
 
         Iterator = DictionaryKeyIteratorNext(Iterator);
     }
+}
 
-    // TODO: This routine shouldn't be on high frequency 100ms is sufficient
-    Iterator = DictionaryGetKeyIterator(WorldManager->IndexToCharacterContextPoolIndex);
-    while (Iterator.Key) {
-        UInt32 CharacterIndex = *(Int*)Iterator.Key;
-        RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(WorldManager, CharacterIndex);
+Void RTWorldManagerUpdate(
+    RTWorldManagerRef WorldManager
+) {
+    WorldManager->UpdateTick += 1;
+
+    Timestamp UpdateTimestamp = PlatformGetTickCountUs();
+    Timestamp CurrentTimestamp = GetTimestampMs();
+    Timestamp ElapsedTime = (CurrentTimestamp > WorldManager->UpdateTimestamp) ? CurrentTimestamp - WorldManager->UpdateTimestamp : 0;
+    WorldManager->UpdateTimestamp = CurrentTimestamp;
+
+    // NOTE: Every phase runs on its own interval, an interval of 0 updates the phase on every pass.
+    //       Phases read the current time themselves, so a due phase runs once and catches up on its own.
+    for (Int32 Phase = 0; Phase < RUNTIME_WORLD_UPDATE_PHASE_COUNT; Phase += 1) {
+        Timestamp Interval = RTWorldManagerGetUpdateInterval(WorldManager, Phase);
+        if (Interval < 1) {
+            RTWorldManagerUpdatePhase(WorldManager, Phase);
+            continue;
+        }
+
+        WorldManager->UpdateAccumulators[Phase] += ElapsedTime;
+        if (WorldManager->UpdateAccumulators[Phase] < Interval) continue;
+
+        RTWorldManagerUpdatePhase(WorldManager, Phase);
+        WorldManager->UpdateAccumulators[Phase] %= Interval;
+    }
+
+    MetricsHistogramRecord("world_update_duration_us", PlatformGetTickCountUs() - UpdateTimestamp);
+    MetricsGaugeSet("world_timer_count", TimerWheelGetTimerCount(WorldManager->Runtime->TimerWheel));
+    MetricsGaugeSet("world_character_count", MemoryPoolGetReservedBlockCount(WorldManager->CharacterContextPool));
+    MetricsGaugeSet("world_party_context_count", MemoryPoolGetReservedBlockCount(WorldManager->PartyWorldContextPool));
+}
+
+Void RTWorldManagerOnTimer(
+    TimerWheelRef TimerWheel,
+    Int32 Type,
+    UInt64 Key,
+    Void* Userdata
+) {
+    RTWorldManagerRef WorldManager = (RTWorldManagerRef)Userdata;
+
+    switch (Type) {
+    case RUNTIME_TIMER_TYPE_CHARACTER_UPDATE: {
+        RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(WorldManager, (UInt32)Key);
+        if (!Character) return;
+
+        Character->UpdateTimer = 0;
         RTCharacterUpdate(WorldManager->Runtime, Character);
+        break;
+    }
 
-        Iterator = DictionaryKeyIteratorNext(Iterator);
+    case RUNTIME_TIMER_TYPE_CHARACTER_BUFF: {
+        RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(WorldManager, (UInt32)Key);
+        if (!Character) return;
+
+        Character->BuffTimer = 0;
+        RTCharacterUpdateBuffs(WorldManager->Runtime, Character, false);
+        break;
+    }
+
+    case RUNTIME_TIMER_TYPE_CHARACTER_SYNC: {
+        RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(WorldManager, (UInt32)Key);
+        if (!Character) return;
+
+        // NOTE: The character stays queued until the server has consumed the entry from the sync queue
+        Character->SyncTimer = 0;
+        ArrayAppendElement(WorldManager->Runtime->CharacterSyncQueue, &Character->CharacterIndex);
+        break;
+    }
+
+    default:
+        Warn("Unknown timer type (%d)", Type);
+        break;
     }
 }
 
@@ -202,6 +308,7 @@ RTWorldContextRef RTWorldContextCreateGlobal(
     WorldContext->EntityToMob = EntityDictionaryCreate(WorldManager->Allocator, RUNTIME_MEMORY_MAX_MOB_COUNT);
     WorldContext->EntityToMobPattern = EntityDictionaryCreate(WorldManager->Allocator, RUNTIME_MEMORY_MAX_MOB_COUNT);
     WorldContext->EntityToItem = EntityDictionaryCreate(WorldManager->Allocator, RUNTIME_MEMORY_MAX_ITEM_COUNT);
+    WorldContext->PathFindingCache = RTPathFindingCacheCreate(WorldManager->Allocator);
     memcpy(WorldContext->Tiles, WorldContext->WorldData->Tiles, sizeof(RTWorldTile) * RUNTIME_WORLD_SIZE * RUNTIME_WORLD_SIZE);
     MemoryPoolReserve(WorldContext->ItemPool, 0);
     
@@ -264,6 +371,7 @@ Void RTWorldContextDestroyGlobal(
     DictionaryDestroy(WorldContext->EntityToMob);
     DictionaryDestroy(WorldContext->EntityToMobPattern);
     DictionaryDestroy(WorldContext->EntityToItem);
+    RTPathFindingCacheDestroy(WorldContext->PathFindingCache);
     MemoryPoolRelease(WorldManager->GlobalWorldContextPool, WorldContext->WorldData->WorldIndex);
 }
 
@@ -304,6 +412,7 @@ RTWorldContextRef RTWorldContextCreateParty(
     WorldContext->EntityToMob = EntityDictionaryCreate(WorldManager->Allocator, RUNTIME_MEMORY_MAX_MOB_COUNT);
     WorldContext->EntityToMobPattern = EntityDictionaryCreate(WorldManager->Allocator, RUNTIME_MEMORY_MAX_MOB_COUNT);
     WorldContext->EntityToItem = EntityDictionaryCreate(WorldManager->Allocator, RUNTIME_MEMORY_MAX_ITEM_COUNT);
+    WorldContext->PathFindingCache = RTPathFindingCacheCreate(WorldManager->Allocator);
     memcpy(WorldContext->Tiles, WorldContext->WorldData->Tiles, sizeof(RTWorldTile) * RUNTIME_WORLD_SIZE * RUNTIME_WORLD_SIZE);
     
     MemoryPoolReserve(WorldContext->ItemPool, 0);
@@ -379,6 +488,7 @@ Void RTWorldContextDestroyParty(
     DictionaryDestroy(WorldContext->EntityToMob);
     DictionaryDestroy(WorldContext->EntityToMobPattern);
     DictionaryDestroy(WorldContext->EntityToItem);
+    RTPathFindingCacheDestroy(WorldContext->PathFindingCache);
     MemoryPoolRelease(WorldManager->PartyWorldContextPool, WorldContext->WorldPoolIndex);
     DictionaryRemove(WorldManager->PartyToWorldContextPoolIndex, &Party);
 }
@@ -400,6 +510,18 @@ RTCharacterRef RTWorldManagerCreateCharacter(
     Character->CharacterIndex = CharacterIndex;
     Character->ID.EntityIndex = (UInt16)CharacterPoolIndex;
     Character->ID.EntityType = RUNTIME_ENTITY_TYPE_CHARACTER;
+    Character->AttributeCache.DirtyMask = RUNTIME_ATTRIBUTE_SOURCE_MASK_ALL;
+    Character->RegenUpdateTimestamp = GetTimestampMs() + RUNTIME_REGENERATION_INTERVAL;
+    Character->BuffUpdateTimestamp = UINT64_MAX;
+    Character->LastBuffUpdateTimestamp = 0;
+    Character->SyncTimer = 0;
+    Character->IsSyncQueued = false;
+    Character->UpdateTimer = TimerWheelSchedule(
+        WorldManager->Runtime->TimerWheel,
+        Character->RegenUpdateTimestamp,
+        RUNTIME_TIMER_TYPE_CHARACTER_UPDATE,
+        CharacterIndex
+    );
     DictionaryInsert(WorldManager->IndexToCharacterContextPoolIndex, &CharacterIndex, &CharacterPoolIndex, sizeof(Int));
     return Character;
 }
@@ -447,6 +569,11 @@ Void RTWorldManagerDestroyCharacter(
     Int* CharacterPoolIndex = DictionaryLookup(WorldManager->IndexToCharacterContextPoolIndex, &CharacterIndex);
     assert(CharacterPoolIndex);
 
+    RTCharacterRef Character = (RTCharacterRef)MemoryPoolFetch(WorldManager->CharacterContextPool, *CharacterPoolIndex);
+    TimerWheelCancel(WorldManager->Runtime->TimerWheel, Character->UpdateTimer);
+    TimerWheelCancel(WorldManager->Runtime->TimerWheel, Character->BuffTimer);
+    TimerWheelCancel(WorldManager->Runtime->TimerWheel, Character->SyncTimer);
+
     MemoryPoolRelease(WorldManager->CharacterContextPool, *CharacterPoolIndex);
     DictionaryRemove(WorldManager->IndexToCharacterContextPoolIndex, &CharacterIndex);
 }
@@ -5,6 +5,21 @@
 
 EXTERN_C_BEGIN
 
+enum {
+    RUNTIME_TIMER_TYPE_CHARACTER_UPDATE,
+    RUNTIME_TIMER_TYPE_CHARACTER_BUFF,
+    RUNTIME_TIMER_TYPE_CHARACTER_SYNC,
+};
+
+enum {
+    RUNTIME_WORLD_UPDATE_PHASE_DUNGEON,
+    RUNTIME_WORLD_UPDATE_PHASE_MOB,
+    RUNTIME_WORLD_UPDATE_PHASE_ITEM,
+    RUNTIME_WORLD_UPDATE_PHASE_CHARACTER,
+
+    RUNTIME_WORLD_UPDATE_PHASE_COUNT,
+};
+
 struct _RTWorldManager {
     AllocatorRef Allocator;
     RTRuntimeRef Runtime;
@@ -12,6 +27,9 @@ struct _RTWorldManager {
     Int32 MaxGlobalWorldContextCount;
     Int32 MaxPartyWorldContextCount;
     Int32 MaxCharacterCount;
+    UInt64 UpdateTick;
+    Timestamp UpdateTimestamp;
+    Timestamp UpdateAccumulators[RUNTIME_WORLD_UPDATE_PHASE_COUNT];
     MemoryPoolRef WorldDataPool;
     MemoryPoolRef GlobalWorldContextPool;
     MemoryPoolRef PartyWorldContextPool;
@@ -19,6 +37,7 @@ struct _RTWorldManager {
     DictionaryRef IndexToGlobalWorldContextPoolIndex;
     DictionaryRef PartyToWorldContextPoolIndex;
     DictionaryRef IndexToCharacterContextPoolIndex;
+    RTPathFindingContextRef PathFindingContext;
 };
 
 RTWorldManagerRef RTWorldManagerCreate(
@@ -37,6 +56,13 @@ Void RTWorldManagerUpdate(
     RTWorldManagerRef WorldManager
 );
 
+Void RTWorldManagerOnTimer(
+    TimerWheelRef TimerWheel,
+    Int32 Type,
+    UInt64 Key,
+    Void* Userdata
+);
+
 RTWorldDataRef RTWorldDataCreate(
     RTWorldManagerRef WorldManager,
     Int WorldIndex
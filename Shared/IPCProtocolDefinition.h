@@ -106,10 +106,18 @@ IPC_PROTOCOL_STRUCT(IPC_M2L_DATA_SERVER_GROUP,
 )
 
 IPC_PROTOCOL(M2L, GET_WORLD_LIST,
+    UInt32 Version;
     UInt8 GroupCount;
     // IPC_M2L_DATA_SERVER_GROUP Groups[0];
 )
 
+IPC_PROTOCOL(M2L, NFY_WORLD_LIST,
+    UInt32 Version;
+    UInt8 GroupIndex;
+    Bool IsRemoved;
+    IPC_M2L_DATA_SERVER_GROUP_NODE Node;
+)
+
 IPC_PROTOCOL(W2M, GET_WORLD_LIST,
 )
 
@@ -539,7 +547,8 @@ IPC_PROTOCOL(P2W, PARTY_CHANGE_LEADER_ACK,
 )
 
 IPC_PROTOCOL(P2W, PARTY_INFO,
-	struct _RTParty Party;
+	Int32 Length;
+	UInt8 Data[0];
 )
 
 IPC_PROTOCOL(W2P, PARTY_DATA,
@@ -564,11 +573,13 @@ IPC_PROTOCOL(P2W, BROADCAST_TO_CHARACTER,
 )
 
 IPC_PROTOCOL(P2W, CREATE_PARTY,
-	struct _RTParty Party;
+	Int32 Length;
+	UInt8 Data[0];
 )
 
 IPC_PROTOCOL(P2W, DESTROY_PARTY,
-	struct _RTParty Party;
+	Int32 Length;
+	UInt8 Data[0];
 )
 
 IPC_PROTOCOL(N2M, CLIENT_CONNECT,
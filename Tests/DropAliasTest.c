@@ -0,0 +1,279 @@
+#include "RuntimeLib/Runtime.h"
+#include "RuntimeLib/Drop.h"
+
+#define DROP_TEST_TABLE_COUNT           3
+#define DROP_TEST_SPECIES_COUNT         4
+#define DROP_TEST_SPECIES_ITEM_COUNT    8
+#define DROP_TEST_WORLD_ITEM_COUNT      24
+#define DROP_TEST_MAX_DROP_RATE         24000000
+#define DROP_TEST_MAX_MOB_LEVEL         160
+#define DROP_TEST_SAMPLE_COUNT          200000
+#define DROP_TEST_MIN_CATEGORY_COUNT    10
+#define DROP_TEST_MAX_CATEGORY_COUNT    (DROP_TEST_TABLE_COUNT * ((DROP_TEST_SPECIES_COUNT + 1) << 8) + 1)
+
+// NOTE: The tables are rolled in the order of a dungeon drop, the dungeon table first and the runtime table last
+struct _DropTestFixture {
+    struct _RTDropTable DropTables[DROP_TEST_TABLE_COUNT];
+};
+
+static Int32 FailureCount = 0;
+
+#define DROP_TEST_EXPECT(__CONDITION__, ...)            \
+do {                                                    \
+    if (!(__CONDITION__)) {                             \
+        fprintf(stderr, __VA_ARGS__);                   \
+        fprintf(stderr, "\n");                          \
+        FailureCount += 1;                              \
+    }                                                   \
+} while (0)
+
+// NOTE: Item ids are unique across the fixture and encode the table and pool, 0 is used for no drop
+static Void GenerateDropPool(
+    Int32* Seed,
+    ArrayRef DropPool,
+    Int32 TableIndex,
+    Int32 PoolIndex,
+    Int32 ItemCount,
+    Bool IsLevelFiltered
+) {
+    for (Int32 Index = 0; Index < ItemCount; Index += 1) {
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayAppendUninitializedElement(DropPool);
+        memset(DropItem, 0, sizeof(struct _RTDropItem));
+        DropItem->ItemID.ID = (UInt32)(((TableIndex * (DROP_TEST_SPECIES_COUNT + 1) + PoolIndex) << 8) + Index + 1);
+        DropItem->DropRate = RandomRange(Seed, 1, DROP_TEST_MAX_DROP_RATE);
+
+        // NOTE: A few rare items check the low end of the alias thresholds
+        if (RandomRange(Seed, 0, 7) == 0) DropItem->DropRate = RandomRange(Seed, 1, 1000);
+
+        if (IsLevelFiltered) {
+            DropItem->MinMobLevel = RandomRange(Seed, 1, DROP_TEST_MAX_MOB_LEVEL - 20);
+            DropItem->MaxMobLevel = MIN(DROP_TEST_MAX_MOB_LEVEL, DropItem->MinMobLevel + RandomRange(Seed, 0, 60));
+        }
+        else {
+            DropItem->MinMobLevel = 1;
+            DropItem->MaxMobLevel = DROP_TEST_MAX_MOB_LEVEL;
+        }
+    }
+}
+
+static Void CreateFixture(
+    RTRuntimeRef Runtime,
+    Int32* Seed,
+    struct _DropTestFixture* Fixture
+) {
+    for (Int32 TableIndex = 0; TableIndex < DROP_TEST_TABLE_COUNT; TableIndex += 1) {
+        RTDropTableRef DropTable = &Fixture->DropTables[TableIndex];
+        memset(DropTable, 0, sizeof(struct _RTDropTable));
+        DropTable->WorldDropPool = ArrayCreateEmpty(Runtime->Allocator, sizeof(struct _RTDropItem), 8);
+        DropTable->MobDropPool = IndexDictionaryCreate(Runtime->Allocator, 8);
+        GenerateDropPool(Seed, DropTable->WorldDropPool, TableIndex, 0, DROP_TEST_WORLD_ITEM_COUNT, true);
+
+        // NOTE: Every table leaves out a different species to cover missing species pools in the chain
+        for (Int DropPoolIndex = 1; DropPoolIndex <= DROP_TEST_SPECIES_COUNT; DropPoolIndex += 1) {
+            if (DropPoolIndex == TableIndex + 1) continue;
+
+            struct _Array TempArray = { 0 };
+            DictionaryInsert(DropTable->MobDropPool, &DropPoolIndex, &TempArray, sizeof(struct _Array));
+            ArrayRef DropPool = (ArrayRef)DictionaryLookup(DropTable->MobDropPool, &DropPoolIndex);
+            ArrayInitializeEmpty(DropPool, Runtime->Allocator, sizeof(struct _RTDropItem), 8);
+            GenerateDropPool(Seed, DropPool, TableIndex, (Int32)DropPoolIndex, DROP_TEST_SPECIES_ITEM_COUNT, false);
+        }
+
+        RTDropTableCompile(Runtime, DropTable);
+    }
+}
+
+static Void DestroyFixture(
+    RTRuntimeRef Runtime,
+    struct _DropTestFixture* Fixture
+) {
+    for (Int32 TableIndex = 0; TableIndex < DROP_TEST_TABLE_COUNT; TableIndex += 1) {
+        RTDropTableRef DropTable = &Fixture->DropTables[TableIndex];
+        RTDropTableDestroyAliasPools(Runtime, DropTable);
+
+        DictionaryKeyIterator Iterator = DictionaryGetKeyIterator(DropTable->MobDropPool);
+        while (Iterator.Key) {
+            ArrayDealloc((ArrayRef)DictionaryLookup(DropTable->MobDropPool, Iterator.Key));
+            Iterator = DictionaryKeyIteratorNext(Iterator);
+        }
+
+        DictionaryDestroy(DropTable->MobDropPool);
+        ArrayDestroy(DropTable->WorldDropPool);
+    }
+}
+
+// NOTE: This is the cumulative scan the drop pools have been rolled with before they were compiled to alias tables
+static Bool LinearDropPoolRollItem(
+    Int32 DropRateValue,
+    Int64* DropRateOffset,
+    ArrayRef DropPool,
+    Int32 MobLevel,
+    RTDropResultRef Result
+) {
+    for (Int DropIndex = 0; DropIndex < ArrayGetElementCount(DropPool); DropIndex += 1) {
+        RTDropItemRef DropItem = (RTDropItemRef)ArrayGetElementAtIndex(DropPool, DropIndex);
+        if (MobLevel > 0 && DropItem->MinMobLevel > MobLevel) continue;
+        if (MobLevel > 0 && DropItem->MaxMobLevel < MobLevel) continue;
+        if (DropRateValue <= *DropRateOffset + DropItem->DropRate) {
+            Result->ItemID = DropItem->ItemID;
+            return true;
+        }
+
+        *DropRateOffset += DropItem->DropRate;
+    }
+
+    return false;
+}
+
+static UInt32 LinearRollItem(
+    Int32* Seed,
+    struct _DropTestFixture* Fixture,
+    Int DropPoolIndex,
+    Int32 MobLevel
+) {
+    RTDropResult Result = { 0 };
+    Int32 DropRateValue = RandomRange(Seed, 0, INT32_MAX);
+    Int64 DropRateOffset = 0;
+
+    for (Int32 TableIndex = 0; TableIndex < DROP_TEST_TABLE_COUNT; TableIndex += 1) {
+        RTDropTableRef DropTable = &Fixture->DropTables[TableIndex];
+        ArrayRef DropPool = (ArrayRef)DictionaryLookup(DropTable->MobDropPool, &DropPoolIndex);
+        if (DropPool && LinearDropPoolRollItem(DropRateValue, &DropRateOffset, DropPool, 0, &Result)) return Result.ItemID.ID;
+        if (LinearDropPoolRollItem(DropRateValue, &DropRateOffset, DropTable->WorldDropPool, MobLevel, &Result)) return Result.ItemID.ID;
+    }
+
+    return 0;
+}
+
+static UInt32 AliasRollItem(
+    RTRuntimeRef Runtime,
+    Int32* Seed,
+    struct _DropTestFixture* Fixture,
+    Int DropPoolIndex,
+    Int32 MobLevel
+) {
+    RTDropResult Result = { 0 };
+    Int32 DropRateValue = RandomRange(Seed, 0, INT32_MAX);
+    Int64 DropRateOffset = 0;
+
+    for (Int32 TableIndex = 0; TableIndex < DROP_TEST_TABLE_COUNT; TableIndex += 1) {
+        if (RTDropTableRollItem(Runtime, &Fixture->DropTables[TableIndex], Seed, DropRateValue, &DropRateOffset, DropPoolIndex, MobLevel, &Result)) return Result.ItemID.ID;
+    }
+
+    return 0;
+}
+
+static Int32 GetCategoryIndex(
+    UInt32 ItemID
+) {
+    return (ItemID > 0) ? (Int32)ItemID - 1 : DROP_TEST_MAX_CATEGORY_COUNT - 1;
+}
+
+// NOTE: Compares the samples of both methods with a two sample chi-square test, categories with too few
+//       samples are merged and the bound is placed about six standard deviations above the degrees of freedom
+static Void TestDistribution(
+    RTRuntimeRef Runtime,
+    Int32* Seed,
+    struct _DropTestFixture* Fixture,
+    Int DropPoolIndex,
+    Int32 MobLevel,
+    Int32* LinearCounts,
+    Int32* AliasCounts
+) {
+    memset(LinearCounts, 0, sizeof(Int32) * DROP_TEST_MAX_CATEGORY_COUNT);
+    memset(AliasCounts, 0, sizeof(Int32) * DROP_TEST_MAX_CATEGORY_COUNT);
+
+    for (Int32 Index = 0; Index < DROP_TEST_SAMPLE_COUNT; Index += 1) {
+        LinearCounts[GetCategoryIndex(LinearRollItem(Seed, Fixture, DropPoolIndex, MobLevel))] += 1;
+        AliasCounts[GetCategoryIndex(AliasRollItem(Runtime, Seed, Fixture, DropPoolIndex, MobLevel))] += 1;
+    }
+
+    Float64 ChiSquare = 0.0;
+    Int32 CategoryCount = 0;
+    Int32 MergedLinearCount = 0;
+    Int32 MergedAliasCount = 0;
+    for (Int32 Index = 0; Index < DROP_TEST_MAX_CATEGORY_COUNT; Index += 1) {
+        Int32 Count = LinearCounts[Index] + AliasCounts[Index];
+        if (Count < 1) continue;
+
+        if (Count < DROP_TEST_MIN_CATEGORY_COUNT) {
+            MergedLinearCount += LinearCounts[Index];
+            MergedAliasCount += AliasCounts[Index];
+            continue;
+        }
+
+        Float64 Difference = (Float64)LinearCounts[Index] - (Float64)AliasCounts[Index];
+        ChiSquare += Difference * Difference / Count;
+        CategoryCount += 1;
+    }
+
+    if (MergedLinearCount + MergedAliasCount > 0) {
+        Float64 Difference = (Float64)MergedLinearCount - (Float64)MergedAliasCount;
+        ChiSquare += Difference * Difference / (MergedLinearCount + MergedAliasCount);
+        CategoryCount += 1;
+    }
+
+    Int32 DegreesOfFreedom = MAX(1, CategoryCount - 1);
+    Float64 Bound = DegreesOfFreedom + 6.0 * sqrt(2.0 * DegreesOfFreedom);
+    printf(
+        "Species %d at mob level %d: chi-square %.2f with %d degree(s) of freedom, bound %.2f, drop rate %.4f\n",
+        (Int32)DropPoolIndex,
+        MobLevel,
+        ChiSquare,
+        DegreesOfFreedom,
+        Bound,
+        1.0 - (Float64)AliasCounts[DROP_TEST_MAX_CATEGORY_COUNT - 1] / DROP_TEST_SAMPLE_COUNT
+    );
+
+    DROP_TEST_EXPECT(ChiSquare <= Bound, "Species %d at mob level %d differs from the linear scan", (Int32)DropPoolIndex, MobLevel);
+}
+
+static Void TestBuckets(
+    struct _DropTestFixture* Fixture
+) {
+    for (Int32 TableIndex = 0; TableIndex < DROP_TEST_TABLE_COUNT; TableIndex += 1) {
+        RTDropAliasPoolRef AliasPool = Fixture->DropTables[TableIndex].WorldDropAliasPool;
+        DROP_TEST_EXPECT(AliasPool, "Table %d has no compiled world pool", TableIndex);
+        if (!AliasPool) continue;
+
+        DROP_TEST_EXPECT(AliasPool->BucketCount > 4, "Table %d has only %d mob level bucket(s)", TableIndex, AliasPool->BucketCount);
+
+        for (Int32 BucketIndex = 0; BucketIndex < AliasPool->BucketCount; BucketIndex += 1) {
+            RTDropAliasBucketRef Bucket = &AliasPool->Buckets[BucketIndex];
+            for (Int32 Index = 0; Index < Bucket->EntryCount; Index += 1) {
+                RTDropAliasEntryRef Entry = &AliasPool->Entries[Bucket->EntryOffset + Index];
+                DROP_TEST_EXPECT(Entry->AliasIndex >= 0 && Entry->AliasIndex < Bucket->EntryCount, "Table %d bucket %d has an alias out of bounds", TableIndex, BucketIndex);
+            }
+        }
+    }
+}
+
+Int32 main(Int32 ArgumentCount, CString* Arguments) {
+    Int32 Seed = (ArgumentCount > 1) ? atoi(Arguments[1]) : 0x5EED;
+    Int32 MobLevels[] = { 1, 12, 35, 60, 90, 120, DROP_TEST_MAX_MOB_LEVEL, DROP_TEST_MAX_MOB_LEVEL + 40 };
+    Int32* LinearCounts = (Int32*)malloc(sizeof(Int32) * DROP_TEST_MAX_CATEGORY_COUNT);
+    Int32* AliasCounts = (Int32*)malloc(sizeof(Int32) * DROP_TEST_MAX_CATEGORY_COUNT);
+    RTRuntimeRef Runtime = (RTRuntimeRef)calloc(1, sizeof(struct _RTRuntime));
+    if (!LinearCounts || !AliasCounts || !Runtime) return EXIT_FAILURE;
+
+    // NOTE: Compiling the fixture only needs the allocator as long as no drop item references an option pool
+    Runtime->Allocator = AllocatorGetSystemDefault();
+
+    struct _DropTestFixture Fixture = { 0 };
+    printf("Drop alias test with seed %d\n", Seed);
+    CreateFixture(Runtime, &Seed, &Fixture);
+    TestBuckets(&Fixture);
+
+    for (Int DropPoolIndex = 1; DropPoolIndex <= DROP_TEST_SPECIES_COUNT; DropPoolIndex += 1) {
+        for (Int32 Index = 0; Index < (Int32)(sizeof(MobLevels) / sizeof(MobLevels[0])); Index += 1) {
+            TestDistribution(Runtime, &Seed, &Fixture, DropPoolIndex, MobLevels[Index], LinearCounts, AliasCounts);
+        }
+    }
+
+    DestroyFixture(Runtime, &Fixture);
+    free(Runtime);
+    free(AliasCounts);
+    free(LinearCounts);
+    printf("%d failure(s)\n", FailureCount);
+    return (FailureCount > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
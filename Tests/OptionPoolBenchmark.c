@@ -0,0 +1,164 @@
+#include "RuntimeLib/Runtime.h"
+#include "RuntimeLib/Drop.h"
+#include "RuntimeLib/OptionPool.h"
+
+// NOTE: Rolls drop options like RTDropAliasPoolRollItem does, once through the item type tables resolved
+//       when the drop tables are compiled and once with a cached table lookup per roll for comparison
+
+#define OPTION_POOL_BENCHMARK_POOL_COUNT            16
+#define OPTION_POOL_BENCHMARK_ITEM_TYPE_COUNT       24
+#define OPTION_POOL_BENCHMARK_ITEM_LEVEL_COUNT      16
+#define OPTION_POOL_BENCHMARK_EPIC_LEVEL_COUNT      6
+#define OPTION_POOL_BENCHMARK_EPIC_OPTION_COUNT     20
+#define OPTION_POOL_BENCHMARK_FORCE_SLOT_COUNT      5
+#define OPTION_POOL_BENCHMARK_FORCE_OPTION_COUNT    30
+
+struct _OptionPoolBenchmarkDrop {
+    Int32 OptionPoolIndex;
+    Int32 ItemType;
+    RTOptionPoolItemTypeTableRef ItemTypeTable;
+};
+typedef struct _OptionPoolBenchmarkDrop* OptionPoolBenchmarkDropRef;
+
+// NOTE: Every value table gets rates that add up to 100% with a falling chance for higher values
+static Void AddValueRates(
+    Int32* Seed,
+    Float64* Rates,
+    Int32 Count
+) {
+    Float64 TotalRate = 0.0;
+    for (Int32 Index = 0; Index < Count; Index += 1) {
+        Rates[Index] = (Float64)RandomRange(Seed, 1, 1000) / (Index + 1);
+        TotalRate += Rates[Index];
+    }
+
+    for (Int32 Index = 0; Index < Count; Index += 1) {
+        Rates[Index] = Rates[Index] / TotalRate * 100.0;
+    }
+}
+
+static Void CreateOptionPools(
+    RTOptionPoolManagerRef OptionPoolManager,
+    Int32* Seed
+) {
+    Float64 Rates[OPTION_POOL_BENCHMARK_FORCE_OPTION_COUNT] = { 0 };
+
+    for (Int PoolIndex = 1; PoolIndex <= OPTION_POOL_BENCHMARK_POOL_COUNT; PoolIndex += 1) {
+        AddValueRates(Seed, Rates, OPTION_POOL_BENCHMARK_ITEM_LEVEL_COUNT);
+        for (Int32 Level = 0; Level < OPTION_POOL_BENCHMARK_ITEM_LEVEL_COUNT; Level += 1) {
+            RTOptionPoolManagerAddItemLevel(OptionPoolManager, PoolIndex, Level, Rates[Level]);
+        }
+
+        AddValueRates(Seed, Rates, OPTION_POOL_BENCHMARK_EPIC_LEVEL_COUNT);
+        for (Int32 Level = 0; Level < OPTION_POOL_BENCHMARK_EPIC_LEVEL_COUNT; Level += 1) {
+            RTOptionPoolManagerAddEpicLevel(OptionPoolManager, PoolIndex, Level, Rates[Level]);
+        }
+
+        AddValueRates(Seed, Rates, OPTION_POOL_BENCHMARK_FORCE_SLOT_COUNT);
+        for (Int32 Count = 0; Count < OPTION_POOL_BENCHMARK_FORCE_SLOT_COUNT; Count += 1) {
+            RTOptionPoolManagerAddForceSlot(OptionPoolManager, PoolIndex, Count, Rates[Count]);
+        }
+
+        AddValueRates(Seed, Rates, OPTION_POOL_BENCHMARK_FORCE_SLOT_COUNT);
+        for (Int32 Count = 0; Count < OPTION_POOL_BENCHMARK_FORCE_SLOT_COUNT; Count += 1) {
+            RTOptionPoolManagerAddForceOptionSlot(OptionPoolManager, PoolIndex, Count, Rates[Count]);
+        }
+
+        for (Int32 ItemType = 1; ItemType <= OPTION_POOL_BENCHMARK_ITEM_TYPE_COUNT; ItemType += 1) {
+            for (Int32 Level = 1; Level < OPTION_POOL_BENCHMARK_EPIC_LEVEL_COUNT; Level += 1) {
+                AddValueRates(Seed, Rates, OPTION_POOL_BENCHMARK_EPIC_OPTION_COUNT);
+                for (Int32 Index = 0; Index < OPTION_POOL_BENCHMARK_EPIC_OPTION_COUNT; Index += 1) {
+                    RTOptionPoolManagerAddEpicOption(OptionPoolManager, PoolIndex, ItemType, Level, Index + 1, Rates[Index]);
+                }
+            }
+
+            AddValueRates(Seed, Rates, OPTION_POOL_BENCHMARK_FORCE_OPTION_COUNT);
+            for (Int32 Index = 0; Index < OPTION_POOL_BENCHMARK_FORCE_OPTION_COUNT; Index += 1) {
+                RTOptionPoolManagerAddForceOption(OptionPoolManager, PoolIndex, ItemType, Index + 1, Rates[Index]);
+            }
+        }
+    }
+
+    RTOptionPoolManagerCompile(OptionPoolManager);
+}
+
+static UInt64 RollDrops(
+    RTOptionPoolManagerRef OptionPoolManager,
+    OptionPoolBenchmarkDropRef Drops,
+    Int32 DropCount,
+    Int32 RollCount,
+    Int32 Seed,
+    Bool IsResolved,
+    Timestamp* Duration
+) {
+    UInt64 Checksum = 0;
+    Timestamp StartTimestamp = PlatformGetTickCountUs();
+    for (Int32 Index = 0; Index < RollCount; Index += 1) {
+        OptionPoolBenchmarkDropRef Drop = &Drops[Index % DropCount];
+        RTOptionPoolItemTypeTableRef ItemTypeTable = (IsResolved) ? Drop->ItemTypeTable : RTOptionPoolManagerGetItemTypeTable(OptionPoolManager, Drop->OptionPoolIndex, Drop->ItemType);
+
+        RTDropResult Result = { 0 };
+        RTOptionPoolManagerCalculateOptions(ItemTypeTable, &Seed, &Result);
+        Checksum += Result.ItemID.Serial ^ Result.ItemOptions;
+    }
+    *Duration = PlatformGetTickCountUs() - StartTimestamp;
+
+    return Checksum;
+}
+
+Int32 main(Int32 ArgumentCount, CString* Arguments) {
+    Int32 RollCount = (ArgumentCount > 1) ? atoi(Arguments[1]) : 1000000;
+    Int32 Seed = (ArgumentCount > 2) ? atoi(Arguments[2]) : 0x5EED;
+    if (RollCount < 1) {
+        fprintf(stderr, "Usage: %s [RollCount] [Seed]\n", Arguments[0]);
+        return EXIT_FAILURE;
+    }
+
+    Int32 DropCount = OPTION_POOL_BENCHMARK_POOL_COUNT * OPTION_POOL_BENCHMARK_ITEM_TYPE_COUNT;
+    OptionPoolBenchmarkDropRef Drops = (OptionPoolBenchmarkDropRef)calloc(DropCount, sizeof(struct _OptionPoolBenchmarkDrop));
+    if (!Drops) return EXIT_FAILURE;
+
+    RTOptionPoolManagerRef OptionPoolManager = RTOptionPoolManagerCreate(AllocatorGetSystemDefault());
+    CreateOptionPools(OptionPoolManager, &Seed);
+
+    // NOTE: The drops are shuffled to keep the tables from being rolled in the order they are stored
+    for (Int32 Index = 0; Index < DropCount; Index += 1) {
+        Drops[Index].OptionPoolIndex = Index / OPTION_POOL_BENCHMARK_ITEM_TYPE_COUNT + 1;
+        Drops[Index].ItemType = Index % OPTION_POOL_BENCHMARK_ITEM_TYPE_COUNT + 1;
+    }
+
+    for (Int32 Index = DropCount - 1; Index > 0; Index -= 1) {
+        Int32 SwapIndex = RandomRange(&Seed, 0, Index);
+        struct _OptionPoolBenchmarkDrop Drop = Drops[Index];
+        Drops[Index] = Drops[SwapIndex];
+        Drops[SwapIndex] = Drop;
+    }
+
+    Timestamp ResolveTimestamp = PlatformGetTickCountUs();
+    for (Int32 Index = 0; Index < DropCount; Index += 1) {
+        Drops[Index].ItemTypeTable = RTOptionPoolManagerGetItemTypeTable(OptionPoolManager, Drops[Index].OptionPoolIndex, Drops[Index].ItemType);
+        if (!Drops[Index].ItemTypeTable) return EXIT_FAILURE;
+    }
+    Timestamp ResolveDuration = PlatformGetTickCountUs() - ResolveTimestamp;
+
+    Timestamp ResolvedDuration = 0;
+    Timestamp LookupDuration = 0;
+    UInt64 ResolvedChecksum = RollDrops(OptionPoolManager, Drops, DropCount, RollCount, Seed, true, &ResolvedDuration);
+    UInt64 LookupChecksum = RollDrops(OptionPoolManager, Drops, DropCount, RollCount, Seed, false, &LookupDuration);
+
+    printf("Rolls: %d, Option pools: %d, Item types: %d\n", RollCount, OPTION_POOL_BENCHMARK_POOL_COUNT, OPTION_POOL_BENCHMARK_ITEM_TYPE_COUNT);
+    printf("Resolve: %d item type tables in %.3f ms\n", DropCount, ResolveDuration / 1e3);
+    printf("Resolved tables: %.1f ms total, %.1f ns/roll\n", ResolvedDuration / 1e3, ResolvedDuration * 1e3 / RollCount);
+    printf("Lookup per roll: %.1f ms total, %.1f ns/roll\n", LookupDuration / 1e3, LookupDuration * 1e3 / RollCount);
+
+    RTOptionPoolManagerDestroy(OptionPoolManager);
+    free(Drops);
+
+    // NOTE: Both runs share the seed and have to roll the same options
+    if (ResolvedChecksum != LookupChecksum) {
+        fprintf(stderr, "Checksum mismatch between resolved tables and lookups\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
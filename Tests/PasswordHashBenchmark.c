@@ -0,0 +1,107 @@
+#include "LoginSvr/PasswordHash.h"
+
+// NOTE: Simulates a login storm where every client of a burst submits its password at the same time,
+//       the hashes are computed on the libuv worker pool like in the AUTHENTICATE handler
+
+struct _PasswordHashBenchmarkJob {
+    uv_work_t Request;
+    UInt64 SubmitTimestamp;
+    UInt64 CompleteTimestamp;
+    Int32 Iterations;
+    Bool Success;
+    Char Password[32];
+    UInt8 Salt[PASSWORD_SALT_LENGTH];
+    UInt8 PasswordHash[PASSWORD_HASH_LENGTH];
+};
+typedef struct _PasswordHashBenchmarkJob* PasswordHashBenchmarkJobRef;
+
+static Void PasswordHashBenchmarkOnWork(
+    uv_work_t* Request
+) {
+    PasswordHashBenchmarkJobRef Job = (PasswordHashBenchmarkJobRef)Request->data;
+    Job->Success = PasswordComputeHash(Job->Password, (Int32)strlen(Job->Password), Job->Salt, Job->Iterations, Job->PasswordHash);
+}
+
+static Void PasswordHashBenchmarkOnComplete(
+    uv_work_t* Request,
+    Int32 Status
+) {
+    PasswordHashBenchmarkJobRef Job = (PasswordHashBenchmarkJobRef)Request->data;
+    Job->CompleteTimestamp = uv_hrtime();
+}
+
+static Int32 CompareLatency(
+    const Void* Lhs,
+    const Void* Rhs
+) {
+    UInt64 A = *(const UInt64*)Lhs;
+    UInt64 B = *(const UInt64*)Rhs;
+    return (A > B) - (A < B);
+}
+
+Int32 main(Int32 ArgumentCount, CString* Arguments) {
+    Int32 LoginCount = (ArgumentCount > 1) ? atoi(Arguments[1]) : 1000;
+    Int32 Iterations = (ArgumentCount > 2) ? atoi(Arguments[2]) : 1000;
+    if (LoginCount < 1 || Iterations < 0) {
+        fprintf(stderr, "Usage: %s [LoginCount] [Iterations]\n", Arguments[0]);
+        return EXIT_FAILURE;
+    }
+
+    PasswordHashBenchmarkJobRef Jobs = (PasswordHashBenchmarkJobRef)calloc(LoginCount, sizeof(struct _PasswordHashBenchmarkJob));
+    UInt64* Latencies = (UInt64*)calloc(LoginCount, sizeof(UInt64));
+    if (!Jobs || !Latencies) return EXIT_FAILURE;
+
+    for (Int32 Index = 0; Index < LoginCount; Index += 1) {
+        PasswordHashBenchmarkJobRef Job = &Jobs[Index];
+        Job->Request.data = Job;
+        Job->Iterations = Iterations;
+        snprintf(Job->Password, sizeof(Job->Password), "Password%d", Index);
+        if (!PasswordGenerateSalt(Job->Salt)) return EXIT_FAILURE;
+    }
+
+    // NOTE: Inline hashing blocks the network loop for the whole burst
+    UInt64 InlineTimestamp = uv_hrtime();
+    for (Int32 Index = 0; Index < LoginCount; Index += 1) {
+        PasswordHashBenchmarkOnWork(&Jobs[Index].Request);
+    }
+    UInt64 InlineDuration = uv_hrtime() - InlineTimestamp;
+
+    uv_loop_t* Loop = uv_default_loop();
+    UInt64 StormTimestamp = uv_hrtime();
+    for (Int32 Index = 0; Index < LoginCount; Index += 1) {
+        PasswordHashBenchmarkJobRef Job = &Jobs[Index];
+        Job->SubmitTimestamp = uv_hrtime();
+        if (uv_queue_work(Loop, &Job->Request, PasswordHashBenchmarkOnWork, PasswordHashBenchmarkOnComplete) != 0) return EXIT_FAILURE;
+    }
+    UInt64 SubmitDuration = uv_hrtime() - StormTimestamp;
+
+    uv_run(Loop, UV_RUN_DEFAULT);
+    UInt64 StormDuration = uv_hrtime() - StormTimestamp;
+
+    Int32 FailureCount = 0;
+    for (Int32 Index = 0; Index < LoginCount; Index += 1) {
+        FailureCount += (Jobs[Index].Success) ? 0 : 1;
+        Latencies[Index] = Jobs[Index].CompleteTimestamp - Jobs[Index].SubmitTimestamp;
+    }
+
+    qsort(Latencies, LoginCount, sizeof(UInt64), CompareLatency);
+
+    printf("Logins: %d, Iterations: %d, Failures: %d\n", LoginCount, Iterations, FailureCount);
+    printf("Inline: %.1f ms total, %.1f logins/s, loop blocked %.1f ms\n",
+        InlineDuration / 1e6,
+        LoginCount / (InlineDuration / 1e9),
+        InlineDuration / 1e6
+    );
+    printf("Worker pool: %.1f ms total, %.1f logins/s, loop blocked %.3f ms, latency p50 %.1f ms, p99 %.1f ms\n",
+        StormDuration / 1e6,
+        LoginCount / (StormDuration / 1e9),
+        SubmitDuration / 1e6,
+        Latencies[LoginCount / 2] / 1e6,
+        Latencies[(LoginCount * 99) / 100] / 1e6
+    );
+
+    uv_loop_close(Loop);
+    free(Latencies);
+    free(Jobs);
+    return (FailureCount > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+#include "LoginSvr/PasswordHash.h"
+
+// NOTE: The expected hashes are the results of the HashPassword procedure, they can be reproduced with
+//       CALL HashPassword(Password, UNHEX(Salt), Iterations, @Hash); SELECT HEX(@Hash);
+struct _PasswordHashTestVector {
+    CString Password;
+    CString Salt;
+    Int32 Iterations;
+    CString Hash;
+};
+
+static const struct _PasswordHashTestVector kPasswordHashTestVectors[] = {
+    {
+        "password",
+        "000102030405060708090a0b0c0d0e0f",
+        0,
+        "000102030405060708090a0b0c0d0e0f"
+        "98af4a6657daae51b9bbb018268b49102194980f9476399c71ff519e49fff35e"
+        "e0e2a8daade0ad8e930f0654140e5f4ece8a62b7b911efb9cef31e06a112ed54"
+    },
+    {
+        "password",
+        "000102030405060708090a0b0c0d0e0f",
+        1,
+        "000102030405060708090a0b0c0d0e0f"
+        "804252456340e543bbcefd0818b6d64abb97d82dd6139ab443ef0c519fc58e49"
+        "870c0a1e5ad8ceb4e0954ce2401cb6462ef3144a1fdb11c748553e9d4a05dec1"
+    },
+    {
+        "Breaklee#2024",
+        "9f3a61c2d48e07b5a1f0c6e3b2d97a44",
+        1000,
+        "9f3a61c2d48e07b5a1f0c6e3b2d97a44"
+        "1697e354b2c9965ce71827ac6444669f1ae299e807fa6aab756cfb2568104da7"
+        "8ce20b30a0c756d52d0dfcb6a98e2496f7f322b598b6b077d8595ef0d17ad516"
+    },
+    {
+        "",
+        "ffffffffffffffffffffffffffffffff",
+        1000,
+        "ffffffffffffffffffffffffffffffff"
+        "70caf3c975285bef41a495a15d49c385aaa8bfc04b2dfe8575fb87893c5d83b2"
+        "0313c433f752cf04a9a78953c64a302e667043f5466f7ed86dacfbbf72030061"
+    },
+    {
+        "AAAAAAAAAAAAAAAA",
+        "00000000000000000000000000000000",
+        1000,
+        "00000000000000000000000000000000"
+        "868dbcd541e9762d9e911706e87d8ba6038f3204ecc020d21151ea2ba58edb40"
+        "357201879ef401fe65dd28a62245d74efa2f2ed5c2a05f91b64a16a6506a72c1"
+    },
+};
+
+static Void ParseHex(
+    CString Hex,
+    UInt8* Buffer,
+    Int32 Length
+) {
+    assert((Int32)strlen(Hex) == Length * 2);
+
+    for (Int32 Index = 0; Index < Length; Index += 1) {
+        UInt32 Value = 0;
+        sscanf(&Hex[Index * 2], "%2x", &Value);
+        Buffer[Index] = (UInt8)Value;
+    }
+}
+
+Int32 main(Int32 ArgumentCount, CString* Arguments) {
+    Int32 FailureCount = 0;
+    Int32 VectorCount = sizeof(kPasswordHashTestVectors) / sizeof(kPasswordHashTestVectors[0]);
+
+    for (Int32 Index = 0; Index < VectorCount; Index += 1) {
+        const struct _PasswordHashTestVector* Vector = &kPasswordHashTestVectors[Index];
+        UInt8 Salt[PASSWORD_SALT_LENGTH] = { 0 };
+        UInt8 ExpectedHash[PASSWORD_HASH_LENGTH] = { 0 };
+        UInt8 Hash[PASSWORD_HASH_LENGTH] = { 0 };
+        ParseHex(Vector->Salt, Salt, PASSWORD_SALT_LENGTH);
+        ParseHex(Vector->Hash, ExpectedHash, PASSWORD_HASH_LENGTH);
+
+        Bool Success = PasswordComputeHash(Vector->Password, (Int32)strlen(Vector->Password), Salt, Vector->Iterations, Hash);
+        if (!Success || memcmp(Hash, ExpectedHash, PASSWORD_HASH_LENGTH) != 0) {
+            fprintf(stderr, "Password hash mismatch for vector %d (\"%s\", %d iterations)\n", Index, Vector->Password, Vector->Iterations);
+            FailureCount += 1;
+        }
+    }
+
+    // NOTE: Generated salts are stored as the prefix of the hash and have to differ between accounts
+    UInt8 SaltA[PASSWORD_SALT_LENGTH] = { 0 };
+    UInt8 SaltB[PASSWORD_SALT_LENGTH] = { 0 };
+    if (!PasswordGenerateSalt(SaltA) || !PasswordGenerateSalt(SaltB) || memcmp(SaltA, SaltB, PASSWORD_SALT_LENGTH) == 0) {
+        fprintf(stderr, "Password salt generation failed\n");
+        FailureCount += 1;
+    }
+
+    printf("%d of %d password hash checks passed\n", VectorCount + 1 - FailureCount, VectorCount + 1);
+    return (FailureCount > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
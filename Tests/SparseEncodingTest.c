@@ -0,0 +1,199 @@
+#include "RuntimeLib/Party.h"
+
+#define SPARSE_TEST_ITERATION_COUNT     2000
+#define SPARSE_TEST_TRUNCATION_COUNT    64
+#define SPARSE_TEST_MUTATION_COUNT      64
+#define SPARSE_TEST_GUARD_LENGTH        64
+#define SPARSE_TEST_GUARD_VALUE         0xCD
+
+// NOTE: The party is decoded into a buffer with a guard tail to detect writes past the destination struct
+struct _SparseTestParty {
+    struct _RTParty Party;
+    UInt8 Guard[SPARSE_TEST_GUARD_LENGTH];
+};
+
+static Int32 FailureCount = 0;
+
+#define SPARSE_TEST_EXPECT(__CONDITION__, ...)          \
+do {                                                    \
+    if (!(__CONDITION__)) {                             \
+        fprintf(stderr, __VA_ARGS__);                   \
+        fprintf(stderr, "\n");                          \
+        FailureCount += 1;                              \
+    }                                                   \
+} while (0)
+
+static Void FillRandom(
+    Int32* Seed,
+    Void* Memory,
+    Int32 Length
+) {
+    for (Int32 Index = 0; Index < Length; Index += 1) {
+        ((UInt8*)Memory)[Index] = (UInt8)RandomRange(Seed, 0, 255);
+    }
+}
+
+static Void GenerateParty(
+    Int32* Seed,
+    RTPartyRef Party
+) {
+    memset(Party, 0, sizeof(struct _RTParty));
+    FillRandom(Seed, &Party->ID, sizeof(Party->ID));
+    Party->LeaderCharacterIndex = RandomRange(Seed, 1, INT32_MAX - 1);
+    Party->WorldServerIndex = RandomRange(Seed, 0, 32);
+    Party->PartyType = RandomRange(Seed, RUNTIME_PARTY_TYPE_NORMAL, RUNTIME_PARTY_TYPE_SOLO_DUNGEON);
+    Party->MemberCount = RandomRange(Seed, 0, RUNTIME_PARTY_MAX_MEMBER_COUNT);
+    for (Int32 Index = 0; Index < Party->MemberCount; Index += 1) {
+        FillRandom(Seed, &Party->Members[Index], sizeof(struct _RTPartyMemberInfo));
+    }
+
+    // NOTE: Uncounted arrays keep zero elements in between and only trim the trailing ones
+    Int32 InventoryCount = RandomRange(Seed, 0, RUNTIME_PARTY_MAX_INVENTORY_SLOT_COUNT);
+    for (Int32 Index = 0; Index < InventoryCount; Index += 1) {
+        if (RandomRange(Seed, 0, 3) == 0 && Index + 1 < InventoryCount) continue;
+
+        FillRandom(Seed, &Party->Inventory[Index], sizeof(struct _RTItemSlot));
+    }
+
+    Int32 QuestSlotCount = RandomRange(Seed, 0, RUNTIME_PARTY_MAX_QUEST_SLOT_COUNT);
+    for (Int32 Index = 0; Index < QuestSlotCount; Index += 1) {
+        if (RandomRange(Seed, 0, 3) == 0 && Index + 1 < QuestSlotCount) continue;
+
+        FillRandom(Seed, &Party->QuestSlot[Index], sizeof(struct _RTQuestSlot));
+    }
+}
+
+static Bool DecodeGuarded(
+    UInt8* Source,
+    Int32 SourceLength,
+    struct _SparseTestParty* Result
+) {
+    memset(Result->Guard, SPARSE_TEST_GUARD_VALUE, sizeof(Result->Guard));
+    Bool Success = SparseDecode(&kRTPartySchema, Source, SourceLength, &Result->Party);
+
+    for (Int32 Index = 0; Index < SPARSE_TEST_GUARD_LENGTH; Index += 1) {
+        SPARSE_TEST_EXPECT(Result->Guard[Index] == SPARSE_TEST_GUARD_VALUE, "Decoding wrote past the destination");
+        if (Result->Guard[Index] != SPARSE_TEST_GUARD_VALUE) break;
+    }
+
+    return Success;
+}
+
+static Void TestRoundTrip(
+    Int32* Seed,
+    UInt8* Buffer,
+    Int32 BufferLength
+) {
+    struct _RTParty Party = { 0 };
+    struct _SparseTestParty Result = { 0 };
+
+    for (Int32 Iteration = 0; Iteration < SPARSE_TEST_ITERATION_COUNT; Iteration += 1) {
+        GenerateParty(Seed, &Party);
+
+        Int32 Length = SparseEncode(&kRTPartySchema, &Party, Buffer, BufferLength);
+        SPARSE_TEST_EXPECT(Length > 0 && Length <= BufferLength, "Encoding failed with length %d", Length);
+        if (Length < 1) continue;
+
+        SPARSE_TEST_EXPECT(SparseEncode(&kRTPartySchema, &Party, Buffer, Length - 1) < 0, "Encoding into a short buffer succeeded");
+        SPARSE_TEST_EXPECT(SparseEncode(&kRTPartySchema, &Party, Buffer, BufferLength) == Length, "Encoding is not deterministic");
+
+        Bool Success = DecodeGuarded(Buffer, Length, &Result);
+        SPARSE_TEST_EXPECT(Success, "Decoding of iteration %d failed", Iteration);
+        SPARSE_TEST_EXPECT(!Success || memcmp(&Party, &Result.Party, sizeof(struct _RTParty)) == 0, "Round trip of iteration %d differs", Iteration);
+
+        // NOTE: Every truncated input has to be rejected, an overlong input as well
+        for (Int32 Index = 0; Index < SPARSE_TEST_TRUNCATION_COUNT; Index += 1) {
+            Int32 TruncatedLength = RandomRange(Seed, 0, Length - 1);
+            SPARSE_TEST_EXPECT(!DecodeGuarded(Buffer, TruncatedLength, &Result), "Truncated input of length %d was accepted", TruncatedLength);
+        }
+
+        Buffer[Length] = (UInt8)RandomRange(Seed, 0, 255);
+        SPARSE_TEST_EXPECT(!DecodeGuarded(Buffer, Length + 1, &Result), "Overlong input was accepted");
+
+        // NOTE: Corrupted input may decode to anything but has to stay within the bounds of source and destination
+        for (Int32 Index = 0; Index < SPARSE_TEST_MUTATION_COUNT; Index += 1) {
+            Int32 MutationOffset = RandomRange(Seed, 0, Length - 1);
+            UInt8 Value = Buffer[MutationOffset];
+            Buffer[MutationOffset] = (UInt8)RandomRange(Seed, 0, 255);
+            DecodeGuarded(Buffer, Length, &Result);
+            Buffer[MutationOffset] = Value;
+        }
+    }
+}
+
+static Void TestMemberCountBounds(
+    UInt8* Buffer,
+    Int32 BufferLength
+) {
+    struct _RTParty Party = { 0 };
+    struct _SparseTestParty Result = { 0 };
+    Int32 MemberCounts[] = { 0, RUNTIME_PARTY_MAX_MEMBER_COUNT, -1, RUNTIME_PARTY_MAX_MEMBER_COUNT + 1, INT32_MIN, INT32_MAX };
+
+    for (Int32 Index = 0; Index < (Int32)(sizeof(MemberCounts) / sizeof(MemberCounts[0])); Index += 1) {
+        Int32 Seed = Index + 1;
+        GenerateParty(&Seed, &Party);
+        Party.MemberCount = MemberCounts[Index];
+
+        Bool IsValid = MemberCounts[Index] >= 0 && MemberCounts[Index] <= RUNTIME_PARTY_MAX_MEMBER_COUNT;
+        if (IsValid) {
+            for (Int32 MemberIndex = 0; MemberIndex < RUNTIME_PARTY_MAX_MEMBER_COUNT; MemberIndex += 1) {
+                if (MemberIndex < Party.MemberCount) FillRandom(&Seed, &Party.Members[MemberIndex], sizeof(struct _RTPartyMemberInfo));
+                else memset(&Party.Members[MemberIndex], 0, sizeof(struct _RTPartyMemberInfo));
+            }
+        }
+
+        Int32 Length = SparseEncode(&kRTPartySchema, &Party, Buffer, BufferLength);
+        SPARSE_TEST_EXPECT(Length > 0, "Encoding with member count %d failed", MemberCounts[Index]);
+        if (Length < 1) continue;
+
+        Bool Success = DecodeGuarded(Buffer, Length, &Result);
+        SPARSE_TEST_EXPECT(Success == IsValid, "Decoding with member count %d returned %d", MemberCounts[Index], Success);
+        SPARSE_TEST_EXPECT(!Success || memcmp(&Party, &Result.Party, sizeof(struct _RTParty)) == 0, "Round trip with member count %d differs", MemberCounts[Index]);
+    }
+}
+
+// NOTE: Reports the payload of a PARTY_INFO notification for a party without inventory and quests,
+//       the payload used to be the whole struct and is now the length prefix followed by the encoding
+static Void ReportPartyInfoLength(
+    UInt8* Buffer,
+    Int32 BufferLength
+) {
+    struct _RTParty Party = { 0 };
+    Int32 Seed = 1;
+    Party.ID.Serial = 1;
+    Party.LeaderCharacterIndex = 1;
+    Party.WorldServerIndex = 1;
+
+    for (Int32 MemberCount = 1; MemberCount <= RUNTIME_PARTY_MAX_MEMBER_COUNT; MemberCount += 1) {
+        RTPartyMemberInfoRef Member = &Party.Members[MemberCount - 1];
+        Member->CharacterIndex = MemberCount;
+        Member->Level = RandomRange(&Seed, 1, 200);
+        Member->WorldIndex = RandomRange(&Seed, 1, 30);
+        Member->NameLength = (UInt8)snprintf(Member->Name, sizeof(Member->Name), "Member%d", MemberCount) + 1;
+        Party.MemberCount = MemberCount;
+
+        Int32 Length = SparseEncode(&kRTPartySchema, &Party, Buffer, BufferLength);
+        printf(
+            "PARTY_INFO payload with %d member(s): %d bytes raw, %d bytes encoded\n",
+            MemberCount,
+            (Int32)sizeof(struct _RTParty),
+            (Int32)sizeof(Int32) + Length
+        );
+    }
+}
+
+Int32 main(Int32 ArgumentCount, CString* Arguments) {
+    Int32 Seed = (ArgumentCount > 1) ? atoi(Arguments[1]) : 0x5EED;
+    Int32 BufferLength = SparseGetMaxEncodedLength(&kRTPartySchema);
+    UInt8* Buffer = (UInt8*)malloc(BufferLength + 1);
+    if (!Buffer) return EXIT_FAILURE;
+
+    printf("Sparse encoding test with seed %d\n", Seed);
+    TestRoundTrip(&Seed, Buffer, BufferLength);
+    TestMemberCountBounds(Buffer, BufferLength);
+    ReportPartyInfoLength(Buffer, BufferLength);
+
+    free(Buffer);
+    printf("%d failure(s)\n", FailureCount);
+    return (FailureCount > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -29,6 +29,7 @@ Void ClientSocketOnDisconnect(
     if (Client->CharacterIndex > 0) {
         RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(Context->Runtime->WorldManager, Client->CharacterIndex);
         if (Character) {
+            ServerInvalidatePartyGroup(Context, Character->PartyID);
             RTCharacterUpdateBuffs(Context->Runtime, Character, true);
             ServerSyncCharacter(Server, Context, Client, Character);
 
@@ -53,6 +54,8 @@ Void ClientSocketOnDisconnect(
         RequestChat->Header.Target.Type = IPC_TYPE_CHAT;
         RequestChat->CharacterIndex = Client->CharacterIndex;
         IPCSocketUnicast(Server->IPCSocket, RequestChat);
+
+        ServerUnregisterClientCharacter(Context, Client);
     }
     
     if (Client->AccountID > 0) {
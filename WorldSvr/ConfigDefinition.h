@@ -28,8 +28,14 @@ CONFIG_PARAMETER_ARRAY(Char, MAX_PATH, ScriptDataPath, "WorldSvr.ScriptDataPath"
 CONFIG_PARAMETER(UInt32, MinRollDiceValue, "WorldSvr.MinRollDiceValue", 0)
 CONFIG_PARAMETER(UInt32, MaxRollDiceValue, "WorldSvr.MaxRollDiceValue", 999)
 CONFIG_PARAMETER(UInt64, DBSyncTimer, "WorldSvr.DBSyncTimer", 1000)
+CONFIG_PARAMETER(Int32, DBSyncBudget, "WorldSvr.DBSyncBudget", 32)
 CONFIG_PARAMETER(UInt64, UserListBroadcastInterval, "WorldSvr.UserListBroadcastInterval", 1000)
 CONFIG_PARAMETER(UInt64, WorldItemDespawnInterval, "WorldSvr.WorldItemDespawnInterval", 30000)
+CONFIG_PARAMETER(Bool, IsPathFindingGraphEnabled, "WorldSvr.IsPathFindingGraphEnabled", 1)
+CONFIG_PARAMETER(UInt64, CharacterUpdateInterval, "WorldSvr.CharacterUpdateInterval", 50)
+CONFIG_PARAMETER(UInt64, MobUpdateInterval, "WorldSvr.MobUpdateInterval", 50)
+CONFIG_PARAMETER(UInt64, ItemUpdateInterval, "WorldSvr.ItemUpdateInterval", 1000)
+CONFIG_PARAMETER(UInt64, DungeonUpdateInterval, "WorldSvr.DungeonUpdateInterval", 100)
 CONFIG_PARAMETER(Int32, NewbieSupportTimeout, "Environment.NewbieSupportTimeout", 10080)
 CONFIG_PARAMETER(Int32, LogLevel, "WorldSvr.LogLevel", 5)
 CONFIG_END(WorldSvr)
@@ -92,6 +98,7 @@ CONFIG_PARAMETER(Int32, ReadBufferSize, "NetLib.ReadBufferSize", 0x20000)
 CONFIG_PARAMETER(Int32, WriteBufferSize, "NetLib.WriteBufferSize", 0x20000)
 CONFIG_PARAMETER(Int32, PacketBufferBacklogSize, "NetLib.PacketBufferBacklogSize", 8)
 CONFIG_PARAMETER(Bool, LogPackets, "NetLib.LogPackets", 0)
+CONFIG_PARAMETER(UInt16, MetricsPort, "NetLib.MetricsPort", 0)
 CONFIG_END(NetLib)
 
 #undef CONFIG_BEGIN
@@ -16,6 +16,22 @@ enum {
     CLIENT_FLAGS_VERIFIED_SUBPASSWORD_DELETION  = 1 << 5,
 };
 
+struct _ServerPartyGroupMember {
+    UInt32 CharacterIndex;
+    Int ConnectionID;
+    SocketConnectionRef Connection;
+};
+typedef struct _ServerPartyGroupMember* ServerPartyGroupMemberRef;
+
+struct _ServerPartyGroup {
+    RTEntityID PartyID;
+    Bool IsDirty;
+    Bool IsPartyDataQueued;
+    Int32 MemberCount;
+    struct _ServerPartyGroupMember Members[RUNTIME_PARTY_MAX_MEMBER_COUNT];
+};
+typedef struct _ServerPartyGroup* ServerPartyGroupRef;
+
 struct _ServerContext {
     ServerRef Server;
     SocketRef ClientSocket;
@@ -24,6 +40,9 @@ struct _ServerContext {
     RTRuntimeRef Runtime;
     Timestamp UserListBroadcastTimestamp;
     DictionaryRef ItemScriptRegistry;
+    DictionaryRef CharacterIndexToClient;
+    DictionaryRef PartyGroups;
+    ArrayRef PartyDataQueue;
 };
 typedef struct _ServerContext* ServerContextRef;
 
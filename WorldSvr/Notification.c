@@ -5,229 +5,210 @@
 #include "NotificationProcedures.h"
 
 Void SendRuntimeNotification(
+    RTRuntimeRef Runtime,
     SocketRef Socket,
     SocketConnectionRef Connection,
     RTNotificationRef Notification
 ) {
     Notification->Magic = SocketGetPacketMagic(Socket, false);
-    SocketSend(Socket, Connection, Notification);
+
+    // NOTE: Notifications flushed at the end of a tick are coalesced into a single write per connection
+    if (RTNotificationManagerIsFlushing(Runtime->NotificationManager)) {
+        SocketSendDeferred(Socket, Connection, Notification);
+    }
+    else {
+        SocketSend(Socket, Connection, Notification);
+    }
 }
 
 NOTIFICATION_PROCEDURE_BINDING(ERROR_CODE) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(OBJECTS_SPAWN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(OBJECTS_DESPAWN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTERS_SPAWN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        if (Party) SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_DESPAWN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        if (Party) SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOBS_SPAWN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOBS_DESPAWN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOBS_DESPAWN_LIST) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(ITEMS_SPAWN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(ITEMS_DESPAWN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_ITEM_EQUIP) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_ITEM_UNEQUIP) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_MOVE_BEGIN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_MOVE_END) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_CHASE_BEGIN) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_CHASE_END) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(SKILL_TO_CHARACTER) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(ATTACK_TO_MOB) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_BATTLE_RANK_UP) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_DATA) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_EVENT) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(DUNGEON_PATTERN_PART_COMPLETED) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(PARTY_QUEST_ACTION) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(PARTY_QUEST_LOOT_ITEM) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
  
 NOTIFICATION_PROCEDURE_BINDING(PARTY_QUEST_MISSION_MOB_KILL) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_SPECIAL_BUFF) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CREATE_ITEM) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_ATTACK_AOE) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHANGE_GENDER) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_SKILL_MASTERY_UPDATE) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_FORCE_WING_GRADE) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_FORCE_WING_UPDATE) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_FORCE_WING_EXP) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 
-    if (!RTEntityIsNull(Character->PartyID)) {
-        RTPartyRef Party = RTPartyManagerGetParty(Runtime->PartyManager, Character->PartyID);
-        SendPartyData(Context, Context->ClientSocket, Party);
-    }
+    ServerQueuePartyData(Context, Character->PartyID);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_PATTERN_SPECIAL_ACTION) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_PATTERN_WARP_TARGET) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(BUFF_BY_OBJECT) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOB_PATTERN_ATTACK) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(MOBS_DESPAWN_BY_LINK_MOB) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(REMOVE_BUFF) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(DUNGEON_TIME_CONTROL) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(CHARACTER_STATUS) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(DUNGEON_TIMER) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 NOTIFICATION_PROCEDURE_BINDING(DUNGEON_TIMER_INFO) {
-    SendRuntimeNotification(Socket, Connection, (RTNotificationRef)Notification);
+    SendRuntimeNotification(Runtime, Socket, Connection, (RTNotificationRef)Notification);
 }
 
 Void BroadcastUserList(
@@ -255,14 +236,7 @@ Void BroadcastToParty(
         RTPartyRef Party = RTPartyManagerGetParty(Context->Runtime->PartyManager, PartyID);
         if (!Party) return;
 
-        for (Int Index = 0; Index < Party->MemberCount; Index += 1) {
-            RTPartyMemberInfoRef Member = &Party->Members[Index];
-            ClientContextRef Client = ServerGetClientByIndex(Context, Member->CharacterIndex, NULL);
-            if (!Client) return;
-
-            SocketSend(Context->ClientSocket, Client->Connection, Notification);
-        }
-
+        ServerBroadcastToPartyGroup(Context, Party, Notification);
         return;
     }
 
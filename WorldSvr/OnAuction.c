@@ -54,6 +54,7 @@ CLIENT_PROCEDURE_BINDING(AUCTION_HOUSE_REGISTER_ITEM) {
         IPCPacketBufferAppendCopy(Server->IPCSocket->PacketBuffer, &ItemSlot, sizeof(struct _RTItemSlot));
     }
 
+    RTInventorySort(Runtime, &Character->Data.InventoryInfo);
     Request->InventoryInfo = Character->Data.InventoryInfo.Info;
     if (Request->InventoryInfo.SlotCount > 0) {
         IPCPacketBufferAppendCopy(
@@ -136,6 +137,7 @@ CLIENT_PROCEDURE_BINDING(AUCTION_HOUSE_UPDATE_ITEM) {
             IPCPacketBufferAppendCopy(Server->IPCSocket->PacketBuffer, &ItemSlot, sizeof(struct _RTItemSlot));
         }
 
+        RTInventorySort(Runtime, &Character->Data.InventoryInfo);
         RequestData->InventoryInfo = Character->Data.InventoryInfo.Info;
         if (RequestData->InventoryInfo.SlotCount > 0) {
             IPCPacketBufferAppendCopy(
@@ -125,6 +125,7 @@ CLIENT_PROCEDURE_BINDING(CREATE_CHARACTER) {
 		};
 		RTInventorySetSlot(Runtime, &InventoryData, &ItemSlot);
 	}
+	RTInventorySort(Runtime, &InventoryData);
 	IPCPacketBufferAppendCopy(Server->IPCSocket->PacketBuffer, &InventoryData.Info, sizeof(struct _RTInventoryInfo));
 	IPCPacketBufferAppendCopy(Server->IPCSocket->PacketBuffer, InventoryData.Slots, sizeof(struct _RTItemSlot) * InventoryData.Info.SlotCount);
 
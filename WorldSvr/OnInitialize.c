@@ -99,7 +99,7 @@ IPC_PROCEDURE_BINDING(D2W, GET_CHARACTER) {
     Character = RTWorldManagerCreateCharacter(Context->Runtime->WorldManager, Packet->CharacterIndex);
     Character->DungeonEntryItemSlotIndex = -1;
     Character->SyncMask.RawValue = 0;
-    Character->SyncTimestamp = PlatformGetTickCount();
+    Character->SyncTimestamp = GetTimestampMs();
     Character->Data.AccountInfo = Client->AccountInfo;
     Character->Data.Info = Packet->Character.CharacterInfo;
     Character->Data.StyleInfo = Packet->Character.CharacterStyleInfo;
@@ -137,6 +137,7 @@ IPC_PROCEDURE_BINDING(D2W, GET_CHARACTER) {
         memcpy(Character->Data.InventoryInfo.Slots, Memory, Length);
         Memory += Length;
     }
+    RTInventoryInitialize(Context->Runtime, &Character->Data.InventoryInfo);
 
     Character->Data.VehicleInventoryInfo.Info = Packet->Character.VehicleInventoryInfo;
     if (Packet->Character.VehicleInventoryInfo.SlotCount > 0) {
@@ -532,6 +533,7 @@ IPC_PROCEDURE_BINDING(D2W, GET_CHARACTER) {
     );
 
     Client->CharacterIndex = Packet->CharacterIndex;
+    ServerRegisterClientCharacter(Context, Client);
 
     RTWorldContextRef World = RTRuntimeGetWorldByCharacter(Runtime, Character);
     if ((World->WorldData->Type == RUNTIME_WORLD_TYPE_QUEST_DUNGEON ||
@@ -658,6 +660,7 @@ IPC_PROCEDURE_BINDING(D2W, GET_CHARACTER) {
         );
     }
 
+    RTInventorySort(Runtime, &Character->Data.InventoryInfo);
     Response->InventoryInfo = Character->Data.InventoryInfo.Info;
     if (Character->Data.InventoryInfo.Info.SlotCount > 0) {
         PacketBufferAppendCopy(
@@ -226,7 +226,7 @@ CLIENT_PROCEDURE_BINDING(PUSH_EQUIPMENT_ITEM) {
     Character->SyncMask.EquipmentInfo = true;
     Character->SyncMask.InventoryInfo = true;
 
-    RTCharacterInitializeAttributes(Runtime, Character);
+    RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_EQUIPMENT));
 
     S2C_DATA_PUSH_EQUIPMENT_ITEM* Response = PacketBufferInit(SocketGetNextPacketBuffer(Socket), S2C, PUSH_EQUIPMENT_ITEM);
     Response->Result = 1;
@@ -274,7 +274,7 @@ CLIENT_PROCEDURE_BINDING(MOVE_INVENTORY_ITEM) {
     );
 
     if (Response->Result && (Packet->Source.StorageType == STORAGE_TYPE_EQUIPMENT || Packet->Destination.StorageType == STORAGE_TYPE_EQUIPMENT)) {
-        RTCharacterInitializeAttributes(Runtime, Character);
+        RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_EQUIPMENT));
     }
 
     SocketSend(Socket, Connection, Response);
@@ -337,7 +337,7 @@ CLIENT_PROCEDURE_BINDING(SWAP_INVENTORY_ITEM) {
         Packet->Source2.StorageType == STORAGE_TYPE_EQUIPMENT ||
         Packet->Destination1.StorageType == STORAGE_TYPE_EQUIPMENT ||
         Packet->Destination2.StorageType == STORAGE_TYPE_EQUIPMENT) { 
-        RTCharacterInitializeAttributes(Runtime, Character);
+        RTCharacterUpdateAttributes(Runtime, Character, RUNTIME_ATTRIBUTE_SOURCE_MASK(RUNTIME_ATTRIBUTE_SOURCE_EQUIPMENT));
     }
 
     SocketSend(Socket, Connection, Response);
@@ -514,6 +514,7 @@ CLIENT_PROCEDURE_BINDING(SORT_INVENTORY) {
         assert(Found);
     }
 
+    RTInventoryInitialize(Runtime, TempInventory);
     memcpy(&Character->Data.InventoryInfo, TempInventory, sizeof(struct _RTCharacterInventoryInfo));
 
     Character->SyncMask.InventoryInfo = true;
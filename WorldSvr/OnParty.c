@@ -146,6 +146,7 @@ IPC_PROCEDURE_BINDING(P2W, PARTY_INVITE_CONFIRM) {
 	// TODO: Add member to PartyID lookup table
 	if (Character && Packet->Success) {
 		Character->PartyID = Packet->PartyID;
+		ServerInvalidatePartyGroup(Context, Character->PartyID);
 	}
 
 	S2C_DATA_PARTY_INVITE_CONFIRM* Response = PacketBufferInit(SocketGetNextPacketBuffer(Context->ClientSocket), S2C, PARTY_INVITE_CONFIRM);
@@ -215,6 +216,7 @@ IPC_PROCEDURE_BINDING(P2W, PARTY_LEAVE_ACK) {
 	if (!ClientConnection || !Character) return;
 
 	if (Packet->Result) {
+		ServerInvalidatePartyGroup(Context, Character->PartyID);
 		RTPartyManagerRemoveMember(Runtime->PartyManager, Character->CharacterIndex);
 		Character->PartyID = kEntityIDNull;
 	}
@@ -319,26 +321,41 @@ IPC_PROCEDURE_BINDING(P2W, PARTY_INVITE_TIMEOUT) {
 	}
 }
 
+static Bool DecodeRemoteParty(
+	IPCPacketRef Packet,
+	Int32 HeaderLength,
+	UInt8* Data,
+	Int32 DataLength,
+	RTPartyRef Party
+) {
+	if (DataLength < 0 || HeaderLength + DataLength > (Int32)Packet->Length) return false;
+
+	return SparseDecode(&kRTPartySchema, Data, DataLength, Party);
+}
+
 IPC_PROCEDURE_BINDING(P2W, PARTY_INFO) {
-	Int PartyPoolIndex = Packet->Party.ID.EntityIndex;
+	struct _RTParty RemoteParty = { 0 };
+	if (!DecodeRemoteParty(&Packet->Header, sizeof(IPC_P2W_DATA_PARTY_INFO), Packet->Data, Packet->Length, &RemoteParty)) return;
+
+	Int PartyPoolIndex = RemoteParty.ID.EntityIndex;
 	if (MemoryPoolIsReserved(Runtime->PartyManager->PartyPool, PartyPoolIndex)) {
 		RTPartyRef LocalParty = (RTPartyRef)MemoryPoolFetch(Runtime->PartyManager->PartyPool, PartyPoolIndex);
-		memcpy(LocalParty, &Packet->Party, sizeof(struct _RTParty));
+		memcpy(LocalParty, &RemoteParty, sizeof(struct _RTParty));
 	}
 
-	for (Int Index = 0; Index < Packet->Party.MemberCount; Index += 1) {
-		RTPartyMemberInfoRef Member = &Packet->Party.Members[Index];
+	for (Int Index = 0; Index < RemoteParty.MemberCount; Index += 1) {
+		RTPartyMemberInfoRef Member = &RemoteParty.Members[Index];
 
 		ClientContextRef Client = ServerGetClientByIndex(Context, Member->CharacterIndex, NULL);
 		if (!Client) continue;
 
 		S2C_DATA_NFY_PARTY_INFO* Notification = PacketBufferInit(SocketGetNextPacketBuffer(Context->ClientSocket), S2C, NFY_PARTY_INFO);
 		Notification->Result = 0;
-		Notification->LeaderCharacterIndex = (UInt32)Packet->Party.LeaderCharacterIndex;
-		Notification->MemberCount = Packet->Party.MemberCount;
+		Notification->LeaderCharacterIndex = (UInt32)RemoteParty.LeaderCharacterIndex;
+		Notification->MemberCount = RemoteParty.MemberCount;
 
-		for (Int MemberIndex = 0; MemberIndex < Packet->Party.MemberCount; MemberIndex += 1) {
-			Notification->Members[MemberIndex] = Packet->Party.Members[MemberIndex];
+		for (Int MemberIndex = 0; MemberIndex < RemoteParty.MemberCount; MemberIndex += 1) {
+			Notification->Members[MemberIndex] = RemoteParty.Members[MemberIndex];
 		}
 
 		SocketSend(Context->ClientSocket, Client->Connection, Notification);
@@ -349,6 +366,7 @@ IPC_PROCEDURE_BINDING(P2W, CLIENT_CONNECT) {
 	if (!ClientConnection) return;
 
 	Character->PartyID = Packet->PartyID;
+	ServerInvalidatePartyGroup(Context, Character->PartyID);
 
 	S2C_DATA_NFY_PARTY_INIT* Notification = PacketBufferInit(SocketGetNextPacketBuffer(Context->ClientSocket), S2C, NFY_PARTY_INIT);
 	Notification->Result = Packet->Result;
@@ -417,7 +435,10 @@ IPC_PROCEDURE_BINDING(P2W, BROADCAST_TO_CHARACTER) {
 }
 
 IPC_PROCEDURE_BINDING(P2W, CREATE_PARTY) {
-	RTPartyRef Party = RTPartyManagerCreatePartyRemote(Runtime->PartyManager, &Packet->Party);
+	struct _RTParty RemoteParty = { 0 };
+	if (!DecodeRemoteParty(&Packet->Header, sizeof(IPC_P2W_DATA_CREATE_PARTY), Packet->Data, Packet->Length, &RemoteParty)) return;
+
+	RTPartyRef Party = RTPartyManagerCreatePartyRemote(Runtime->PartyManager, &RemoteParty);
 	if (Party) {
 		for (Int Index = 0; Index < Party->MemberCount; Index += 1) {
 			RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(Runtime->WorldManager, Party->Members[Index].CharacterIndex);
@@ -429,8 +450,11 @@ IPC_PROCEDURE_BINDING(P2W, CREATE_PARTY) {
 }
 
 IPC_PROCEDURE_BINDING(P2W, DESTROY_PARTY) {
+	struct _RTParty RemoteParty = { 0 };
+	if (!DecodeRemoteParty(&Packet->Header, sizeof(IPC_P2W_DATA_DESTROY_PARTY), Packet->Data, Packet->Length, &RemoteParty)) return;
+
 	// TODO: Cleanup Character->PartyID
-	RTPartyManagerDestroyPartyRemote(Runtime->PartyManager, &Packet->Party);
+	RTPartyManagerDestroyPartyRemote(Runtime->PartyManager, &RemoteParty);
 }
 
 Void SendPartyData(
@@ -485,9 +509,5 @@ Void SendPartyData(
 		}
 	}
 
-	for (Int Index = 0; Index < Party->MemberCount; Index += 1) {
-		ClientContextRef Client = ServerGetClientByIndex(Context, Party->Members[Index].CharacterIndex, NULL);
-		if (!Client) continue;
-		SocketSend(Context->ClientSocket, Client->Connection, Notification);
-	}
+	ServerBroadcastToPartyGroup(Context, Party, Notification);
 }
@@ -118,6 +118,7 @@ Void ServerSyncCharacter(
 	}
 
 	if (Character->SyncMask.InventoryInfo) {
+		RTInventorySort(Context->Runtime, &Character->Data.InventoryInfo);
 		IPCPacketBufferAppendCopy(Server->IPCSocket->PacketBuffer, &Character->Data.InventoryInfo.Info, sizeof(struct _RTInventoryInfo));
 		IPCPacketBufferAppendCopy(Server->IPCSocket->PacketBuffer, Character->Data.InventoryInfo.Slots, sizeof(struct _RTItemSlot) * Character->Data.InventoryInfo.Info.SlotCount);
 	}
@@ -255,6 +256,7 @@ Void ServerSyncCharacter(
 	}
 
 	if (Character->SyncMask.TemporaryInventoryInfo) {
+		RTInventorySort(Context->Runtime, &Character->Data.TemporaryInventoryInfo);
 		IPCPacketBufferAppendCopy(Server->IPCSocket->PacketBuffer, &Character->Data.TemporaryInventoryInfo.Info, sizeof(struct _RTInventoryInfo));
 		IPCPacketBufferAppendCopy(Server->IPCSocket->PacketBuffer, Character->Data.TemporaryInventoryInfo.Slots, sizeof(struct _RTItemSlot) * Character->Data.TemporaryInventoryInfo.Info.SlotCount);
 	}
@@ -298,30 +300,52 @@ Void ServerSyncDB(
 	ServerContextRef Context,
 	Bool Force
 ) {
-	Timestamp Timestamp = GetTimestampMs();
+	if (Force) {
+		SocketConnectionIteratorRef Iterator = SocketGetConnectionIterator(Context->ClientSocket);
+		while (Iterator) {
+			SocketConnectionRef Connection = SocketConnectionIteratorFetch(Context->ClientSocket, Iterator);
+			Iterator = SocketConnectionIteratorNext(Context->ClientSocket, Iterator);
 
-	SocketConnectionIteratorRef Iterator = SocketGetConnectionIterator(Context->ClientSocket);
-	while (Iterator) {
-		SocketConnectionRef Connection = SocketConnectionIteratorFetch(Context->ClientSocket, Iterator);
-		// TODO: Connection can become null!!!
+			ClientContextRef Client = (ClientContextRef)Connection->Userdata;
+			if (Client->CharacterIndex < 1) continue;
 
-		Iterator = SocketConnectionIteratorNext(Context->ClientSocket, Iterator);
+			RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(Context->Runtime->WorldManager, Client->CharacterIndex);
+			if (!Character) continue;
 
-		ClientContextRef Client = (ClientContextRef)Connection->Userdata;
-		if (Client->CharacterIndex < 1) continue;
+			ServerSyncCharacter(Server, Context, Client, Character);
+		}
 
-		RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(Context->Runtime->WorldManager, Client->CharacterIndex);
-		if (!Character) continue;
+		return;
+	}
 
-		Bool PerformSync = Force || (
-			Character->SyncMask.RawValue && 
-            (Timestamp - Character->SyncTimestamp) >= Context->Config.WorldSvr.DBSyncTimer
-		);
+	// NOTE: Characters are queued by the runtime once their deadline is due, the budget spreads bursts over multiple updates
+	ArrayRef Queue = Context->Runtime->CharacterSyncQueue;
+	Int QueueCount = ArrayGetElementCount(Queue);
+	if (QueueCount < 1) return;
 
-		if (PerformSync) {
-			ServerSyncCharacter(Server, Context, Client, Character);
+	Timestamp Timestamp = GetTimestampMs();
+	Int SyncCount = MIN(QueueCount, MAX(1, Context->Config.WorldSvr.DBSyncBudget));
+	for (Int Index = 0; Index < SyncCount; Index += 1) {
+		UInt32 CharacterIndex = *(UInt32*)ArrayGetElementAtIndex(Queue, Index);
+		RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(Context->Runtime->WorldManager, CharacterIndex);
+		if (!Character || !Character->IsSyncQueued) continue;
+
+		Character->IsSyncQueued = false;
+		if (!Character->SyncMask.RawValue) continue;
+
+		// NOTE: The character could have been synced directly since it was scheduled
+		if (Timestamp - Character->SyncTimestamp < Context->Config.WorldSvr.DBSyncTimer) {
+			RTCharacterScheduleSync(Context->Runtime, Character);
+			continue;
 		}
+
+		ClientContextRef Client = ServerGetClientByIndex(Context, CharacterIndex, NULL);
+		if (!Client) continue;
+
+		ServerSyncCharacter(Server, Context, Client, Character);
 	}
+
+	ArrayRemoveElementsAtIndex(Queue, 0, SyncCount);
 }
 
 IPC_PROCEDURE_BINDING(D2W, DBSYNC) {
@@ -329,5 +353,6 @@ IPC_PROCEDURE_BINDING(D2W, DBSYNC) {
 
 	if (Packet->SyncMaskFailed.RawValue) {
 		Character->SyncMask.RawValue |= Packet->SyncMaskFailed.RawValue;
+		RTCharacterScheduleSync(Context->Runtime, Character);
 	}
 }
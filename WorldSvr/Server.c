@@ -74,6 +74,10 @@ Void ServerLoadRuntimeData(
     Loaded &= ServerLoadWorldDropData(Context, Config.WorldSvr.RuntimeDataPath, Config.WorldSvr.ServerDataPath, TempArchive);
     if (!Loaded) Fatal("Failed to load world drop data!");
 
+    // NOTE: Drop tables have to be compiled again whenever the drop or option pools are reloaded
+    RTOptionPoolManagerCompile(Context->Runtime->OptionPoolManager);
+    RTRuntimeCompileDropTables(Context->Runtime);
+
     /*
     IndexSetRef IndexSet = IndexSetCreate(AllocatorGetDefault(), 256);
 
@@ -195,24 +199,199 @@ ClientContextRef ServerGetClientByEntity(
     return NULL;
 }
 
+Void ServerRegisterClientCharacter(
+    ServerContextRef Context,
+    ClientContextRef Client
+) {
+    assert(Client->CharacterIndex > 0);
+
+    Int Key = (Int)Client->CharacterIndex;
+    DictionaryInsert(Context->CharacterIndexToClient, &Key, &Client, sizeof(ClientContextRef));
+}
+
+Void ServerUnregisterClientCharacter(
+    ServerContextRef Context,
+    ClientContextRef Client
+) {
+    if (Client->CharacterIndex < 1) return;
+
+    Int Key = (Int)Client->CharacterIndex;
+    ClientContextRef* Entry = (ClientContextRef*)DictionaryLookup(Context->CharacterIndexToClient, &Key);
+    if (Entry && *Entry == Client) DictionaryRemove(Context->CharacterIndexToClient, &Key);
+}
+
 ClientContextRef ServerGetClientByIndex(
     ServerContextRef Context,
     UInt32 CharacterIndex,
     CString CharacterName
 ) {
+    Int Key = (Int)CharacterIndex;
+    ClientContextRef* Entry = (ClientContextRef*)DictionaryLookup(Context->CharacterIndexToClient, &Key);
+    if (!Entry) return NULL;
+
+    // NOTE: Client contexts are pooled, the entry is only valid while it is still bound to the same character
+    ClientContextRef Client = *Entry;
+    if (Client->Connection->Userdata != Client || Client->CharacterIndex != CharacterIndex) return NULL;
+
+    if (CharacterName) {
+        RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(Context->Runtime->WorldManager, CharacterIndex);
+        if (Character && !CStringIsEqual(CharacterName, Character->Name)) return NULL;
+    }
+
+    return Client;
+}
+
+static Void ServerRebuildPartyGroup(
+    ServerContextRef Context,
+    ServerPartyGroupRef Group,
+    RTPartyRef Party
+) {
+    Group->IsDirty = false;
+    Group->MemberCount = Party->MemberCount;
+    for (Int Index = 0; Index < Party->MemberCount; Index += 1) {
+        ServerPartyGroupMemberRef Member = &Group->Members[Index];
+        Member->CharacterIndex = Party->Members[Index].CharacterIndex;
+        Member->ConnectionID = -1;
+        Member->Connection = NULL;
+    }
+
+    // NOTE: Resolve all members in a single pass over the connections instead of one lookup per member
     SocketConnectionIteratorRef Iterator = SocketGetConnectionIterator(Context->ClientSocket);
     while (Iterator) {
         SocketConnectionRef Connection = SocketConnectionIteratorFetch(Context->ClientSocket, Iterator);
         Iterator = SocketConnectionIteratorNext(Context->ClientSocket, Iterator);
 
         ClientContextRef Client = (ClientContextRef)Connection->Userdata;
-        if (Client && Client->CharacterIndex == CharacterIndex) {
-            RTCharacterRef Character = RTWorldManagerGetCharacterByIndex(Context->Runtime->WorldManager, CharacterIndex);
-            if (Character && CharacterName && !CStringIsEqual(CharacterName, Character->Name)) continue;
-            
-            return Client;
+        if (!Client || Client->CharacterIndex < 1) continue;
+
+        for (Int Index = 0; Index < Group->MemberCount; Index += 1) {
+            ServerPartyGroupMemberRef Member = &Group->Members[Index];
+            if (Member->CharacterIndex != Client->CharacterIndex) continue;
+
+            Member->ConnectionID = Connection->ID;
+            Member->Connection = Connection;
+            break;
         }
     }
+}
 
-    return NULL;
+static Bool ServerPartyGroupIsValid(
+    ServerPartyGroupRef Group,
+    RTPartyRef Party
+) {
+    if (Group->IsDirty || Group->MemberCount != Party->MemberCount) return false;
+
+    for (Int Index = 0; Index < Group->MemberCount; Index += 1) {
+        ServerPartyGroupMemberRef Member = &Group->Members[Index];
+        if (Member->CharacterIndex != Party->Members[Index].CharacterIndex) return false;
+        if (!Member->Connection) continue;
+
+        // NOTE: Connections are pooled, so a cached handle is only trusted while it still belongs to the same member
+        ClientContextRef Client = (ClientContextRef)Member->Connection->Userdata;
+        if (Member->Connection->ID != Member->ConnectionID) return false;
+        if (!Client || Client->CharacterIndex != Member->CharacterIndex) return false;
+    }
+
+    return true;
+}
+
+ServerPartyGroupRef ServerGetPartyGroup(
+    ServerContextRef Context,
+    RTPartyRef Party
+) {
+    Int Key = (Int)Party->ID.Serial;
+    ServerPartyGroupRef Group = (ServerPartyGroupRef)DictionaryLookup(Context->PartyGroups, &Key);
+    if (!Group) {
+        struct _ServerPartyGroup NewGroup = { 0 };
+        NewGroup.PartyID = Party->ID;
+        NewGroup.IsDirty = true;
+        DictionaryInsert(Context->PartyGroups, &Key, &NewGroup, sizeof(struct _ServerPartyGroup));
+        Group = (ServerPartyGroupRef)DictionaryLookup(Context->PartyGroups, &Key);
+        assert(Group);
+    }
+
+    if (!ServerPartyGroupIsValid(Group, Party)) {
+        ServerRebuildPartyGroup(Context, Group, Party);
+    }
+
+    return Group;
+}
+
+Void ServerInvalidatePartyGroup(
+    ServerContextRef Context,
+    RTEntityID PartyID
+) {
+    if (RTEntityIsNull(PartyID)) return;
+
+    Int Key = (Int)PartyID.Serial;
+    ServerPartyGroupRef Group = (ServerPartyGroupRef)DictionaryLookup(Context->PartyGroups, &Key);
+    if (Group) Group->IsDirty = true;
+}
+
+Void ServerRemovePartyGroup(
+    ServerContextRef Context,
+    RTEntityID PartyID
+) {
+    Int Key = (Int)PartyID.Serial;
+    DictionaryRemove(Context->PartyGroups, &Key);
+}
+
+// NOTE: Solo dungeon parties are destroyed inside of the runtime, so the group is dropped from the party manager hook
+Void ServerOnDestroyParty(
+    RTPartyManagerRef PartyManager,
+    RTPartyRef Party,
+    Void* UserData
+) {
+    ServerRemovePartyGroup((ServerContextRef)UserData, Party->ID);
+}
+
+Void ServerBroadcastToPartyGroup(
+    ServerContextRef Context,
+    RTPartyRef Party,
+    Void *Packet
+) {
+    ServerPartyGroupRef Group = ServerGetPartyGroup(Context, Party);
+    for (Int Index = 0; Index < Group->MemberCount; Index += 1) {
+        ServerPartyGroupMemberRef Member = &Group->Members[Index];
+        if (!Member->Connection) continue;
+
+        SocketSend(Context->ClientSocket, Member->Connection, Packet);
+    }
+}
+
+Void ServerQueuePartyData(
+    ServerContextRef Context,
+    RTEntityID PartyID
+) {
+    if (RTEntityIsNull(PartyID)) return;
+
+    RTPartyRef Party = RTPartyManagerGetParty(Context->Runtime->PartyManager, PartyID);
+    if (!Party) return;
+
+    ServerPartyGroupRef Group = ServerGetPartyGroup(Context, Party);
+    if (Group->IsPartyDataQueued) return;
+
+    Group->IsPartyDataQueued = true;
+    ArrayAppendElement(Context->PartyDataQueue, &PartyID);
+}
+
+Void ServerFlushPartyData(
+    ServerContextRef Context
+) {
+    for (Int Index = 0; Index < ArrayGetElementCount(Context->PartyDataQueue); Index += 1) {
+        RTEntityID PartyID = *(RTEntityID*)ArrayGetElementAtIndex(Context->PartyDataQueue, Index);
+        Int Key = (Int)PartyID.Serial;
+        ServerPartyGroupRef Group = (ServerPartyGroupRef)DictionaryLookup(Context->PartyGroups, &Key);
+        if (Group) Group->IsPartyDataQueued = false;
+
+        RTPartyRef Party = RTPartyManagerGetParty(Context->Runtime->PartyManager, PartyID);
+        if (!Party) {
+            ServerRemovePartyGroup(Context, PartyID);
+            continue;
+        }
+
+        SendPartyData(Context, Context->ClientSocket, Party);
+    }
+
+    ArrayRemoveAllElements(Context->PartyDataQueue, true);
 }
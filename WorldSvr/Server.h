@@ -29,10 +29,56 @@ ClientContextRef ServerGetClientByEntity(
     RTEntityID Entity
 );
 
+Void ServerRegisterClientCharacter(
+    ServerContextRef Context,
+    ClientContextRef Client
+);
+
+Void ServerUnregisterClientCharacter(
+    ServerContextRef Context,
+    ClientContextRef Client
+);
+
 ClientContextRef ServerGetClientByIndex(
     ServerContextRef Context,
     UInt32 CharacterIndex,
     CString CharacterName
 );
 
+ServerPartyGroupRef ServerGetPartyGroup(
+    ServerContextRef Context,
+    RTPartyRef Party
+);
+
+Void ServerInvalidatePartyGroup(
+    ServerContextRef Context,
+    RTEntityID PartyID
+);
+
+Void ServerRemovePartyGroup(
+    ServerContextRef Context,
+    RTEntityID PartyID
+);
+
+Void ServerOnDestroyParty(
+    RTPartyManagerRef PartyManager,
+    RTPartyRef Party,
+    Void* UserData
+);
+
+Void ServerBroadcastToPartyGroup(
+    ServerContextRef Context,
+    RTPartyRef Party,
+    Void *Packet
+);
+
+Void ServerQueuePartyData(
+    ServerContextRef Context,
+    RTEntityID PartyID
+);
+
+Void ServerFlushPartyData(
+    ServerContextRef Context
+);
+
 EXTERN_C_END
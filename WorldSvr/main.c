@@ -128,6 +128,8 @@ Void ServerOnUpdate(
 ) {
     ServerContextRef Context = (ServerContextRef)ServerContext;
     RTRuntimeUpdate(Context->Runtime);
+    ServerFlushPartyData(Context);
+    SocketProcessDeferred(Context->ClientSocket);
     ServerSyncDB(Server, Context, false);
 
     Timestamp CurrentTimestamp = GetTimestampMs();
@@ -166,11 +168,21 @@ Int32 main(Int32 ArgumentCount, CString* Arguments) {
     ServerContext.Runtime->Environment.IsRaidBossEnabled = Config.Environment.IsRaidBossEnabled;
     ServerContext.Runtime->Config.IsSkillRankUpLimitEnabled = Config.Environment.IsSkillRankUpLimitEnabled;
     ServerContext.Runtime->Config.WorldItemDespawnInterval = Config.WorldSvr.WorldItemDespawnInterval;
+    ServerContext.Runtime->Config.IsPathFindingGraphEnabled = Config.WorldSvr.IsPathFindingGraphEnabled;
+    ServerContext.Runtime->Config.CharacterUpdateInterval = Config.WorldSvr.CharacterUpdateInterval;
+    ServerContext.Runtime->Config.MobUpdateInterval = Config.WorldSvr.MobUpdateInterval;
+    ServerContext.Runtime->Config.ItemUpdateInterval = Config.WorldSvr.ItemUpdateInterval;
+    ServerContext.Runtime->Config.DungeonUpdateInterval = Config.WorldSvr.DungeonUpdateInterval;
+    ServerContext.Runtime->Config.CharacterSyncInterval = Config.WorldSvr.DBSyncTimer;
     ServerContext.Runtime->Config.NewbieSupportTimeout = Config.WorldSvr.NewbieSupportTimeout;
     ServerContext.Runtime->Config.MinHonorPoint = Config.Environment.MinHonorPoint;
     ServerContext.Runtime->Config.MaxHonorPoint = Config.Environment.MaxHonorPoint;
     ServerContext.Runtime->Config.ScriptFilePath = Config.WorldSvr.ScriptDataPath;
     ServerContext.ItemScriptRegistry = IndexDictionaryCreate(Allocator, 8);
+    ServerContext.CharacterIndexToClient = IndexDictionaryCreate(Allocator, Config.WorldSvr.MaxConnectionCount);
+    ServerContext.PartyGroups = IndexDictionaryCreate(Allocator, 8);
+    ServerContext.PartyDataQueue = ArrayCreateEmpty(Allocator, sizeof(RTEntityID), 8);
+    RTPartyManagerSetDestroyPartyCallback(ServerContext.Runtime->PartyManager, &ServerOnDestroyParty, &ServerContext);
 
     IPCNodeID NodeID = kIPCNodeIDNull;
     NodeID.Group = Config.WorldSvr.GroupIndex;
@@ -189,6 +201,7 @@ Int32 main(Int32 ArgumentCount, CString* Arguments) {
         &ServerOnUpdate,
         &ServerContext
     );
+    ServerEnableMetrics(Server, Config.NetLib.MetricsPort);
     ServerContext.Server = Server;
     ServerContext.IPCSocket = Server->IPCSocket;
 
@@ -272,6 +285,9 @@ Int32 main(Int32 ArgumentCount, CString* Arguments) {
         Iterator = DictionaryKeyIteratorNext(Iterator);
     }
 
+    DictionaryDestroy(ServerContext.CharacterIndexToClient);
+    DictionaryDestroy(ServerContext.PartyGroups);
+    ArrayDestroy(ServerContext.PartyDataQueue);
     RTRuntimeDestroy(ServerContext.Runtime);
 
     return EXIT_SUCCESS;